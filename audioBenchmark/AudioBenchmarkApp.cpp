@@ -0,0 +1,260 @@
+﻿#include <JuceHeader.h>
+#include "audioCore/AC_API.h"
+#include "audioCore/AudioCore.h"
+#include "audioCore/command/AudioCommand.h"
+#include "audioCore/misc/Device.h"
+#include "audioCore/misc/DummyAudioDevice.h"
+#include "audioCore/misc/Renderer.h"
+#include "audioCore/source/SourceIO.h"
+#include "audioCore/plugin/PluginLoader.h"
+
+#define OUT(x) \
+	DBG(x); \
+	std::cout << (x) << std::endl
+
+class AudioBenchmarkApp final : public juce::JUCEApplication,
+	private juce::Timer {
+public:
+	const juce::String getApplicationName() override { return "VocalShaper.AudioBenchmark"; };
+	const juce::String getApplicationVersion() override {
+		return juce::String{ PROJECT_VERSION_MAJOR } + "." + juce::String{ PROJECT_VERSION_MINOR } + "." + juce::String{ PROJECT_VERSION_PATCH };
+	};
+	bool moreThanOneInstanceAllowed() override { return true; };
+
+	void initialise(const juce::String& commandLine) override {
+		/** Parse Command */
+		juce::StringArray commandArray = juce::StringArray::fromTokens(commandLine, " ", "\"");
+		for (auto& s : commandArray) {
+			/** Remove Quote */
+			s = s.removeCharacters("\"");
+		}
+		commandArray.removeEmptyStrings();
+		/** Check First Arg And Remove Execute Path */
+		if (commandArray.size() > 0) {
+			juce::File firstArgFile(commandArray[0]);
+			juce::File execFile = juce::File::getSpecialLocation(juce::File::hostApplicationPath);
+			if (firstArgFile == execFile) {
+				commandArray.remove(0);
+			}
+		}
+
+		/** Options */
+		juce::File projectFile, scriptFile;
+		double sampleRate = 48000;
+		int bufferSize = 512, renderBlockSize = 0, threadNum = -1;
+		juce::File renderDir = juce::File::getSpecialLocation(
+			juce::File::tempDirectory).getChildFile("VocalShaperBenchmark");
+		for (int i = 0; i < commandArray.size(); i++) {
+			auto& key = commandArray[i];
+			auto value = commandArray[i + 1];
+			if (key == "-p" || key == "--project") {
+				projectFile = juce::File::getCurrentWorkingDirectory().getChildFile(value); i++;
+			}
+			else if (key == "-s" || key == "--script") {
+				scriptFile = juce::File::getCurrentWorkingDirectory().getChildFile(value); i++;
+			}
+			else if (key == "-r" || key == "--sample-rate") {
+				sampleRate = value.getDoubleValue(); i++;
+			}
+			else if (key == "-b" || key == "--buffer-size") {
+				bufferSize = value.getIntValue(); i++;
+			}
+			else if (key == "-k" || key == "--render-block-size") {
+				renderBlockSize = value.getIntValue(); i++;
+			}
+			else if (key == "-t" || key == "--render-threads") {
+				threadNum = value.getIntValue(); i++;
+			}
+			else if (key == "-d" || key == "--render-dir") {
+				renderDir = juce::File::getCurrentWorkingDirectory().getChildFile(value); i++;
+			}
+			else if (key == "-o" || key == "--output") {
+				this->outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(value); i++;
+			}
+			else {
+				OUT("Usage: AudioBenchmark (-p project.vsp4 | -s script.lua) [-r 48000] [-b 512] [-k render-block-size] [-t render-threads] [-d render-dir] [-o result.json]");
+				this->exit(1);
+				return;
+			}
+		}
+		if ((projectFile == juce::File{}) == (scriptFile == juce::File{})
+			|| sampleRate <= 0 || bufferSize <= 0 || !renderDir.createDirectory()) {
+			OUT("\033[31m[ERROR]\033[0m Bad Command!");
+			this->exit(2);
+			return;
+		}
+
+		/** Dummy Audio Device, Registered Before The Audio Core Opens A Device */
+		Device::getInstance()->getManager()->addAudioDeviceType(
+			std::make_unique<DummyAudioIODeviceType>());
+		auto deviceState = std::make_unique<juce::XmlElement>("DEVICESETUP");
+		deviceState->setAttribute("deviceType", DummyAudioIODeviceType::typeName);
+		deviceState->setAttribute("audioOutputDeviceName", DummyAudioIODeviceType::deviceName);
+		deviceState->setAttribute("audioInputDeviceName", DummyAudioIODeviceType::deviceName);
+		deviceState->setAttribute("audioDeviceRate", sampleRate);
+		deviceState->setAttribute("audioDeviceBufferSize", bufferSize);
+		quickAPI::setAudioDeviceInitState(std::move(deviceState));
+
+		/** Shares Plugin List And Cache With The Main App */
+		auto audioDir = juce::File::getSpecialLocation(juce::File::hostApplicationPath)
+			.getParentDirectory().getChildFile("./data/audio/");
+		quickAPI::setPluginSearchPathListFilePath(audioDir.getChildFile("pluginPaths.txt").getFullPathName());
+		quickAPI::setPluginListTemporaryFilePath(audioDir.getChildFile("plugins.xml").getFullPathName());
+		quickAPI::setPluginBlackListFilePath(audioDir.getChildFile("blackPlugins.txt").getFullPathName());
+		quickAPI::setDeadPluginListPath(audioDir.getChildFile("./deadPlugins/").getFullPathName());
+		quickAPI::setSourceCachePath(audioDir.getChildFile("./sourceCache/").getFullPathName());
+		if (renderBlockSize > 0) { quickAPI::setRenderBlockSize(renderBlockSize); }
+		if (threadNum >= 0) { quickAPI::setRenderThreadNum(threadNum); }
+
+		/** Create Audio Core */
+		this->startTicks = juce::Time::getHighResolutionTicks();
+		AudioCore::getInstance();
+		ActionDispatcher::getInstance()->setOutput(
+			[](const juce::String& mes) { std::cout << mes; },
+			[](const juce::String& mes) { std::cerr << "\033[31m[ERROR]\033[0m " << mes; });
+
+		/** Run Lua Command */
+		juce::String command;
+		if (projectFile != juce::File{}) {
+			command = "AC.load([[" + projectFile.getFullPathName() + "]]);";
+			this->renderCommand = "AC.renderNow([[" + renderDir.getFullPathName() + "]], \"benchmark\", \".wav\", {";
+			this->renderProject = true;
+		}
+		else {
+			command = scriptFile.loadFileAsString();
+		}
+		if (!this->runCommand(command)) {
+			this->exit(4);
+			return;
+		}
+
+		/** Wait For Async Tasks */
+		this->startTimer(10);
+	};
+
+	void shutdown() override {
+		this->stopTimer();
+		shutdownAudioCore();
+	};
+
+private:
+	juce::File outputFile;
+	juce::String renderCommand;
+	bool renderProject = false;
+
+	enum class State {
+		Loading, Rendering
+	} state = State::Loading;
+	int64_t startTicks = 0;
+	double loadSeconds = 0;
+	uint64_t lastStatsID = 0;
+
+	void timerCallback() override {
+		switch (this->state) {
+		case State::Loading: {
+			/** Wait For Sources And Plugins */
+			if (SourceIO::getInstance()->isRunning()
+				|| PluginLoader::getInstance()->isRunning()) { return; }
+			this->loadSeconds = juce::Time::highResolutionTicksToSeconds(
+				juce::Time::getHighResolutionTicks() - this->startTicks);
+
+			/** Render All Mixer Tracks Of The Project */
+			this->lastStatsID = Renderer::getInstance()->getLastStats().id;
+			if (this->renderProject) {
+				juce::StringArray tracks;
+				for (int i = 0; i < quickAPI::getMixerTrackNum(); i++) {
+					tracks.add(juce::String{ i });
+				}
+				if (!this->runCommand(this->renderCommand + tracks.joinIntoString(", ") + "}, {}, 24, 0);")) {
+					this->exit(4);
+					return;
+				}
+			}
+
+			this->state = State::Rendering;
+			break;
+		}
+		case State::Rendering: {
+			/** Wait For Renderer */
+			if (Renderer::getInstance()->isRunning()) { return; }
+			if (this->renderProject
+				&& Renderer::getInstance()->getLastStats().id == this->lastStatsID) { return; }
+
+			/** Output */
+			auto json = juce::JSON::toString(this->getResult());
+			if (this->outputFile != juce::File{}) {
+				if (!this->outputFile.replaceWithText(json)) {
+					OUT("\033[31m[ERROR]\033[0m Can't Write Result!");
+					this->exit(3);
+					return;
+				}
+			}
+			else {
+				OUT(json);
+			}
+
+			this->exit(0);
+			break;
+		}
+		}
+	};
+
+	bool runCommand(const juce::String& command) {
+		auto [result, commandStr, res] = AudioCommand::getInstance()->processCommand(command);
+		if (!result) {
+			OUT("\033[31m[ERROR]\033[0m " + res);
+		}
+		return result;
+	};
+
+	juce::var getResult() const {
+		/** Host Info */
+		auto host = std::make_unique<juce::DynamicObject>();
+		host->setProperty("cpu", juce::SystemStats::getCpuModel());
+		host->setProperty("cores", juce::SystemStats::getNumPhysicalCpus());
+		host->setProperty("os", juce::SystemStats::getOperatingSystemName());
+
+		auto result = std::make_unique<juce::DynamicObject>();
+		result->setProperty("host", juce::var{ host.release() });
+		result->setProperty("loadSeconds", this->loadSeconds);
+
+		/** Render Timing */
+		auto stats = Renderer::getInstance()->getLastStats();
+		if (stats.id != this->lastStatsID) {
+			auto render = std::make_unique<juce::DynamicObject>();
+			render->setProperty("length", stats.length);
+			render->setProperty("seconds", stats.seconds);
+			render->setProperty("realtimeFactor", stats.getRealtimeFactor());
+			render->setProperty("sampleRate", stats.sampleRate);
+			render->setProperty("blockSize", stats.blockSize);
+			render->setProperty("threads", stats.threadNum);
+			render->setProperty("blockNum", stats.blockNum);
+			render->setProperty("averageBlockUs", stats.averageBlock * 1000000);
+			render->setProperty("p99BlockUs", stats.p99Block * 1000000);
+			render->setProperty("worstBlockUs", stats.worstBlock * 1000000);
+
+			juce::Array<juce::var> histogram;
+			for (int i = 0; i < Renderer::Stats::histogramSize; i++) {
+				if (stats.histogram[i] == 0) { continue; }
+				auto item = std::make_unique<juce::DynamicObject>();
+				item->setProperty("fromUs", 1 << i);
+				item->setProperty("toUs", 1 << (i + 1));
+				item->setProperty("count", stats.histogram[i]);
+				histogram.add(juce::var{ item.release() });
+			}
+			render->setProperty("blockHistogram", histogram);
+
+			result->setProperty("render", juce::var{ render.release() });
+		}
+
+		return juce::var{ result.release() };
+	};
+
+	void exit(int code) {
+		this->stopTimer();
+		this->setApplicationReturnValue(code);
+		juce::JUCEApplication::quit();
+	};
+};
+
+START_JUCE_APPLICATION(AudioBenchmarkApp)
@@ -47,49 +47,84 @@ void PluginSearcher::start() {
 		deadListFile.createDirectory();
 	}
 
+	/** Load Scan Cache */
+	auto lastCache = this->loadCache();
+	Cache cache;
+
 	/** Get All Support Plugin Type */
 	auto formats = formatManager.getFormats();
-	juce::StringArray deadPlugins;
+	juce::Array<ScanTask> tasks;
 	for (auto type : formats) {
-		/** Prepare Dead List File */
-		juce::File deadFile = deadListFile.getChildFile(type->getName() + ".txt");
-
-		/** Init The Scanner */
-		juce::PluginDirectoryScanner scanner(
-			plugins, *type, searchPath, true, deadFile, true);
-
-		/** Scan Plugins */
-		juce::String nextPlugin;
-		bool scanFlag = false;
-		do {
-			nextPlugin = scanner.getNextPluginFileThatWillBeScanned();
-			if (nextPlugin.isNotEmpty()) {
-				if (blackList.contains(nextPlugin)) {
-					OUT("\033[33m[SKIP]\033[0m " + nextPlugin.toStdString());
-					scanFlag = scanner.skipNextFile();
+		auto files = type->searchPathsForPlugins(searchPath, true, true);
+		for (auto& file : files) {
+			/** Black List */
+			if (blackList.contains(file)) {
+				OUT("\033[33m[SKIP]\033[0m " + file.toStdString());
+				continue;
+			}
+
+			/** Size And Time Are Checked First, The Hash Only When They Changed */
+			auto key = PluginSearcher::getCacheKey(type->getName(), file);
+			auto fingerprint = PluginSearcher::getFingerprint(file, false);
+			auto it = lastCache.find(key);
+			if (it != lastCache.end()) {
+				auto& last = it->second.fingerprint;
+				bool unchanged = (last.size == fingerprint.size)
+					&& (last.modifiedTime == fingerprint.modifiedTime);
+				if (!unchanged) {
+					fingerprint = PluginSearcher::getFingerprint(file, true);
+					unchanged = last.hash.isNotEmpty() && (last.hash == fingerprint.hash);
 				}
 				else {
-					OUT("\033[35m[SCAN]\033[0m " + nextPlugin.toStdString());
-					scanFlag = scanner.scanNextFile(true, nextPlugin);
+					fingerprint.hash = last.hash;
+				}
+
+				if (unchanged) {
+					OUT("\033[34m[CACHED]\033[0m " + file.toStdString());
+					auto entry = it->second;
+					entry.fingerprint = fingerprint;
+					cache[key] = entry;
+					continue;
 				}
 			}
-		} while(scanFlag);
-		/*while (scanner.scanNextFile(true, currentPlugin)) {
-			OUT("\033[35m[SCAN]\033[0m " + currentPlugin.toStdString());
-		}*/
 
-		/** Save Dead Plugins */
-		deadPlugins.addArray(scanner.getFailedFiles());
+			/** New Or Changed File */
+			if (fingerprint.hash.isEmpty()) {
+				fingerprint = PluginSearcher::getFingerprint(file, true);
+			}
+			tasks.add({ type->getName(), file, fingerprint });
+		}
 	}
 
-	/** Apply Dead Plugins As Black List */
-	for (auto& s : deadPlugins) {
-		plugins.addToBlacklist(s);
+	/** Scan New Files */
+	DeadList deadPlugins;
+	this->scanInChildProcesses(tasks, cache, deadPlugins);
+
+	/** Merge Results */
+	for (auto& [key, entry] : cache) {
+		for (auto& desc : entry.plugins) {
+			plugins.addType(desc);
+		}
+	}
+
+	/** Save Dead Plugins */
+	for (auto type : formats) {
+		auto& list = deadPlugins[type->getName()];
+		deadListFile.getChildFile(type->getName() + ".txt")
+			.replaceWithText(list.joinIntoString("\n"));
+
+		/** Apply Dead Plugins As Black List */
+		for (auto& s : list) {
+			plugins.addToBlacklist(s);
+		}
 	}
 
 	/** Save Black List */
 	this->saveBlackList(plugins.getBlacklistedFiles());
 
+	/** Save Scan Cache */
+	this->saveCache(cache);
+
 	/** Save Search Result */
 	auto xmlData = plugins.createXml();
 	this->saveTemporaryFile(xmlData.get());
@@ -99,6 +134,150 @@ void PluginSearcher::start() {
 	juce::JUCEApplication::quit();
 }
 
+int PluginSearcher::scanOne(const juce::String& formatName,
+	const juce::String& fileOrIdentifier, const juce::String& outputFilePath) {
+	/** Plugin Format Manager */
+	juce::AudioPluginFormatManager formatManager;
+	formatManager.addDefaultFormats();
+
+	/** Find Format */
+	for (auto type : formatManager.getFormats()) {
+		if (type->getName() != formatName) { continue; }
+
+		/** Scan File */
+		juce::OwnedArray<juce::PluginDescription> found;
+		type->findAllTypesForFile(found, fileOrIdentifier);
+
+		/** Write Result */
+		juce::XmlElement xml{ "PLUGINS" };
+		for (auto desc : found) {
+			xml.addChildElement(desc->createXml().release());
+		}
+		return xml.writeTo(juce::File{ outputFilePath }) ? 0 : 1;
+	}
+
+	return 1;
+}
+
+void PluginSearcher::scanInChildProcesses(const juce::Array<ScanTask>& tasks,
+	Cache& cache, DeadList& deadPlugins) const {
+	auto execFile = juce::File::getSpecialLocation(juce::File::hostApplicationPath);
+	int processNum = std::clamp(juce::SystemStats::getNumCpus() - 1, 1, 8);
+
+	struct Running final {
+		int index = 0;
+		std::unique_ptr<juce::ChildProcess> process;
+		juce::File outputFile;
+		juce::uint32 startTime = 0;
+	};
+	std::vector<Running> running;
+
+	int next = 0;
+	while (next < tasks.size() || !running.empty()) {
+		/** Start Processes */
+		while (next < tasks.size() && (int)running.size() < processNum) {
+			auto& task = tasks.getReference(next);
+			auto outputFile = juce::File::createTempFile(".xml");
+
+			OUT("\033[35m[SCAN]\033[0m " + task.file.toStdString());
+			auto process = std::make_unique<juce::ChildProcess>();
+			if (process->start(juce::StringArray{ execFile.getFullPathName(), PluginSearcher::scanArg,
+				task.format, task.file, outputFile.getFullPathName() }, 0)) {
+				running.push_back({ next, std::move(process), outputFile, juce::Time::getMillisecondCounter() });
+			}
+			else {
+				OUT("\033[31m[DEAD]\033[0m " + task.file.toStdString());
+				deadPlugins[task.format].add(task.file);
+			}
+
+			next++;
+		}
+
+		/** Collect Finished Processes */
+		for (auto it = running.begin(); it != running.end();) {
+			auto& task = tasks.getReference(it->index);
+			bool timeout = (int)(juce::Time::getMillisecondCounter() - it->startTime) > PluginSearcher::scanTimeoutMs;
+			if (it->process->isRunning() && !timeout) {
+				it++;
+				continue;
+			}
+
+			/** Kill Hanging Plugin */
+			if (timeout) {
+				it->process->kill();
+			}
+
+			/** Read Result */
+			std::unique_ptr<juce::XmlElement> result = nullptr;
+			if (!timeout && it->process->getExitCode() == 0) {
+				result = juce::XmlDocument::parse(it->outputFile);
+			}
+			it->outputFile.deleteFile();
+
+			if (result) {
+				CacheEntry entry{ task.format, task.file, task.fingerprint };
+				for (auto child : result->getChildIterator()) {
+					juce::PluginDescription desc;
+					if (desc.loadFromXml(*child)) {
+						entry.plugins.add(desc);
+					}
+				}
+				cache[PluginSearcher::getCacheKey(task.format, task.file)] = entry;
+				OUT("\033[32m[DONE]\033[0m " + task.file.toStdString());
+			}
+			else {
+				OUT((timeout ? "\033[31m[TIMEOUT]\033[0m " : "\033[31m[DEAD]\033[0m ") + task.file.toStdString());
+				deadPlugins[task.format].add(task.file);
+			}
+
+			it = running.erase(it);
+		}
+
+		juce::Thread::sleep(10);
+	}
+}
+
+const juce::String PluginSearcher::getCacheKey(const juce::String& format, const juce::String& file) {
+	return format + "|" + file;
+}
+
+const PluginSearcher::Fingerprint PluginSearcher::getFingerprint(
+	const juce::String& fileOrIdentifier, bool withHash) {
+	/** Identifiers Which Are Not Files Have No Fingerprint */
+	if (!juce::File::isAbsolutePath(fileOrIdentifier)) { return {}; }
+	juce::File file{ fileOrIdentifier };
+	if (!file.exists()) { return {}; }
+
+	Fingerprint result;
+
+	/** Single Binary */
+	if (!file.isDirectory()) {
+		result.size = file.getSize();
+		result.modifiedTime = file.getLastModificationTime().toMilliseconds();
+		if (withHash) {
+			result.hash = juce::MD5{ file }.toHexString();
+		}
+		return result;
+	}
+
+	/** Bundles Are Summarized By Their File Tree */
+	juce::StringArray tree;
+	for (auto& entry : juce::RangedDirectoryIterator{ file, true, "*", juce::File::findFiles }) {
+		auto time = entry.getModificationTime().toMilliseconds();
+		result.size += entry.getFileSize();
+		result.modifiedTime = std::max(result.modifiedTime, time);
+		if (withHash) {
+			tree.add(entry.getFile().getRelativePathFrom(file)
+				+ ":" + juce::String{ entry.getFileSize() } + ":" + juce::String{ time });
+		}
+	}
+	if (withHash) {
+		tree.sortNatural();
+		result.hash = juce::MD5{ tree.joinIntoString("\n").toUTF8() }.toHexString();
+	}
+	return result;
+}
+
 const juce::File PluginSearcher::getSearchPathFile() const {
 	return juce::File::getSpecialLocation(juce::File::hostApplicationPath)
 		.getParentDirectory().getChildFile(this->pluginSearchPathListFilePath);
@@ -162,3 +341,56 @@ void PluginSearcher::saveTemporaryFile(const juce::XmlElement* data) const {
 
 	data->writeTo(ostream, juce::XmlElement::TextFormat{});
 }
+
+const juce::File PluginSearcher::getCacheFile() const {
+	return this->getTemporaryFile().getSiblingFile("pluginScanCache.xml");
+}
+
+const PluginSearcher::Cache PluginSearcher::loadCache() const {
+	Cache result;
+
+	auto xml = juce::XmlDocument::parse(this->getCacheFile());
+	if (!xml) { return result; }
+
+	for (auto fileXml : xml->getChildWithTagNameIterator("FILE")) {
+		CacheEntry entry;
+		entry.format = fileXml->getStringAttribute("format");
+		entry.file = fileXml->getStringAttribute("file");
+		entry.fingerprint.size = fileXml->getStringAttribute("size").getLargeIntValue();
+		entry.fingerprint.modifiedTime = fileXml->getStringAttribute("time").getLargeIntValue();
+		entry.fingerprint.hash = fileXml->getStringAttribute("hash");
+
+		for (auto child : fileXml->getChildIterator()) {
+			juce::PluginDescription desc;
+			if (desc.loadFromXml(*child)) {
+				entry.plugins.add(desc);
+			}
+		}
+
+		result[PluginSearcher::getCacheKey(entry.format, entry.file)] = entry;
+	}
+
+	return result;
+}
+
+void PluginSearcher::saveCache(const Cache& cache) const {
+	juce::XmlElement xml{ "PLUGINSCANCACHE" };
+	for (auto& [key, entry] : cache) {
+		auto fileXml = xml.createNewChildElement("FILE");
+		fileXml->setAttribute("format", entry.format);
+		fileXml->setAttribute("file", entry.file);
+		fileXml->setAttribute("size", juce::String{ entry.fingerprint.size });
+		fileXml->setAttribute("time", juce::String{ entry.fingerprint.modifiedTime });
+		fileXml->setAttribute("hash", entry.fingerprint.hash);
+
+		for (auto& desc : entry.plugins) {
+			fileXml->addChildElement(desc.createXml().release());
+		}
+	}
+
+	auto file = this->getCacheFile();
+	if (!file.getParentDirectory().exists()) {
+		file.getParentDirectory().createDirectory();
+	}
+	xml.writeTo(file);
+}
@@ -13,12 +13,48 @@ public:
 
 	void start();
 
+	/** Child Process Mode: --scan <format> <fileOrIdentifier> <outputFile> */
+	static constexpr auto scanArg = "--scan";
+	/**
+	 * @brief	Scan a single plugin file and write its descriptions to the output file.
+	 *			Runs in a child process, so a crashing or hanging plugin only takes down this process.
+	 */
+	static int scanOne(const juce::String& formatName,
+		const juce::String& fileOrIdentifier, const juce::String& outputFilePath);
+
 private:
 	const juce::String pluginSearchPathListFilePath;
 	const juce::String pluginListTemporaryFilePath;
 	const juce::String pluginBlackListFilePath;
 	const juce::String deadPluginListPath;
 
+	struct Fingerprint final {
+		juce::int64 size = 0, modifiedTime = 0;
+		juce::String hash;
+	};
+	struct CacheEntry final {
+		juce::String format, file;
+		Fingerprint fingerprint;
+		juce::Array<juce::PluginDescription> plugins;
+	};
+	/** Format And File, Entry */
+	using Cache = std::map<juce::String, CacheEntry>;
+
+	struct ScanTask final {
+		juce::String format, file;
+		Fingerprint fingerprint;
+	};
+	/** Format, Files */
+	using DeadList = std::map<juce::String, juce::StringArray>;
+
+	static constexpr int scanTimeoutMs = 60000;
+
+	void scanInChildProcesses(const juce::Array<ScanTask>& tasks,
+		Cache& cache, DeadList& deadPlugins) const;
+
+	static const juce::String getCacheKey(const juce::String& format, const juce::String& file);
+	static const Fingerprint getFingerprint(const juce::String& fileOrIdentifier, bool withHash);
+
 	const juce::File getSearchPathFile() const;
 	const juce::StringArray getSearchPath() const;
 	const juce::File getBlackListFile() const;
@@ -26,6 +62,9 @@ private:
 	void saveBlackList(const juce::StringArray& list) const;
 	const juce::File getTemporaryFile() const;
 	void saveTemporaryFile(const juce::XmlElement* data) const;
+	const juce::File getCacheFile() const;
+	const Cache loadCache() const;
+	void saveCache(const Cache& cache) const;
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginSearcher)
 };
@@ -14,13 +14,12 @@ public:
 	const juce::String getApplicationVersion() override {
         return juce::String{ PROJECT_VERSION_MAJOR } + "." + juce::String{ PROJECT_VERSION_MINOR } + "." + juce::String{ PROJECT_VERSION_PATCH };
     };
-	bool moreThanOneInstanceAllowed() override { return false; };
+	bool moreThanOneInstanceAllowed() override {
+        /** Scanning Child Processes Run Beside The Main Searcher */
+        return juce::JUCEApplicationBase::getCommandLineParameters().contains(PluginSearcher::scanArg);
+    };
 
     void initialise(const juce::String& commandLine) override {
-        OUT("VocalShaper Plugin Searcher v" + this->getApplicationVersion().toStdString());
-        OUT("Copyright 2023-2024 VocalSharp Org. All rights reserved.");
-        OUT("");
-
         juce::StringArray commandArray = juce::StringArray::fromTokens(commandLine, " ", "\"");
         for (auto& s : commandArray) {
             /** Remove Quote */
@@ -34,6 +33,21 @@ public:
                 commandArray.remove(0);
             }
         }
+
+        /** Child Process Scans Single File */
+        if (commandArray.size() == 4 && commandArray[0] == PluginSearcher::scanArg) {
+            juce::MessageManager::callAsync([commandArray] {
+                int result = PluginSearcher::scanOne(commandArray[1], commandArray[2], commandArray[3]);
+                juce::JUCEApplication::getInstance()->setApplicationReturnValue(result);
+                juce::JUCEApplication::quit();
+                });
+            return;
+        }
+
+        OUT("VocalShaper Plugin Searcher v" + this->getApplicationVersion().toStdString());
+        OUT("Copyright 2023-2024 VocalSharp Org. All rights reserved.");
+        OUT("");
+
         if (commandArray.size() != 4) {
             OUT("\033[31m[ERROR]\033[0m Bad Command!");
             juce::JUCEApplication::quit();
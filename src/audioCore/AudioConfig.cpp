@@ -32,6 +32,14 @@ void AudioConfig::setDeadPluginListPath(const juce::String& path) {
 	AudioConfig::getInstance()->deadPluginListPath = path;
 }
 
+const juce::String AudioConfig::getSourceCachePath() {
+	return AudioConfig::getInstance()->sourceCachePath;
+}
+
+void AudioConfig::setSourceCachePath(const juce::String& path) {
+	AudioConfig::getInstance()->sourceCachePath = path;
+}
+
 void AudioConfig::setAnonymous(bool anonymous) {
 	AudioConfig::getInstance()->anonymous = anonymous;
 }
@@ -47,6 +55,65 @@ double AudioConfig::getMidiTail() {
 	return AudioConfig::getInstance()->midiTailTime;
 }
 
+void AudioConfig::setSourceStreaming(bool streaming) {
+	AudioConfig::getInstance()->sourceStreaming = streaming;
+}
+
+bool AudioConfig::getSourceStreaming() {
+	return AudioConfig::getInstance()->sourceStreaming;
+}
+
+void AudioConfig::setResampleQuality(int quality) {
+	AudioConfig::getInstance()->resampleQuality = juce::jlimit(0, 2, quality);
+}
+
+int AudioConfig::getResampleQuality() {
+	return AudioConfig::getInstance()->resampleQuality;
+}
+
+void AudioConfig::setSourceConvertMode(int mode) {
+	AudioConfig::getInstance()->sourceConvertMode = juce::jlimit(0, 2, mode);
+}
+
+int AudioConfig::getSourceConvertMode() {
+	return AudioConfig::getInstance()->sourceConvertMode;
+}
+
+void AudioConfig::setRenderBlockSize(int size) {
+	AudioConfig::getInstance()->renderBlockSize = (size > 0) ? size : 4096;
+}
+
+int AudioConfig::getRenderBlockSize() {
+	return AudioConfig::getInstance()->renderBlockSize;
+}
+
+void AudioConfig::setRenderThreadNum(int num) {
+	AudioConfig::getInstance()->renderThreadNum = std::max(num, 0);
+}
+
+int AudioConfig::getRenderThreadNum() {
+	int num = AudioConfig::getInstance()->renderThreadNum;
+	return (num > 0) ? num : juce::SystemStats::getNumCpus();
+}
+
+void AudioConfig::setAudioThreadNum(int num) {
+	AudioConfig::getInstance()->audioThreadNum = std::max(num, 0);
+}
+
+int AudioConfig::getAudioThreadNum() {
+	int num = AudioConfig::getInstance()->audioThreadNum;
+	return (num > 0) ? num : juce::SystemStats::getNumCpus();
+}
+
+void AudioConfig::setPluginLoadThreadNum(int num) {
+	AudioConfig::getInstance()->pluginLoadThreadNum = std::max(num, 0);
+}
+
+int AudioConfig::getPluginLoadThreadNum() {
+	int num = AudioConfig::getInstance()->pluginLoadThreadNum;
+	return (num > 0) ? num : std::clamp(juce::SystemStats::getNumCpus() - 1, 1, 8);
+}
+
 AudioConfig* AudioConfig::getInstance() {
 	return AudioConfig::instance ? AudioConfig::instance : (AudioConfig::instance = new AudioConfig());
 }
@@ -15,20 +15,72 @@ public:
 	static void setPluginBlackListFilePath(const juce::String& path);
 	static void setDeadPluginListPath(const juce::String& path);
 
+	static const juce::String getSourceCachePath();
+	static void setSourceCachePath(const juce::String& path);
+
 	static void setAnonymous(bool anonymous);
 	static bool getAnonymous();
 
 	static void setMidiTail(double time);
 	static double getMidiTail();
 
+	/**
+	 * @brief	Stream audio sources from disk instead of loading whole files into memory.
+	 */
+	static void setSourceStreaming(bool streaming);
+	static bool getSourceStreaming();
+
+	/**
+	 * @brief	Set the source resampling quality. 0 is linear, 1 is windowed sinc, 2 is polyphase.
+	 */
+	static void setResampleQuality(int quality);
+	static int getResampleQuality();
+
+	/**
+	 * @brief	Set how sources with a different sample rate are converted in background.
+	 *			0 is disabled, 1 keeps results in memory, 2 keeps results in sidecar files.
+	 */
+	static void setSourceConvertMode(int mode);
+	static int getSourceConvertMode();
+
+	static void setRenderBlockSize(int size);
+	static int getRenderBlockSize();
+
+	/**
+	 * @brief	Set the number of threads used by offline rendering. 0 means the number of CPU cores.
+	 */
+	static void setRenderThreadNum(int num);
+	static int getRenderThreadNum();
+
+	/**
+	 * @brief	Set the number of threads processing the mixer graph in real time, including the audio thread.
+	 *			0 means the number of CPU cores. 1 processes every node on the audio thread in a fixed order for debugging.
+	 */
+	static void setAudioThreadNum(int num);
+	static int getAudioThreadNum();
+
+	/**
+	 * @brief	Set the number of threads creating plugins in parallel. 0 means one less than the number of CPU cores, at most 8.
+	 */
+	static void setPluginLoadThreadNum(int num);
+	static int getPluginLoadThreadNum();
+
 private:
 	juce::String pluginSearchPathListFilePath;
 	juce::String pluginListTemporaryFilePath;
 	juce::String pluginBlackListFilePath;
 	juce::String deadPluginListPath;
+	juce::String sourceCachePath;
 
 	bool anonymous = false;
 	std::atomic<double> midiTailTime = 2;
+	std::atomic_bool sourceStreaming = false;
+	std::atomic_int resampleQuality = 2;
+	std::atomic_int sourceConvertMode = 1;
+	std::atomic_int renderBlockSize = 4096;
+	std::atomic_int renderThreadNum = 0;
+	std::atomic_int audioThreadNum = 0;
+	std::atomic_int pluginLoadThreadNum = 0;
 
 public:
 	static AudioConfig* getInstance();
@@ -9,11 +9,18 @@
 #include "misc/Renderer.h"
 #include "misc/Device.h"
 #include "misc/AudioLock.h"
+#include "misc/DSPProfiler.h"
 #include "source/SourceManager.h"
 #include "source/SourceIO.h"
+#include "source/AudioStreamCache.h"
+#include "source/SourceConvertCache.h"
+#include "source/SourcePeakCache.h"
+#include "source/SourceRecordAllocator.h"
 #include "project/ProjectInfoData.h"
+#include "project/ProjectSaveThread.h"
 #include "action/ActionDispatcher.h"
 #include "uiCallback/UICallback.h"
+#include "uiCallback/AudioEventQueue.h"
 #include "ara/ARADataIOThread.h"
 #include "Utils.h"
 #include <VSP4.h>
@@ -71,6 +78,9 @@ AudioCore::AudioCore() {
 	this->audioDeviceListener = std::make_unique<AudioDeviceChangeListener>(this);
 	Device::getInstance()->addChangeListener(this->audioDeviceListener.get());
 
+	/** DSP Profiler */
+	DSPProfiler::getInstance();
+
 	/** Init Audio Device */
 	this->initAudioDevice(AudioStartupConfig::getInstance()->getConfig());
 
@@ -95,9 +105,16 @@ AudioCore::~AudioCore() {
 	PlayPosition::releaseInstance();
 	Plugin::releaseInstance();
 	ARADataIOThread::releaseInstance();
+	ProjectSaveThread::releaseInstance();
 	SourceIO::releaseInstance();
+	SourceConvertCache::releaseInstance();
+	SourcePeakCache::releaseInstance();
+	SourceRecordAllocator::releaseInstance();
 	SourceManager::releaseInstance();
+	AudioStreamCache::releaseInstance();
 	UICallback::releaseInstance();
+	AudioEventQueue::releaseInstance();
+	DSPProfiler::releaseInstance();
 }
 
 juce::Component* AudioCore::getAudioDebugger() const {
@@ -269,28 +286,25 @@ bool AudioCore::save(const juce::String& name) {
 	config.projectDir = projDir.getFullPathName();
 	config.araDir = utils::getARADataDir(config.projectDir, config.projectFileName).getFullPathName();
 
-	/** Clear ARA Data Dir */
-	juce::File araDir(config.araDir);
-	araDir.deleteRecursively();
-
 	/** Get Project Data */
 	auto mes = this->serialize(config);
 	if (!dynamic_cast<vsp4::Project*>(mes.get())) { ProjectInfoData::getInstance()->pop(); return false; };
-	auto proj = std::unique_ptr<vsp4::Project>(dynamic_cast<vsp4::Project*>(mes.release()));
 
-	juce::MemoryBlock projData;
-	projData.setSize(proj->ByteSizeLong());
-	if (!proj->SerializeToArray(projData.getData(), projData.getSize())) { ProjectInfoData::getInstance()->pop(); return false; }
-	
-	/** Save Source File */
-	this->saveSource(proj.get());
-
-	/** Write Project File */
-	if (!utils::writeBlockToFile(projFile.getFullPathName(), projData,
-		utils::getProjectDir())) {
-		ProjectInfoData::getInstance()->pop();
-		return false;
-	}
+	/** Remove ARA Data Not Written By This Save */
+	ARADataIOThread::getInstance()->addCleanTask(config.araDir);
+
+	/** Save Changed Source File */
+	this->saveSource(mes.get());
+
+	/** Encode And Write Project File In Background */
+	ProjectSaveThread::getInstance()->addTask(projFile, std::move(mes),
+		[](const juce::File& file, bool result) {
+			if (result) { return; }
+			ProjectInfoData::getInstance()->unsave();
+			UICallbackAPI<const juce::String&, const juce::String&>::invoke(
+				UICallbackType::ErrorAlert, "Save Project",
+				"Can't write project file: " + file.getFullPathName());
+		});
 
 	/** Release Project Info Temp */
 	ProjectInfoData::getInstance()->release();
@@ -504,7 +518,7 @@ void AudioCore::initAudioDevice(const juce::XmlElement* state) {
 
 void AudioCore::updateAudioBuses() {
 	/** Lock Audio */
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getAudioLock());
 
 	/** Change Source Sample Rate */
 	SourceManager::getInstance()->sampleRateChanged(
@@ -562,6 +576,12 @@ void AudioCore::saveSource(const google::protobuf::Message* data) const {
 	/** To Avoid Repeat Save */
 	std::unordered_set<std::string> savedSet;
 
+	/** Unchanged Source Already In Project Dir */
+	auto isSaved = [](uint64_t ref, SourceManager::SourceType type, const juce::String& path) {
+		return SourceManager::getInstance()->isSaved(ref, type)
+			&& juce::File{ path }.existsAsFile();
+		};
+
 	auto& graph = ptrProj->graph();
 	auto mainGraph = this->mainAudioGraph.get();
 	for (int i = 0; i < graph.seqtracks_size(); i++) {
@@ -576,8 +596,10 @@ void AudioCore::saveSource(const google::protobuf::Message* data) const {
 
 						juce::String path = utils::getProjectDir()
 							.getChildFile(name).getFullPathName();
-						SourceIO::getInstance()->addTask(
-							{ SourceIO::TaskType::Write, ref, path, false, {} });
+						if (!isSaved(ref, SourceManager::SourceType::MIDI, path)) {
+							SourceIO::getInstance()->addTask(
+								{ SourceIO::TaskType::Write, ref, path, false, {} });
+						}
 					}
 				}
 			}
@@ -590,8 +612,10 @@ void AudioCore::saveSource(const google::protobuf::Message* data) const {
 
 						juce::String path = utils::getProjectDir()
 							.getChildFile(name).getFullPathName();
-						SourceIO::getInstance()->addTask(
-							{ SourceIO::TaskType::Write, ref, path, false, {} });
+						if (!isSaved(ref, SourceManager::SourceType::Audio, path)) {
+							SourceIO::getInstance()->addTask(
+								{ SourceIO::TaskType::Write, ref, path, false, {} });
+						}
 					}
 				}
 			}
@@ -603,18 +627,31 @@ void AudioCore::loadSource(const google::protobuf::Message* data) const {
 	auto ptrProj = dynamic_cast<const vsp4::Project*>(data);
 	if (!ptrProj) { return; }
 
+	/** Load Sources Near Playhead First */
+	double playTime = PlayPosition::getInstance()->getPosition()->getTimeInSeconds().orFallback(0);
+	auto getDistance = [playTime](const SeqSourceProcessor* track) {
+		double distance = std::numeric_limits<double>::max();
+		for (int i = 0; i < track->getSeqNum(); i++) {
+			auto [startTime, endTime, offset] = track->getSeq(i);
+			if (endTime <= playTime) { continue; }
+			distance = std::min(distance, std::max(startTime - playTime, 0.0));
+		}
+		return distance;
+		};
+
 	auto& graph = ptrProj->graph();
 	auto mainGraph = this->mainAudioGraph.get();
 	for (int i = 0; i < graph.seqtracks_size(); i++) {
 		if (auto track = mainGraph->getSourceProcessor(i)) {
 			auto& seqData = graph.seqtracks(i);
+			double distance = getDistance(track);
 
 			if (!seqData.midisrc().empty()) {
 				if (auto ref = track->getMIDIRef()) {
 					juce::String path = utils::getProjectDir()
 						.getChildFile(seqData.midisrc()).getFullPathName();
 					SourceIO::getInstance()->addTask(
-						{ SourceIO::TaskType::Read, ref, path, false, {} });
+						{ SourceIO::TaskType::Read, ref, path, false, {} }, distance);
 				}
 			}
 
@@ -623,7 +660,7 @@ void AudioCore::loadSource(const google::protobuf::Message* data) const {
 					juce::String path = utils::getProjectDir()
 						.getChildFile(seqData.audiosrc()).getFullPathName();
 					SourceIO::getInstance()->addTask(
-						{ SourceIO::TaskType::Read, ref, path, false, {} });
+						{ SourceIO::TaskType::Read, ref, path, false, {} }, distance);
 				}
 			}
 		}
@@ -1071,15 +1071,19 @@ namespace utils {
 		const juce::String& path, const juce::MemoryBlock& block, const juce::File& base) {
 		juce::File file = base.getChildFile(path);
 
-		juce::FileOutputStream stream(file);
-		if (!stream.openedOk()) { return false; }
-		stream.setPosition(0);
-		stream.truncate();
+		/** Write Beside Target And Rename, Old File Is Kept If Writing Failed */
+		juce::TemporaryFile temp(file);
+		{
+			juce::FileOutputStream stream(temp.getFile());
+			if (!stream.openedOk()) { return false; }
 
-		if (!stream.write(block.getData(), block.getSize())) {
-			return false;
+			if (!stream.write(block.getData(), block.getSize())) {
+				return false;
+			}
+			stream.flush();
+			if (stream.getStatus().failed()) { return false; }
 		}
-		return true;
+		return temp.overwriteTargetFileWithTemporary();
 	}
 
 	bool regardVel0NoteAsNoteOff() { return true; }
@@ -2,6 +2,11 @@
 
 #include "../AudioCore.h"
 #include "../misc/Device.h"
+#include "../source/AudioStreamCache.h"
+#include "../misc/VMath.h"
+#include "../misc/DSPProfiler.h"
+#include "../misc/Renderer.h"
+#include "../plugin/PluginLoader.h"
 #include "../Utils.h"
 
 ActionEchoDeviceAudio::ActionEchoDeviceAudio() {}
@@ -20,6 +25,11 @@ bool ActionEchoDeviceAudio::doAction() {
 	result += "Buffer Size: " + juce::String(currentDevice->getCurrentBufferSizeSamples()) + "\n";
 	result += "Bit Depth: " + juce::String(currentDevice->getCurrentBitDepth()) + "\n";
 	result += "Device Type: " + currentType + "\n";
+	result += "Muted Blocks: " + juce::String(AudioCore::getInstance()->getGraph()->getMutedBlockNum()) + "\n";
+	result += "Stream Cache: " + juce::String(AudioStreamCache::getInstance()->getHitNum()) + " hits, "
+		+ juce::String(AudioStreamCache::getInstance()->getMissNum()) + " misses, "
+		+ juce::String(AudioStreamCache::getInstance()->getMemoryUsage() / 1024 / 1024) + " MB\n";
+	result += "Dropped UI Events: " + juce::String(AudioCore::getInstance()->getGraph()->getAudioEventOverflowNum()) + "\n";
 	result += "========================================================================\n";
 	result += "Input Device: " + setup.inputDeviceName + "\n";
 	result += "Input Latency: " + juce::String(currentDevice->getInputLatencyInSamples()) + "\n";
@@ -281,6 +291,183 @@ bool ActionEchoMixerTrackSlider::doAction() {
 	return false;
 }
 
+ActionEchoMixKernelCost::ActionEchoMixKernelCost(
+	int channels, int blockSize)
+	: channels(channels), blockSize(blockSize) {}
+
+bool ActionEchoMixKernelCost::doAction() {
+	if (this->channels <= 0 || this->blockSize <= 0) { return false; }
+
+	juce::String result;
+
+	/** About 1M Samples Per Channel */
+	int blockNum = std::max(64, (1 << 20) / this->blockSize);
+
+	result += "========================================================================\n";
+	result += "Mix Kernel Cost Per Track (" + juce::String(this->channels) + " channels, "
+		+ juce::String(this->blockSize) + " samples, " + juce::String(blockNum) + " blocks)\n";
+	result += "========================================================================\n";
+	auto typeNames = vMath::getAllInsTypeName();
+	for (int i = 0; i < vMath::InsType::MaxNum; i++) {
+		double seconds = vMath::benchmarkGainAndLevel(
+			(vMath::InsType)i, this->channels, this->blockSize, blockNum);
+		if (seconds <= 0) {
+			result += typeNames[i] + ": Unsupported\n";
+			continue;
+		}
+
+		result += typeNames[i] + ": " + juce::String(seconds * 1000000, 3) + " us per block, "
+			+ juce::String(seconds * 1000000000 / this->blockSize, 3) + " ns per sample\n";
+	}
+	result += "Current: " + vMath::getInsTypeName() + "\n";
+	result += "========================================================================\n";
+
+	this->output(result);
+	return true;
+}
+
+bool ActionEchoSIMDCheck::doAction() {
+	juce::String result;
+
+	result += "========================================================================\n";
+	result += "SIMD Kernel Check\n";
+	result += "========================================================================\n";
+	auto typeNames = vMath::getAllInsTypeName();
+	for (int i = vMath::InsType::Normal + 1; i < vMath::InsType::MaxNum; i++) {
+		if (!vMath::isInsTypeSupported((vMath::InsType)i)) {
+			result += typeNames[i] + ": Unsupported\n";
+			continue;
+		}
+
+		auto failed = vMath::checkKernels((vMath::InsType)i);
+		result += typeNames[i] + ": " + (failed.isEmpty() ? "OK" : ("Failed (" + failed.joinIntoString(", ") + ")")) + "\n";
+	}
+	result += "Current: " + vMath::getInsTypeName() + "\n";
+	result += "Best: " + typeNames[vMath::getBestInsType()] + "\n";
+	result += "========================================================================\n";
+
+	this->output(result);
+	return true;
+}
+
+bool ActionEchoDSPLoad::doAction() {
+	auto profiler = DSPProfiler::getInstanceWithoutCreate();
+	auto graph = AudioCore::getInstance()->getGraph();
+	if (!profiler || !graph) { return false; }
+
+	auto loadToString = [](const DSPProfiler::Load& load) {
+		return "avg " + juce::String(load.average * 1000000, 1) + "us"
+			+ ", p99 " + juce::String(load.p99 * 1000000, 1) + "us"
+			+ ", worst " + juce::String(load.worst * 1000000, 1) + "us"
+			+ " (" + juce::String(load.averageShare * 100, 2) + "%"
+			+ ", " + juce::String(load.p99Share * 100, 2) + "%"
+			+ ", " + juce::String(load.worstShare * 100, 2) + "%)"
+			+ ", xrun " + juce::String(load.xrunNum);
+	};
+
+	juce::String result;
+
+	result += "========================================================================\n";
+	result += "DSP Load\n";
+	result += "========================================================================\n";
+	result += "Audio Callback: " + loadToString(profiler->getCallbackLoad()) + "\n";
+	auto [threadNum, taskNum, depth] = graph->getParallelEngineInfo();
+	result += "Parallel Schedule: " + juce::String(threadNum) + " threads, "
+		+ juce::String(taskNum) + " tasks, depth " + juce::String(depth) + "\n";
+
+	result += "------------------------------------------------------------------------\n";
+	int seqNum = graph->getSourceNum();
+	for (int i = 0; i < seqNum; i++) {
+		if (auto track = graph->getSourceProcessor(i)) {
+			result += "Seq [" + juce::String(i) + "]: " + loadToString(track->getDSPLoad()) + "\n";
+			if (auto instr = track->getInstrProcessor()) {
+				result += "\tInstr " + instr->getName() + ": " + loadToString(instr->getDSPLoad()) + "\n";
+			}
+		}
+	}
+
+	result += "------------------------------------------------------------------------\n";
+	int trackNum = graph->getTrackNum();
+	for (int i = 0; i < trackNum; i++) {
+		if (auto track = graph->getTrackProcessor(i)) {
+			result += "Mixer [" + juce::String(i) + "]: " + loadToString(track->getDSPLoad()) + "\n";
+			if (auto pluginDock = track->getPluginDock()) {
+				int pluginNum = pluginDock->getPluginNum();
+				for (int j = 0; j < pluginNum; j++) {
+					if (auto plugin = pluginDock->getPluginProcessor(j)) {
+						result += "\tEffect [" + juce::String(j) + "] " + plugin->getName() + ": " + loadToString(plugin->getDSPLoad()) + "\n";
+					}
+				}
+			}
+		}
+	}
+
+	result += "========================================================================\n";
+
+	this->output(result);
+	return true;
+}
+
+bool ActionEchoRenderStats::doAction() {
+	auto stats = Renderer::getInstance()->getLastStats();
+	if (stats.id == 0) {
+		this->error("No finished render yet.\n");
+		return false;
+	}
+
+	juce::String result;
+
+	result += "========================================================================\n";
+	result += "Render Stats\n";
+	result += "========================================================================\n";
+	result += "Length: " + juce::String(stats.length, 3) + "s, Time: " + juce::String(stats.seconds, 3) + "s"
+		+ ", Realtime Factor: " + juce::String(stats.getRealtimeFactor(), 2) + "x\n";
+	result += "Blocks: " + juce::String(stats.blockNum) + " x " + juce::String(stats.blockSize)
+		+ " samples at " + juce::String(stats.sampleRate) + "Hz, " + juce::String(stats.threadNum) + " threads\n";
+	result += "Block Time: avg " + juce::String(stats.averageBlock * 1000000, 1) + "us"
+		+ ", p99 " + juce::String(stats.p99Block * 1000000, 1) + "us"
+		+ ", worst " + juce::String(stats.worstBlock * 1000000, 1) + "us\n";
+
+	result += "------------------------------------------------------------------------\n";
+	for (int i = 0; i < Renderer::Stats::histogramSize; i++) {
+		if (stats.histogram[i] == 0) { continue; }
+		result += "[" + juce::String(1 << i) + "us, " + juce::String(1 << (i + 1)) + "us): "
+			+ juce::String(stats.histogram[i]) + "\n";
+	}
+
+	result += "========================================================================\n";
+
+	this->output(result);
+	return true;
+}
+
+bool ActionEchoPluginLoadStats::doAction() {
+	auto stats = PluginLoader::getInstance()->getLastStats();
+	if (stats.id == 0) {
+		this->error("No finished plugin load yet.\n");
+		return false;
+	}
+
+	juce::String result;
+
+	result += "========================================================================\n";
+	result += "Plugin Load Stats\n";
+	result += "========================================================================\n";
+	result += "Plugins: " + juce::String(stats.plugins.size()) + ", Time: " + juce::String(stats.seconds, 3) + "s"
+		+ ", " + juce::String(stats.threadNum) + " threads\n";
+
+	result += "------------------------------------------------------------------------\n";
+	for (auto& [name, format, seconds, loaded] : stats.plugins) {
+		result += "[" + format + "] " + name + ": " + juce::String(seconds * 1000, 1) + "ms"
+			+ (loaded ? "" : " (failed)") + "\n";
+	}
+
+	result += "========================================================================\n";
+
+	this->output(result);
+	return true;
+}
+
 ActionEchoInstrParamValue::ActionEchoInstrParamValue(
 	int instr, int param)
 	: instr(instr), param(param) {}
@@ -118,6 +118,75 @@ private:
 	JUCE_LEAK_DETECTOR(ActionEchoMixerTrackSlider)
 };
 
+class ActionEchoMixKernelCost final : public ActionBase {
+public:
+	ActionEchoMixKernelCost() = delete;
+	ActionEchoMixKernelCost(
+		int channels, int blockSize);
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Echo Mix Kernel Cost";
+	};
+
+private:
+	const int channels, blockSize;
+
+	JUCE_LEAK_DETECTOR(ActionEchoMixKernelCost)
+};
+
+class ActionEchoSIMDCheck final : public ActionBase {
+public:
+	ActionEchoSIMDCheck() = default;
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Echo SIMD Check";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionEchoSIMDCheck)
+};
+
+class ActionEchoDSPLoad final : public ActionBase {
+public:
+	ActionEchoDSPLoad() = default;
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Echo DSP Load";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionEchoDSPLoad)
+};
+
+class ActionEchoRenderStats final : public ActionBase {
+public:
+	ActionEchoRenderStats() = default;
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Echo Render Stats";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionEchoRenderStats)
+};
+
+class ActionEchoPluginLoadStats final : public ActionBase {
+public:
+	ActionEchoPluginLoadStats() = default;
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Echo Plugin Load Stats";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionEchoPluginLoadStats)
+};
+
 class ActionEchoInstrParamValue final : public ActionBase {
 public:
 	ActionEchoInstrParamValue() = delete;
@@ -3,6 +3,7 @@
 
 #include "../AudioCore.h"
 #include "../misc/PlayPosition.h"
+#include "../misc/DSPProfiler.h"
 #include "../plugin/Plugin.h"
 #include "../source/SourceManager.h"
 #include "../recovery/DataControl.hpp"
@@ -113,6 +114,18 @@ bool ActionStopRecord::doAction() {
 	return true;
 }
 
+ActionResetDSPLoad::ActionResetDSPLoad() {};
+
+bool ActionResetDSPLoad::doAction() {
+	if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+		profiler->reset();
+
+		this->output("Reset DSP load\n");
+		return true;
+	}
+	return false;
+}
+
 ActionRenderNow::ActionRenderNow(
 	const juce::String& path, const juce::String& name,
 	const juce::String& extension, const juce::Array<int>& tracks,
@@ -108,6 +108,19 @@ private:
 	JUCE_LEAK_DETECTOR(ActionStopRecord)
 };
 
+class ActionResetDSPLoad final : public ActionBase {
+public:
+	ActionResetDSPLoad();
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Reset DSP Load";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionResetDSPLoad)
+};
+
 class ActionRenderNow final : public ActionBase {
 public:
 	ActionRenderNow() = delete;
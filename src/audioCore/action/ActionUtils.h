@@ -7,6 +7,7 @@
 #include "../plugin/Plugin.h"
 #include "../plugin/PluginLoader.h"
 #include "../project/ProjectInfoData.h"
+#include "../project/ProjectSaveThread.h"
 #include "../recovery/DataWrite.hpp"
 #include "../recovery/ActionType.hpp"
 #include "../ara/ARAGlobalState.h"
@@ -21,7 +22,8 @@
 
 #define ACTION_CHECK_SOURCE_IO_RUNNING(s) \
 	do { \
-		if(SourceIO::getInstance()->isThreadRunning()) { \
+		if(SourceIO::getInstance()->isRunning() \
+			|| ProjectSaveThread::getInstance()->isThreadRunning()) { \
 			this->error(s); \
 			return false; \
 		} \
@@ -1,6 +1,7 @@
 ﻿#include "ARAController.h"
 #include "ARAGlobalState.h"
 #include "../AudioCore.h"
+#include "../misc/VMath.h"
 
 ARA::ARAAudioReaderHostRef ARAAudioAccessController::createAudioReaderForSource(
 	ARA::ARAAudioSourceHostRef audioSourceHostRef,
@@ -8,6 +9,7 @@ ARA::ARAAudioReaderHostRef ARAAudioAccessController::createAudioReaderForSource(
 	auto audioReader = std::make_unique<AudioReader>(audioSourceHostRef, use64BitSamples);
 	auto audioReaderHostRef = Converter::toHostRef(audioReader.get());
 
+	juce::GenericScopedLock locker(this->readerListLock);
 	this->audioReaders.emplace(audioReader.get(), std::move(audioReader));
 
 	return audioReaderHostRef;
@@ -18,19 +20,32 @@ bool ARAAudioAccessController::readAudioSamples(
 	ARA::ARASamplePosition samplePosition,
 	ARA::ARASampleCount samplesPerChannel,
 	void* const buffers[]) noexcept {
-	const bool use64BitSamples = Converter::fromHostRef(audioReaderHostRef)->use64Bit;
-	auto* audioSource = SourceConverter::fromHostRef(Converter::fromHostRef(audioReaderHostRef)->sourceHostRef);
+	/** Hosts Never Use One Reader On Several Threads At The Same Time */
+	auto* audioReader = Converter::fromHostRef(audioReaderHostRef);
+	auto* audioSource = SourceConverter::fromHostRef(audioReader->sourceHostRef);
 	
-	if (!use64BitSamples) {
-		return audioSource->readAudioSamples(
+	if (!audioReader->use64Bit) {
+		return audioSource->readAudioSamples(audioReader->voice,
 			reinterpret_cast<float* const*>(buffers), samplePosition, samplesPerChannel);
 	}
 
-	return false;
+	/** Read Float Samples And Convert */
+	int channels = audioSource->getChannelNum();
+	audioReader->floatTemp.setSize(channels, (int)samplesPerChannel, false, false, true);
+	if (!audioSource->readAudioSamples(audioReader->voice,
+		audioReader->floatTemp.getArrayOfWritePointers(), samplePosition, samplesPerChannel)) {
+		return false;
+	}
+	for (int i = 0; i < channels; i++) {
+		vMath::floatToDoubleData(reinterpret_cast<double*>(buffers[i]),
+			audioReader->floatTemp.getReadPointer(i), (int)samplesPerChannel);
+	}
+	return true;
 }
 
 void ARAAudioAccessController::destroyAudioReader(
 	ARA::ARAAudioReaderHostRef audioReaderHostRef) noexcept {
+	juce::GenericScopedLock locker(this->readerListLock);
 	this->audioReaders.erase(Converter::fromHostRef(audioReaderHostRef));
 }
 
@@ -21,18 +21,24 @@ private:
 		ARA::ARAAudioReaderHostRef audioReaderHostRef) noexcept override;
 
 private:
+	/** Each reader has its own voice and file reader, so readers never wait for playback or each other */
 	struct AudioReader {
 		AudioReader(ARA::ARAAudioSourceHostRef source, bool use64BitSamples)
-			: sourceHostRef(source), use64Bit(use64BitSamples) {}
+			: sourceHostRef(source), use64Bit(use64BitSamples) {
+			this->voice.setOwnStreamReader(true);
+		}
 
 		ARA::ARAAudioSourceHostRef sourceHostRef;
 		bool use64Bit;
+		SourceResampler voice;
+		juce::AudioBuffer<float> floatTemp;
 	};
 
 	using Converter = juce::ARAHostModel::ConversionFunctions<AudioReader*, ARA::ARAAudioReaderHostRef>;
 	using SourceConverter = juce::ARAHostModel::ConversionFunctions<ARAVirtualAudioSource*, ARA::ARAAudioSourceHostRef>;
 
 	std::map<AudioReader*, std::unique_ptr<AudioReader>> audioReaders;
+	juce::CriticalSection readerListLock;
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ARAAudioAccessController)
 };
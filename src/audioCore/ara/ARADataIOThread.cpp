@@ -28,7 +28,20 @@ void ARADataIOThread::addTask(
 		juce::GenericScopedLock locker(this->lock);
 
 		/** Push To Task List */
-		this->list.push(std::make_tuple(path, document, isWrite, data));
+		this->list.push(std::make_tuple(path, document,
+			isWrite ? TaskType::Write : TaskType::Read, data));
+	}
+
+	this->startThread();
+}
+
+void ARADataIOThread::addCleanTask(const juce::String& dir) {
+	{
+		/** Lock */
+		juce::GenericScopedLock locker(this->lock);
+
+		/** Push To Task List */
+		this->list.push(std::make_tuple(dir, DstPointer{}, TaskType::Clean, juce::MemoryBlock{}));
 	}
 
 	this->startThread();
@@ -50,15 +63,21 @@ void ARADataIOThread::run() {
 		}
 
 		/** Prepare ARA Internal Data IO */
-		auto& [path, document, isWrite, data] = task;
+		auto& [path, document, type, data] = task;
 
 		/** Write Data */
-		if (isWrite) {
-			ARADataIOThread::writeToFile(data, path);
+		if (type == TaskType::Write) {
+			this->writeIfChanged(data, path);
+		}
+		/** Remove Old Data */
+		else if (type == TaskType::Clean) {
+			this->removeUnsaved(path);
 		}
 		/** Read Data */
 		else {
-			ARADataIOThread::readFromFile(data, path);
+			if (ARADataIOThread::readFromFile(data, path)) {
+				this->hashList[utils::getProjectDir().getChildFile(path).getFullPathName()] = juce::MD5{ data };
+			}
 
 			juce::MessageManager::callAsync([document, block = data] {
 				if (document) {
@@ -69,17 +88,43 @@ void ARADataIOThread::run() {
 	}
 }
 
-bool ARADataIOThread::writeToFile(const juce::MemoryBlock& data, const juce::String& path) {
+bool ARADataIOThread::writeIfChanged(const juce::MemoryBlock& data, const juce::String& path) {
 	juce::File file = utils::getProjectDir().getChildFile(path);
-	file.getParentDirectory().createDirectory();
+	auto filePath = file.getFullPathName();
+	this->savedPaths.insert(filePath);
+
+	/** Skip Unchanged Data */
+	juce::MD5 hash{ data };
+	auto it = this->hashList.find(filePath);
+	if (it != this->hashList.end() && it->second == hash && file.existsAsFile()) {
+		return true;
+	}
 
-	juce::FileOutputStream stream(file);
-	if (!stream.openedOk()) { return false; }
+	/** Write Data */
+	if (!ARADataIOThread::writeToFile(data, path)) { return false; }
+	this->hashList[filePath] = hash;
+	return true;
+}
+
+void ARADataIOThread::removeUnsaved(const juce::String& dir) {
+	juce::File dirFile = utils::getProjectDir().getChildFile(dir);
+	if (dirFile.isDirectory()) {
+		for (auto& i : dirFile.findChildFiles(juce::File::findFiles, false)) {
+			if (!this->savedPaths.contains(i.getFullPathName())) {
+				i.deleteFile();
+				this->hashList.erase(i.getFullPathName());
+			}
+		}
+	}
+
+	this->savedPaths.clear();
+}
 
-	stream.setPosition(0);
-	stream.truncate();
+bool ARADataIOThread::writeToFile(const juce::MemoryBlock& data, const juce::String& path) {
+	juce::File file = utils::getProjectDir().getChildFile(path);
+	file.getParentDirectory().createDirectory();
 
-	return stream.write(data.getData(), data.getSize());
+	return utils::writeBlockToFile(file.getFullPathName(), data);
 }
 
 bool ARADataIOThread::readFromFile(juce::MemoryBlock& data, const juce::String& path) {
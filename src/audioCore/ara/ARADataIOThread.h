@@ -12,16 +12,30 @@ public:
 
 	using DstPointer = ARAVirtualDocument::SafePointer;
 	void addTask(const juce::String& path, DstPointer document, bool isWrite);
+	/**
+	 * @brief	Remove files in the dir which are not written since the last clean.
+	 */
+	void addCleanTask(const juce::String& dir);
 
 protected:
 	void run() override;
 
 private:
-	/** Path, Document Pointer, Is Write */
-	using ARADataIOTask = std::tuple<juce::String, DstPointer, bool, juce::MemoryBlock>;
+	enum class TaskType {
+		Read, Write, Clean
+	};
+	/** Path, Document Pointer, Type */
+	using ARADataIOTask = std::tuple<juce::String, DstPointer, TaskType, juce::MemoryBlock>;
 	std::queue<ARADataIOTask> list;
 	juce::CriticalSection lock;
 
+	/** Only used by the IO thread */
+	std::map<juce::String, juce::MD5> hashList;
+	std::set<juce::String> savedPaths;
+
+	bool writeIfChanged(const juce::MemoryBlock& data, const juce::String& path);
+	void removeUnsaved(const juce::String& dir);
+
 	static bool writeToFile(const juce::MemoryBlock& data, const juce::String& path);
 	static bool readFromFile(juce::MemoryBlock& data, const juce::String& path);
 
@@ -10,43 +10,22 @@ class GlobalMidiEventHelper {
 		return PlayPosition::getInstance();
 	}
 
+	/** Plugins Call These While Rendering On Audio Workers, So Never Lock */
+	using TempoSyncAccess = AudioSnapshot<MovablePlayHead::TempoSyncState>::ScopedRealtimeAccess;
+
 public:
 	static int32_t getTempoCount() {
 		if (auto ph = GlobalMidiEventHelper::getPlayHead()) {
-			juce::ScopedReadLock locker(audioLock::getPositionLock());
-
-			/** At Least 2 Tempo Sync Points */
-			if (ph->getTempoTypeLabelNum() < 1) {
-				return 2;
-			}
-
-			return ph->getTempoTypeLabelNum() + 1;/**< Last Tempo Sync Point */
+			TempoSyncAccess state(ph->getTempoSyncState());
+			return (int32_t)state->tempos.size();
 		}
 		return 0;
 	}
 	static ARA::ARAContentTempoEntry getTempoEvent(int32_t index) {
 		if (auto ph = GlobalMidiEventHelper::getPlayHead()) {
-			juce::ScopedReadLock locker(audioLock::getPositionLock());
-			if (index < ph->getTempoTypeLabelNum()) {
-				int labelIndex = ph->getTempoTypeLabelIndex(index);
-				if (labelIndex > -1) {
-					double timeSec = ph->getTempoLabelTime(labelIndex);
-					double timeQuarter = ph->toQuarter(timeSec);
-					return { timeSec, timeQuarter };
-				}
-			}
-			else if (index == 0) {
-				return { 0, 0 };
-			}
-			else {
-				/** Last Tempo Sync Point */
-				double timeSec = 0;
-				if (int num = ph->getTempoLabelNum()) {
-					timeSec = ph->getTempoLabelTime(num - 1);
-				}
-				timeSec += 1;
-
-				double timeQuarter = ph->toQuarter(timeSec);
+			TempoSyncAccess state(ph->getTempoSyncState());
+			if (index >= 0 && index < (int32_t)state->tempos.size()) {
+				auto [timeSec, timeQuarter] = state->tempos[index];
 				return { timeSec, timeQuarter };
 			}
 		}
@@ -54,18 +33,17 @@ public:
 	}
 	static int32_t getBarCount() {
 		if (auto ph = GlobalMidiEventHelper::getPlayHead()) {
-			juce::ScopedReadLock locker(audioLock::getPositionLock());
-			return std::max(ph->getBeatTypeLabelNum(), 1);
+			TempoSyncAccess state(ph->getTempoSyncState());
+			return (int32_t)state->bars.size();
 		}
 		return 0;
 	}
 	static ARA::ARAContentBarSignature getBarEvent(int32_t index) {
 		if (auto ph = GlobalMidiEventHelper::getPlayHead()) {
-			juce::ScopedReadLock locker(audioLock::getPositionLock());
-			int labelIndex = ph->getBeatTypeLabelIndex(index);
-			if (labelIndex > -1) {
-				auto beat = ph->getTempoLabelBeat(labelIndex);
-				return { std::get<0>(beat), std::get<1>(beat), ph->getTempoLabelTime(index) };
+			TempoSyncAccess state(ph->getTempoSyncState());
+			if (index >= 0 && index < (int32_t)state->bars.size()) {
+				auto [numerator, denominator, timeQuarter] = state->bars[index];
+				return { numerator, denominator, timeQuarter };
 			}
 		}
 		return { 4, 4, 0 };
@@ -102,14 +80,15 @@ void ARAVirtualAudioSource::update() {
 	this->audioSource.enableAudioSourceSamplesAccess(true);
 }
 
-bool ARAVirtualAudioSource::readAudioSamples(
+bool ARAVirtualAudioSource::readAudioSamples(SourceResampler& voice,
 	float* const* buffers, int64_t startSample, int64_t numSamples) const {
 	if (this->seq) {
-		if (auto ref = seq->getAudioRef()) {
+		/** The Container Stays Alive While Reading, Even If The Source Is Replaced */
+		if (auto data = SourceManager::getInstance()->getAudioContainer(seq->getAudioRef())) {
+			int channels = seq->getAudioChannelSet().size();
 			juce::AudioSampleBuffer bufferTemp(
-				buffers, seq->getAudioChannelSet().size(), (int)0, (int)numSamples);
-			SourceManager::getInstance()->readAudioData(
-				ref, bufferTemp, 0, startSample, numSamples);
+				buffers, channels, (int)0, (int)numSamples);
+			voice.readDirect(*data, bufferTemp, 0, startSample, (int)numSamples);
 			return true;
 		}
 	}
@@ -123,6 +102,13 @@ double ARAVirtualAudioSource::getLength() const {
 	return 0;
 }
 
+int ARAVirtualAudioSource::getChannelNum() const {
+	if (this->seq) {
+		return this->seq->getAudioChannelSet().size();
+	}
+	return 0;
+}
+
 juce::ARAHostModel::AudioSource& ARAVirtualAudioSource::getProperties() {
 	return this->audioSource;
 }
@@ -142,7 +128,7 @@ ARAVirtualAudioSource::createProperties(SeqSourceProcessor* seq) {
 		if (properties.sampleRate <= 0) {
 			properties.sampleRate = seq->getSampleRate();
 		}
-		properties.sampleCount = std::max((uint64_t)(
+		properties.sampleCount = std::max((uint64_t)std::llround(
 			(seq->isSourceInfoValid() ? seq->getAudioLengthTemped() : seq->getAudioLength())
 			* properties.sampleRate), (uint64_t)2);/**< At Least 2 Samples In Audio Source */
 		properties.channelCount = seq->getAudioChannelSet().size();
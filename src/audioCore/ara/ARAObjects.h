@@ -2,6 +2,7 @@
 
 #include <JuceHeader.h>
 #include <ARASharedObject.h>
+#include "../source/SourceResampler.h"
 
 class SeqSourceProcessor;
 
@@ -13,9 +14,14 @@ public:
 		SeqSourceProcessor* seq);
 
 	void update();
-	bool readAudioSamples(
+	/**
+	 * @brief	Read at the source sample rate with the voice of an ARA audio reader.
+	 *			Readers may run in parallel on plugin threads.
+	 */
+	bool readAudioSamples(SourceResampler& voice,
 		float* const* buffers, int64_t startSample, int64_t numSamples) const;
 	double getLength() const;
+	int getChannelNum() const;
 
 	juce::ARAHostModel::AudioSource& getProperties();
 
@@ -52,6 +52,37 @@ AUDIOCORE_FUNC(echoMixerTrackSlider) {
 	return CommandFuncResult{ true, "" };
 }
 
+AUDIOCORE_FUNC(echoMixKernelCost) {
+	auto action = std::unique_ptr<ActionBase>(new ActionEchoMixKernelCost{
+		(int)luaL_checkinteger(L, 1), (int)luaL_checkinteger(L, 2) });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(echoSIMDCheck) {
+	auto action = std::unique_ptr<ActionBase>(new ActionEchoSIMDCheck);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(echoDSPLoad) {
+	auto action = std::unique_ptr<ActionBase>(new ActionEchoDSPLoad);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(echoRenderStats) {
+	auto action = std::unique_ptr<ActionBase>(new ActionEchoRenderStats);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(echoPluginLoadStats) {
+	auto action = std::unique_ptr<ActionBase>(new ActionEchoPluginLoadStats);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
 AUDIOCORE_FUNC(echoInstrParamValue) {
 	auto action = std::unique_ptr<ActionBase>(new ActionEchoInstrParamValue{
 		(int)luaL_checkinteger(L, 1), (int)luaL_checkinteger(L, 2) });
@@ -121,6 +152,11 @@ void regCommandEcho(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoMixerTrackGain);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoMixerTrackPan);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoMixerTrackSlider);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoMixKernelCost);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoSIMDCheck);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoDSPLoad);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoRenderStats);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoPluginLoadStats);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoInstrParamValue);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoInstrParamDefaultValue);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoEffectParamValue);
@@ -48,6 +48,12 @@ AUDIOCORE_FUNC(stopRecord) {
 	return CommandFuncResult{ true, "" };
 }
 
+AUDIOCORE_FUNC(resetDSPLoad) {
+	auto action = std::unique_ptr<ActionBase>(new ActionResetDSPLoad);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
 AUDIOCORE_FUNC(renderNow) {
 	juce::String result;
 
@@ -160,6 +166,7 @@ void regCommandOther(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, rewind);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, startRecord);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, stopRecord);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, resetDSPLoad);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, renderNow);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, newProject);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, save);
@@ -4,6 +4,9 @@
 #include "../misc/Renderer.h"
 #include "../misc/AudioLock.h"
 #include "../misc/VMath.h"
+#include "../misc/DSPProfiler.h"
+#include "../misc/RenderEngine.h"
+#include "../AudioConfig.h"
 #include "../uiCallback/UICallback.h"
 #include "../AudioCore.h"
 #include "../Utils.h"
@@ -31,10 +34,31 @@ MainGraph::MainGraph() {
 
 	/** The Source Recorder Node */
 	this->recorder = std::make_unique<SourceRecordProcessor>(this);
+
+	/** Audio Thread Events */
+	this->eventListenerID = AudioEventQueue::getInstance()->addListener(
+		[ptr = MainGraph::SafePointer{ this }](const AudioEvent& event) {
+			if (ptr) {
+				ptr->handleAudioEvent(event);
+			}
+		});
+
+	/** Rebuild Parallel Schedule When Topology Changed */
+	this->addChangeListener(this);
 }
 
 MainGraph::~MainGraph() {
+	this->removeChangeListener(this);
+	if (auto queue = AudioEventQueue::getInstanceWithoutCreate()) {
+		queue->removeListener(this->eventListenerID);
+	}
+
 	this->clearGraph();
+
+	/** Release Nodes Kept By The Schedule */
+	this->audioState.update([](AudioState& state) {
+		state.parallelEngine = nullptr;
+		});
 }
 
 void MainGraph::setAudioLayout(int inputChannelNum, int outputChannelNum) {
@@ -63,27 +87,32 @@ void MainGraph::setAudioLayout(int inputChannelNum, int outputChannelNum) {
 	/** Set Layout of Recorder */
 	this->getRecorder()->setBusesLayout(inputLayout);
 
-	/** Set Level Size */
-	{
-		juce::ScopedWriteLock locker(audioLock::getLevelMeterLock());
-		this->outputLevels.resize(outputChannelNum);
-	}
+	/** Set Level Meter */
+	this->audioState.update([outputChannelNum](AudioState& state) {
+		state.outputMeter = std::make_shared<LevelMeter>(outputChannelNum, true);
+		});
+
+	/** Parallel Schedule */
+	this->updateParallelEngine();
 }
 
 void MainGraph::setMIDIMessageHook(
 	const std::function<void(const juce::MidiMessage&, bool)> hook) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-	this->midiHook = hook;
+	this->audioState.update([&hook](AudioState& state) {
+		state.midiHook = hook;
+		});
 }
 
 void MainGraph::setMIDICCListener(const MIDICCListener& listener) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-	this->ccListener = listener;
+	this->audioState.update([&listener](AudioState& state) {
+		state.ccListener = listener;
+		});
 }
 
 void MainGraph::clearMIDICCListener() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-	this->ccListener = MIDICCListener{};
+	this->audioState.update([](AudioState& state) {
+		state.ccListener = MIDICCListener{};
+		});
 }
 
 void MainGraph::prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBlock) {
@@ -103,6 +132,9 @@ void MainGraph::prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBl
 	/** Current Graph */
 	this->juce::AudioProcessorGraph::prepareToPlay(
 		sampleRate, maximumExpectedSamplesPerBlock);
+
+	/** Parallel Schedule */
+	this->updateParallelEngine();
 }
 
 void MainGraph::setPlayHead(juce::AudioPlayHead* newPlayHead) {
@@ -141,7 +173,7 @@ void MainGraph::clearGraph() {
 	this->totalLengthTemp = 0;
 
 	/** Lock */
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	for (auto& i : this->midiSrc2TrkConnectionList) {
 		this->removeConnection(i);
@@ -194,9 +226,132 @@ void MainGraph::clearGraph() {
 	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, -1);
 }
 
-const juce::Array<float> MainGraph::getOutputLevels() const {
-	juce::ScopedReadLock locker(audioLock::getLevelMeterLock());
-	return this->outputLevels;
+std::shared_ptr<const LevelMeter> MainGraph::getOutputMeter() const {
+	return this->audioState.read([](const AudioState& state) {
+		return std::shared_ptr<const LevelMeter>{ state.outputMeter };
+		});
+}
+
+uint64_t MainGraph::getMutedBlockNum() const {
+	return this->mutedBlockNum;
+}
+
+uint64_t MainGraph::getAudioEventOverflowNum() const {
+	if (auto queue = AudioEventQueue::getInstanceWithoutCreate()) {
+		return queue->getOverflowNum();
+	}
+	return 0;
+}
+
+void MainGraph::updateParallelEngine() {
+	/** Build Schedule */
+	std::shared_ptr<RenderEngine> engine;
+	int threadNum = AudioConfig::getAudioThreadNum();
+	if (this->getBlockSize() > 0) {
+		/** Keep Worker Threads */
+		if (!this->parallelPool || this->parallelPool->getThreadNum() != threadNum) {
+			this->parallelPool = std::make_shared<ParallelTaskPool>(threadNum, "Audio Worker", true);
+		}
+
+		engine = std::make_shared<RenderEngine>(this->parallelPool);
+		engine->prepare(this, this->getBlockSize());
+	}
+
+	/** Old Schedule Is Released Off The Audio Thread */
+	this->audioState.update([&engine](AudioState& state) {
+		state.parallelEngine = engine;
+		});
+	this->parallelEngineOutdated = false;
+}
+
+const std::tuple<int, int, int> MainGraph::getParallelEngineInfo() const {
+	return this->audioState.read([](const AudioState& state) {
+		if (auto& engine = state.parallelEngine) {
+			return std::make_tuple(engine->getThreadNum(), engine->getTaskNum(), engine->getDepth());
+		}
+		return std::make_tuple(0, 0, 0);
+		});
+}
+
+void MainGraph::changeListenerCallback(juce::ChangeBroadcaster* /*source*/) {
+	this->updateParallelEngine();
+}
+
+void MainGraph::handleAudioEvent(const AudioEvent& event) {
+	switch (event.type) {
+	case AudioEventType::MIDIInput:
+	case AudioEventType::MIDIOutput: {
+		auto hook = this->audioState.read(
+			[](const AudioState& state) { return state.midiHook; });
+		if (hook) {
+			hook(event.getMessage(), event.type == AudioEventType::MIDIInput);
+		}
+		break;
+	}
+	case AudioEventType::CCLearn: {
+		auto listener = this->audioState.read(
+			[](const AudioState& state) { return state.ccListener; });
+		if (listener) {
+			listener(event.value);
+		}
+		break;
+	}
+	case AudioEventType::Transport: {
+		switch (event.value) {
+		case juce::MidiMessage::MidiMachineControlCommand::mmc_play:
+			AudioCore::getInstance()->play();
+			break;
+		case juce::MidiMessage::MidiMachineControlCommand::mmc_pause:
+			AudioCore::getInstance()->pause();
+			break;
+		case juce::MidiMessage::MidiMachineControlCommand::mmc_stop:
+			AudioCore::getInstance()->stop();
+			break;
+		case juce::MidiMessage::MidiMachineControlCommand::mmc_rewind:
+			AudioCore::getInstance()->rewind();
+			break;
+		case juce::MidiMessage::MidiMachineControlCommand::mmc_recordStart:
+			AudioCore::getInstance()->record(true);
+			break;
+		case juce::MidiMessage::MidiMachineControlCommand::mmc_recordStop:
+			AudioCore::getInstance()->record(false);
+			break;
+		default:
+			break;
+		}
+		break;
+	}
+	case AudioEventType::GraphChanged: {
+		this->updateParallelEngine();
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void MainGraph::sendPendingMIDICC() {
+	/** Instruments */
+	for (auto& node : this->audioSourceNodeList) {
+		if (auto source = dynamic_cast<SeqSourceProcessor*>(node->getProcessor())) {
+			if (auto plugin = source->getInstrProcessor()) {
+				plugin->sendPendingMIDICC();
+			}
+		}
+	}
+
+	/** Effects */
+	for (auto& node : this->trackNodeList) {
+		if (auto track = dynamic_cast<Track*>(node->getProcessor())) {
+			if (auto dock = track->getPluginDock()) {
+				for (int i = 0; i < dock->getPluginNum(); i++) {
+					if (auto plugin = dock->getPluginProcessor(i)) {
+						plugin->sendPendingMIDICC();
+					}
+				}
+			}
+		}
+	}
 }
 
 bool MainGraph::parse(
@@ -398,84 +553,76 @@ std::unique_ptr<google::protobuf::Message> MainGraph::serialize(
 }
 
 void MainGraph::processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi) {
-	/** Lock */
-	juce::ScopedWriteLock levelLocker(audioLock::getLevelMeterLock());
-	juce::ScopedTryReadLock audioLocker(audioLock::getAudioLock());
-	juce::ScopedTryWriteLock sourceLocker(audioLock::getSourceLock());
-	juce::ScopedTryReadLock pluginLocker(audioLock::getPluginLock());
-	juce::ScopedTryWriteLock positionLocker(audioLock::getPositionLock());
-	juce::ScopedTryReadLock controlLocker(audioLock::getAudioControlLock());
-	if (!(audioLocker.isLocked() && pluginLocker.isLocked() 
-		&& sourceLocker.isLocked()  && positionLocker.isLocked() && controlLocker.isLocked())) {
+	/** Get Audio State */
+	AudioSnapshot<AudioState>::ScopedRealtimeAccess state(this->audioState);
+
+	/** Skip The Block While Another Thread Edits Audio State */
+	audioLock::ScopedAudioBlock block;
+	if (!block.canProcess()) {
+		this->mutedBlockNum++;
 		vMath::zeroAllAudioData(audio);
 		midi.clear();
 		return;
 	}
 
+	/** Publish Position Of This Block For All Nodes */
+	auto playPosition = dynamic_cast<PlayPosition*>(this->getPlayHead());
+	if (playPosition) {
+		playPosition->beginBlock();
+	}
+
 	/** Render State */
 	bool isRendering = Renderer::getInstance()->getRendering();
 
+	/** Profile Realtime Blocks Only */
+	std::optional<DSPProfiler::ScopedBlock> dspBlock;
+	if (!isRendering) {
+		dspBlock.emplace(audio.getNumSamples(), this->getSampleRate());
+	}
+
+	/** Event Queue */
+	auto eventQueue = AudioEventQueue::getInstanceWithoutCreate();
+
 	/** Call MIDI Hook */
-	if(!isRendering) {
-		if (this->midiHook) {
+	if (!isRendering && eventQueue) {
+		if (state->midiHook) {
 			for (auto m : midi) {
-				juce::MessageManager::callAsync(
-					[mes = m.getMessage(), hook = this->midiHook] {
-						hook(mes, true);
-					});
+				eventQueue->pushMIDI(this->eventListenerID,
+					AudioEventType::MIDIInput, m.data, m.numBytes);
 			}
 		}
 	}
 
 	/** Send MIDI CC */
-	if (!isRendering) {
+	if (!isRendering && eventQueue) {
 		/** Get Last CC Channel */
 		int lastCCChannel = -1;
 		for (auto m : midi) {
-			/** Get Message */
-			auto message = m.getMessage();
-			if (!message.isController()) { continue; }
+			/** Check Message */
+			if (m.numBytes < 3) { continue; }
+			if ((m.data[0] & 0xF0) != 0xB0) { continue; }
 
 			/** Auto Link Param */
-			lastCCChannel = message.getControllerNumber();
+			lastCCChannel = m.data[1];
 		}
 
 		/** Send Auto Connect */
-		if ((lastCCChannel > -1) && this->ccListener) {
-			juce::MessageManager::callAsync(
-				std::bind(this->ccListener, lastCCChannel));
+		if ((lastCCChannel > -1) && state->ccListener) {
+			eventQueue->pushValue(this->eventListenerID,
+				AudioEventType::CCLearn, lastCCChannel);
 		}
 	}
 
 	/** Transport MMC */
-	if (!isRendering) {
+	if (!isRendering && eventQueue) {
 		for (auto m : midi) {
-			auto mes = m.getMessage();
-			if (mes.isMidiMachineControlMessage()) {
-				switch (mes.getMidiMachineControlCommand())
-				{
-				case juce::MidiMessage::MidiMachineControlCommand::mmc_play:
-					juce::MessageManager::callAsync([] { AudioCore::getInstance()->play(); });
-					continue;
-				case juce::MidiMessage::MidiMachineControlCommand::mmc_pause:
-					juce::MessageManager::callAsync([] { AudioCore::getInstance()->pause(); });
-					continue;
-				case juce::MidiMessage::MidiMachineControlCommand::mmc_stop:
-					juce::MessageManager::callAsync([] { AudioCore::getInstance()->stop(); });
-					continue;
-				case juce::MidiMessage::MidiMachineControlCommand::mmc_rewind:
-					juce::MessageManager::callAsync([] { AudioCore::getInstance()->rewind(); });
-					continue;
-				case juce::MidiMessage::MidiMachineControlCommand::mmc_recordStart:
-					juce::MessageManager::callAsync([] { AudioCore::getInstance()->record(true); });
-					continue;
-				case juce::MidiMessage::MidiMachineControlCommand::mmc_recordStop:
-					juce::MessageManager::callAsync([] { AudioCore::getInstance()->record(false); });
-					continue;
-				default:
-					break;
-				}
-			}
+			/** Check Message */
+			if (m.numBytes <= 5) { continue; }
+			if (m.data[0] != 0xF0 || m.data[1] != 0x7F || m.data[3] != 0x06) { continue; }
+
+			/** Send Command */
+			eventQueue->pushValue(this->eventListenerID,
+				AudioEventType::Transport, m.data[4]);
 		}
 	}
 
@@ -488,7 +635,24 @@ void MainGraph::processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer&
 	/** Process Audio Block */
 	{
 		this->recorder->processBlock(audio, midi);
-		this->juce::AudioProcessorGraph::processBlock(audio, midi);
+
+		/** Process On Worker Threads */
+		bool processed = false;
+		if (auto engine = state->parallelEngine.get()) {
+			processed = engine->process(audio, midi);
+
+			/** Ask For A New Schedule Once */
+			if (!processed && !engine->isUpToDate()
+				&& !this->parallelEngineOutdated.exchange(true) && eventQueue) {
+				eventQueue->pushValue(this->eventListenerID,
+					AudioEventType::GraphChanged, 0);
+			}
+		}
+
+		/** Serial Graph Until The Schedule Is Ready */
+		if (!processed) {
+			this->juce::AudioProcessorGraph::processBlock(audio, midi);
+		}
 	}
 
 	/** Truncate Output */
@@ -497,26 +661,31 @@ void MainGraph::processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer&
 		midi.clear();
 	}
 
-	/** Get Level */
-	for (int i = 0; i < audio.getNumChannels() && i < this->outputLevels.size(); i++) {
-		this->outputLevels.getReference(i) =
-			audio.getRMSLevel(i, 0, audio.getNumSamples());
+	/** CC Learned By Plugins */
+	if (!isRendering) {
+		this->sendPendingMIDICC();
 	}
 
+	/** Level Meter */
+	state->outputMeter->process(audio, this->getSampleRate());
+
 	/** MIDI Output */
-	if (!isRendering) {
-		if (this->midiHook) {
+	if (!isRendering && eventQueue) {
+		if (state->midiHook) {
 			for (auto m : midi) {
-				juce::MessageManager::callAsync(
-					[mes = m.getMessage(), hook = this->midiHook] {
-						hook(mes, false);
-					});
+				eventQueue->pushMIDI(this->eventListenerID,
+					AudioEventType::MIDIOutput, m.data, m.numBytes);
 			}
 		}
 	}
 
 	/** Add Position */
-	if (auto position = dynamic_cast<PlayPosition*>(this->getPlayHead())) {
+	if (auto position = playPosition) {
+		/** Skip Moving While The Position Is Edited */
+		juce::ScopedTryWriteLock locker(audioLock::getPositionLock());
+		position->endBlock(locker.isLocked());
+		if (!locker.isLocked()) { return; }
+
 		/** Current Time */
 		int currentPos = position->getPosition()->getTimeInSamples().orFallback(0);
 		int clipSize = audio.getNumSamples();
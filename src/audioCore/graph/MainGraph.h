@@ -6,10 +6,17 @@
 #include "SeqSourceProcessor.h"
 #include "SourceRecordProcessor.h"
 #include "../project/Serializable.h"
+#include "../misc/AudioSnapshot.h"
+#include "../misc/LevelMeter.h"
+#include "../misc/ParallelTaskPool.h"
+#include "../uiCallback/AudioEventQueue.h"
 #include "../Utils.h"
 
+class RenderEngine;
+
 class MainGraph final : public juce::AudioProcessorGraph,
-	public Serializable {
+	public Serializable,
+	private juce::ChangeListener {
 public:
 	MainGraph();
 	~MainGraph() override;
@@ -89,7 +96,27 @@ public:
 
 	void clearGraph();
 
-	const juce::Array<float> getOutputLevels() const;
+	std::shared_ptr<const LevelMeter> getOutputMeter() const;
+
+	/**
+	 * @brief	Get the number of blocks muted because another thread was editing audio state.
+	 */
+	uint64_t getMutedBlockNum() const;
+
+	/**
+	 * @brief	Get the number of audio thread events dropped because the event queue was full.
+	 */
+	uint64_t getAudioEventOverflowNum() const;
+
+	/**
+	 * @brief	Rebuild the schedule which processes the graph on worker threads in real time.
+	 *			This is called when the graph changes. Never call this on the audio thread.
+	 */
+	void updateParallelEngine();
+	/**
+	 * @brief	Get the number of threads and tasks of the current schedule and the longest dependency chain.
+	 */
+	const std::tuple<int, int, int> getParallelEngineInfo() const;
 
 	class SafePointer {
 	private:
@@ -135,11 +162,27 @@ private:
 	juce::Array<juce::AudioProcessorGraph::Connection> audioTrk2OConnectionList;
 	juce::Array<juce::AudioProcessorGraph::Connection> midiTrk2OConnectionList;
 
-	std::function<void(const juce::MidiMessage&, bool)> midiHook;
+	/** Graph state read by the audio thread without locking */
+	struct AudioState final {
+		std::function<void(const juce::MidiMessage&, bool)> midiHook;
+		MIDICCListener ccListener;
+		std::shared_ptr<LevelMeter> outputMeter
+			= std::make_shared<LevelMeter>(0, true);
+		std::shared_ptr<RenderEngine> parallelEngine;
+	};
+	AudioSnapshot<AudioState> audioState;
+
+	std::atomic<uint64_t> mutedBlockNum = 0;
 
-	MIDICCListener ccListener;
+	/** Worker threads are kept between schedule rebuilds */
+	std::shared_ptr<ParallelTaskPool> parallelPool = nullptr;
+	std::atomic_bool parallelEngineOutdated = false;
+	void changeListenerCallback(juce::ChangeBroadcaster* source) override;
 
-	juce::Array<float> outputLevels;
+	/** Events sent from the audio thread to the message thread */
+	int eventListenerID = -1;
+	void handleAudioEvent(const AudioEvent& event);
+	void sendPendingMIDICC();
 
 	mutable double totalLengthTemp = 0;
 
@@ -151,6 +194,7 @@ private:
 
 	friend class Renderer;
 	friend class RenderThread;
+	friend class RenderEngine;
 	void processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi) override;
 
 	JUCE_DECLARE_WEAK_REFERENCEABLE(MainGraph)
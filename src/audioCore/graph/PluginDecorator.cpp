@@ -2,8 +2,10 @@
 #include "../plugin/Plugin.h"
 #include "../plugin/PluginLoader.h"
 #include "../uiCallback/UICallback.h"
+#include "../uiCallback/AudioEventQueue.h"
 #include "../misc/AudioLock.h"
 #include "../misc/VMath.h"
+#include "../misc/Renderer.h"
 #include "../ara/ARAController.h"
 #include "../ara/ARADataIOThread.h"
 #include "../AudioCore.h"
@@ -41,6 +43,8 @@ PluginDecorator::PluginDecorator(std::unique_ptr<juce::AudioPluginInstance> plug
 }
 
 PluginDecorator::~PluginDecorator() {
+	this->clearMIDICCListener();
+
 	if (this->plugin) {
 		if (auto editor = this->plugin->getActiveEditor()) {
 			delete editor;
@@ -53,7 +57,7 @@ void PluginDecorator::setPlugin(
 	std::unique_ptr<juce::AudioPluginInstance> plugin,
 	const juce::String& pluginIdentifier,
 	SetPluginCallback callback, bool hasARA) {
-	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
+	audioLock::ScopedAudioWriteLock pluginLocker(audioLock::getPluginLock());
 
 	if (!plugin) { return; }
 
@@ -448,13 +452,34 @@ bool PluginDecorator::getMIDIOutput() const {
 }
 
 void PluginDecorator::setMIDICCListener(const MIDICCListener& listener) {
-	juce::ScopedWriteLock locker(audioLock::getPluginLock());
-	this->ccListener = listener;
+	this->clearMIDICCListener();
+
+	if (!listener) { return; }
+	this->ccListenerID = AudioEventQueue::getInstance()->addListener(
+		[listener](const AudioEvent& event) {
+			if (event.type == AudioEventType::CCLearn) {
+				listener(event.value);
+			}
+		});
 }
 
 void PluginDecorator::clearMIDICCListener() {
-	juce::ScopedWriteLock locker(audioLock::getPluginLock());
-	this->ccListener = MIDICCListener{};
+	int id = this->ccListenerID.exchange(-1);
+	if (id > -1) {
+		if (auto queue = AudioEventQueue::getInstanceWithoutCreate()) {
+			queue->removeListener(id);
+		}
+	}
+}
+
+void PluginDecorator::sendPendingMIDICC() {
+	int channel = this->pendingCCChannel.exchange(-1);
+	int listenerID = this->ccListenerID;
+	if ((channel > -1) && (listenerID > -1)) {
+		if (auto queue = AudioEventQueue::getInstanceWithoutCreate()) {
+			queue->pushValue(listenerID, AudioEventType::CCLearn, channel);
+		}
+	}
 }
 
 void PluginDecorator::invokeARADocumentRegionChange() {
@@ -469,6 +494,13 @@ void PluginDecorator::invokeARADocumentTrackInfoChange() {
 	this->araTrackInfoChangeBroadcaster->sendChangeMessage();
 }
 
+const DSPProfiler::Load PluginDecorator::getDSPLoad() const {
+	if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+		return profiler->getLoad(this->dspNode);
+	}
+	return {};
+}
+
 const juce::String PluginDecorator::getName() const {
 	if (!this->plugin) { return ""; }
 	return this->plugin->getName() + ((bool)this->araDocumentController ? "(ARA)" : "");
@@ -503,20 +535,27 @@ void PluginDecorator::memoryWarningReceived() {
 
 void PluginDecorator::processBlock(
 	juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) {
+	DSPProfiler::ScopedTimer dspTimer(this->dspNode);
+
 	PluginDecorator::filterMIDIMessage(this->midiChannel, midiMessages);
 	this->parseMIDICC(midiMessages);
 	PluginDecorator::interceptMIDICCMessage(this->midiCCShouldIntercept, midiMessages);
 
 	{
 		if (this->plugin && this->pluginPrepared && this->buffer) {
-			this->buffer->clear();
-
 			int totalChannels = std::min(buffer.getNumChannels(), this->buffer->getNumChannels());
 			int totalSamples = std::min(buffer.getNumSamples(), this->buffer->getNumSamples());
+			int tailSamples = this->buffer->getNumSamples() - totalSamples;
+
+			/** Only Clear The Part Which Isn't Copied */
 			for (int i = 0; i < totalChannels; i++) {
 				vMath::copyAudioData(
 					*(this->buffer.get()), buffer,
 					0, 0, i, i, totalSamples);
+				vMath::zeroAudioData(*(this->buffer.get()), totalSamples, i, tailSamples);
+			}
+			for (int i = totalChannels; i < this->buffer->getNumChannels(); i++) {
+				vMath::zeroAllAudioDataOnChannel(*(this->buffer.get()), i);
 			}
 
 			this->plugin->processBlock(*(this->buffer.get()), midiMessages);
@@ -534,18 +573,25 @@ void PluginDecorator::processBlock(
 
 void PluginDecorator::processBlock(
 	juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages) {
+	DSPProfiler::ScopedTimer dspTimer(this->dspNode);
+
 	PluginDecorator::filterMIDIMessage(this->midiChannel, midiMessages);
 	this->parseMIDICC(midiMessages);
 	PluginDecorator::interceptMIDICCMessage(this->midiCCShouldIntercept, midiMessages);
 
 	{
 		if (this->plugin && this->pluginPrepared && this->doubleBuffer) {
-			this->doubleBuffer->clear();
+			int totalChannels = std::min(buffer.getNumChannels(), this->doubleBuffer->getNumChannels());
+			int totalSamples = std::min(buffer.getNumSamples(), this->doubleBuffer->getNumSamples());
+			int tailSamples = this->doubleBuffer->getNumSamples() - totalSamples;
 
-			int totalChannels = std::min(buffer.getNumChannels(), this->buffer->getNumChannels());
-			int totalSamples = std::min(buffer.getNumSamples(), this->buffer->getNumSamples());
+			/** Only Clear The Part Which Isn't Copied */
 			for (int i = 0; i < totalChannels; i++) {
 				this->doubleBuffer->copyFrom(i, 0, buffer.getReadPointer(i), totalSamples);
+				this->doubleBuffer->clear(i, totalSamples, tailSamples);
+			}
+			for (int i = totalChannels; i < this->doubleBuffer->getNumChannels(); i++) {
+				this->doubleBuffer->clear(i, 0, this->doubleBuffer->getNumSamples());
 			}
 
 			this->plugin->processBlock(*(this->doubleBuffer.get()), midiMessages);
@@ -883,15 +929,15 @@ void PluginDecorator::parseMIDICC(juce::MidiBuffer& midiMessages) {
 		}
 	}
 
-	/** Send Auto Connect */
-	if ((lastCCChannel > -1) && this->ccListener) {
-		juce::MessageManager::callAsync(
-			std::bind(this->ccListener, lastCCChannel));
+	/** Keep Auto Connect Until The Callback Thread Sends It */
+	if ((lastCCChannel > -1) && (this->ccListenerID > -1)
+		&& !Renderer::getInstance()->getRendering()) {
+		this->pendingCCChannel = lastCCChannel;
 	}
 }
 
 void PluginDecorator::updateBuffer() {
-	juce::ScopedWriteLock locker(audioLock::getPluginLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getPluginLock());
 	if (this->plugin) {
 		int channels = std::max(this->plugin->getTotalNumInputChannels(), this->plugin->getTotalNumOutputChannels());
 		this->buffer = std::make_unique<juce::AudioBuffer<float>>(channels, this->getBlockSize());
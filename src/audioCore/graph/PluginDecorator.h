@@ -3,6 +3,7 @@
 #include <JuceHeader.h>
 #include "../project/Serializable.h"
 #include "../ara/ARAVirtualDocument.h"
+#include "../misc/DSPProfiler.h"
 
 class SeqSourceProcessor;
 
@@ -67,11 +68,18 @@ public:
 	using MIDICCListener = std::function<void(int)>;
 	void setMIDICCListener(const MIDICCListener& listener);
 	void clearMIDICCListener();
+	/**
+	 * @brief	Push the CC channel learned in the last block to the event queue.
+	 *			Decorators may run on audio workers, so only the audio callback thread pushes.
+	 */
+	void sendPendingMIDICC();
 
 	void invokeARADocumentRegionChange();
 	void invokeARADocumentContextChange();
 	void invokeARADocumentTrackInfoChange();
 
+	const DSPProfiler::Load getDSPLoad() const;
+
 	class SafePointer {
 	private:
 		juce::WeakReference<PluginDecorator> weakRef;
@@ -175,7 +183,8 @@ private:
 	const bool isInstr = false;
 	std::atomic_bool pluginPrepared = false;
 
-	MIDICCListener ccListener;
+	std::atomic_int ccListenerID = -1;
+	std::atomic_int pendingCCChannel = -1;
 
 	std::unique_ptr<juce::ARAHostDocumentController> araDocumentController = nullptr;
 	juce::ARAHostModel::EditorRendererInterface araEditorRenderer;
@@ -190,6 +199,8 @@ private:
 	int pluginOnOffCount = 0;
 	juce::SpinLock pluginOnOffMutex;
 
+	DSPProfiler::Node dspNode;
+
 	static void filterMIDIMessage(int channel, juce::MidiBuffer& midiMessages);
 	static void interceptMIDIMessage(bool shouldMIDIOutput, juce::MidiBuffer& midiMessages);
 	static void interceptMIDICCMessage(bool shouldMIDICCIntercept, juce::MidiBuffer& midiMessages);
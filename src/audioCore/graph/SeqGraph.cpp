@@ -4,7 +4,7 @@
 
 void MainGraph::insertSource(int index, const juce::AudioChannelSet& type) {
 	/** Lock */
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	/** Add To The Graph */
 	if (auto ptrNode = this->addNode(std::make_unique<SeqSourceProcessor>(type))) {
@@ -41,7 +41,7 @@ void MainGraph::insertSource(int index, const juce::AudioChannelSet& type) {
 
 void MainGraph::removeSource(int index) {
 	/** Lock */
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	/** Limit Index */
 	if (index < 0 || index >= this->audioSourceNodeList.size()) { return; }
@@ -47,8 +47,8 @@ SeqSourceProcessor::SeqSourceProcessor(const juce::AudioChannelSet& type)
 			{ this->audioOutputNode->nodeID, i } });
 	}
 
-	/** Set Level Size */
-	this->outputLevels.resize(type.size());
+	/** Set Level Meter */
+	this->outputMeter = std::make_shared<LevelMeter>(type.size(), false);
 
 	/** Default Color */
 	this->trackColor = utils::getDefaultColour();
@@ -171,7 +171,7 @@ void SeqSourceProcessor::closeAllNote() {
 
 void SeqSourceProcessor::setInstr(std::unique_ptr<juce::AudioPluginInstance> processor,
 	const juce::String& identifier) {
-	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
+	audioLock::ScopedAudioWriteLock pluginLocker(audioLock::getPluginLock());
 
 	/** Check Processor */
 	if (!processor) { jassertfalse; return; }
@@ -190,7 +190,7 @@ void SeqSourceProcessor::setInstr(std::unique_ptr<juce::AudioPluginInstance> pro
 }
 
 PluginDecorator::SafePointer SeqSourceProcessor::prepareInstr() {
-	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
+	audioLock::ScopedAudioWriteLock pluginLocker(audioLock::getPluginLock());
 
 	/** Remove Current Instr */
 	this->removeInstr();
@@ -228,7 +228,7 @@ PluginDecorator::SafePointer SeqSourceProcessor::prepareInstr() {
 }
 
 void SeqSourceProcessor::removeInstr() {
-	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
+	audioLock::ScopedAudioWriteLock pluginLocker(audioLock::getPluginLock());
 
 	if (auto ptrNode = this->instr) {
 		/** Remove Instr */
@@ -253,7 +253,7 @@ PluginDecorator* SeqSourceProcessor::getInstrProcessor() const {
 }
 
 void SeqSourceProcessor::setInstrumentBypass(bool bypass) {
-	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
+	audioLock::ScopedAudioWriteLock pluginLocker(audioLock::getPluginLock());
 
 	if (this->instr) {
 		SeqSourceProcessor::setInstrumentBypass(PluginDecorator::SafePointer{
@@ -270,7 +270,7 @@ bool SeqSourceProcessor::getInstrumentBypass() const {
 }
 
 void SeqSourceProcessor::setInstrumentBypass(PluginDecorator::SafePointer instr, bool bypass) {
-	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
+	audioLock::ScopedAudioWriteLock pluginLocker(audioLock::getPluginLock());
 
 	if (instr) {
 		if (auto bypassParam = instr->getBypassParameter()) {
@@ -292,7 +292,7 @@ bool SeqSourceProcessor::getInstrumentBypass(PluginDecorator::SafePointer instr)
 }
 
 void SeqSourceProcessor::setInstrOffline(bool offline) {
-	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
+	audioLock::ScopedAudioWriteLock pluginLocker(audioLock::getPluginLock());
 
 	if (offline) {
 		/** Unlink Channels */
@@ -326,7 +326,7 @@ uint64_t SeqSourceProcessor::getMIDIRef() const {
 }
 
 void SeqSourceProcessor::applyAudio() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getAudioLock());
 	this->releaseAudio();
 	this->sourceInfoValid = false;
 	this->audioSourceRef = SourceManager::getInstance()->applySource(
@@ -357,7 +357,7 @@ void SeqSourceProcessor::applyAudio() {
 }
 
 void SeqSourceProcessor::applyMIDI() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getAudioLock());
 	this->releaseMIDI();
 	this->midiSourceRef = SourceManager::getInstance()->applySource(
 		SourceManager::SourceType::MIDI);
@@ -385,7 +385,7 @@ void SeqSourceProcessor::applyMIDI() {
 }
 
 void SeqSourceProcessor::releaseAudio() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getAudioLock());
 	if (this->audioSourceRef > 0) {
 		SourceManager::getInstance()->releaseSource(this->audioSourceRef);
 		this->sourceInfoValid = false;
@@ -399,7 +399,7 @@ void SeqSourceProcessor::releaseAudio() {
 }
 
 void SeqSourceProcessor::releaseMIDI() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getAudioLock());
 	if (this->midiSourceRef > 0) {
 		SourceManager::getInstance()->releaseSource(this->midiSourceRef);
 		this->midiSourceRef = 0;
@@ -413,14 +413,14 @@ void SeqSourceProcessor::releaseMIDI() {
 }
 
 void SeqSourceProcessor::applyAudioIfNeed() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getAudioLock());
 	if (this->audioSourceRef == 0) {
 		this->applyAudio();
 	}
 }
 
 void SeqSourceProcessor::applyMIDIIfNeed() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getAudioLock());
 	if (this->midiSourceRef == 0) {
 		this->applyMIDI();
 	}
@@ -554,9 +554,15 @@ bool SeqSourceProcessor::getMute() const {
 	return this->isMute;
 }
 
-const juce::Array<float> SeqSourceProcessor::getOutputLevels() const {
-	juce::ScopedReadLock locker(audioLock::getLevelMeterLock());
-	return this->outputLevels;
+std::shared_ptr<const LevelMeter> SeqSourceProcessor::getOutputMeter() const {
+	return this->outputMeter;
+}
+
+const DSPProfiler::Load SeqSourceProcessor::getDSPLoad() const {
+	if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+		return profiler->getLoad(this->dspNode);
+	}
+	return {};
 }
 
 void SeqSourceProcessor::syncARAContext() {
@@ -566,7 +572,7 @@ void SeqSourceProcessor::syncARAContext() {
 }
 
 void SeqSourceProcessor::sendDirectMidiMessages(const juce::MidiMessage& message) {
-	juce::ScopedWriteLock locker(audioLock::getAudioControlLock());
+	juce::SpinLock::ScopedLockType locker(this->directMessageLock);
 	this->directMessages.add(message);
 }
 
@@ -574,12 +580,17 @@ void SeqSourceProcessor::prepareToPlay(
 	double sampleRate, int maximumExpectedSamplesPerBlock) {
 	this->juce::AudioProcessorGraph::prepareToPlay(
 		sampleRate, maximumExpectedSamplesPerBlock);
+	this->srcs.setSampleRate(sampleRate);
 	SourceManager::getInstance()->prepareMIDIPlay(this->midiSourceRef);
 	SourceManager::getInstance()->prepareAudioPlay(this->audioSourceRef);
+	this->audioVoice.prepare(this->audioChannels.size(), maximumExpectedSamplesPerBlock);
 }
 
 void SeqSourceProcessor::processBlock(
 	juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) {
+	/** Profile */
+	DSPProfiler::ScopedTimer dspTimer(this->dspNode);
+
 	/** Check Buffer Is Empty */
 	if (buffer.getNumChannels() <= 0) { return; }
 	if (buffer.getNumSamples() <= 0) { return; }
@@ -597,11 +608,12 @@ void SeqSourceProcessor::processBlock(
 	if (!playHead) { isPlaying = false; }
 
 	/** Get Current Position */
-	juce::Optional<juce::AudioPlayHead::PositionInfo> position = playHead->getPosition();
+	juce::Optional<juce::AudioPlayHead::PositionInfo> position;
+	if (playHead) { position = playHead->getPosition(); }
 	if (!position) { isPlaying = false; }
 
 	/** Check Play State */
-	if (!position->getIsPlaying()) { isPlaying = false; }
+	if (position && !position->getIsPlaying()) { isPlaying = false; }
 
 	/** Clear MIDI Buffer */
 	if ((isPlaying && position->getIsRecording()) || (!this->recordingFlag)) {
@@ -610,11 +622,7 @@ void SeqSourceProcessor::processBlock(
 
 	if (isPlaying && !(this->isMute)) {
 		/** Get Time */
-		double startTime = position->getTimeInSeconds().orFallback(-1);
 		double sampleRate = this->getSampleRate();
-		double duration = buffer.getNumSamples() / sampleRate;
-		double endTime = startTime + duration;
-
 		int startTimeInSample = position->getTimeInSamples().orFallback(-1);
 		int durationInSample = buffer.getNumSamples();
 		int endTimeInSample = startTimeInSample + durationInSample;
@@ -622,16 +630,17 @@ void SeqSourceProcessor::processBlock(
 		int sourceLengthInSample = std::floor(this->getSourceLength() * sampleRate);
 
 		/** Find Hot Block */
-		auto index = this->srcs.match(startTime, endTime);
+		SourceList::TimelineAccess timeline(this->srcs.getTimeline());
+		auto index = this->srcs.match(*timeline, sampleRate,
+			startTimeInSample, endTimeInSample);
 
 		/** Copy Source Data */
-		for (int i = std::get<0>(index);
-			i <= std::get<1>(index) && i < this->srcs.size() && i >= 0; i++) {
+		for (int i = std::get<0>(index); i <= std::get<1>(index) && i >= 0; i++) {
 			/** Get Block */
-			auto [blockStartTime, blockEndTime, sourceOffset] = this->srcs.getUnchecked(i);
-			int blockStartTimeInSample = std::floor(blockStartTime * sampleRate);
-			int blockEndTimeInSample = std::floor(blockEndTime * sampleRate);
-			int sourceOffsetInSample = std::floor(sourceOffset * sampleRate);
+			auto& block = timeline->blocks[i];
+			int blockStartTimeInSample = block.start;
+			int blockEndTimeInSample = block.end;
+			int sourceOffsetInSample = block.offset;
 
 			/** Caculate Time */
 			int sourceStartTimeInSample = sourceOffsetInSample;
@@ -658,11 +667,14 @@ void SeqSourceProcessor::processBlock(
 		}
 	}
 
-	/** Direct MIDI Messages */
-	for (auto& i : this->directMessages) {
-		midiMessages.addEvent(i, 0);
+	/** Direct MIDI Messages, Kept For The Next Block While Being Added */
+	juce::SpinLock::ScopedTryLockType directMessageLocker(this->directMessageLock);
+	if (directMessageLocker.isLocked()) {
+		for (auto& i : this->directMessages) {
+			midiMessages.addEvent(i, 0);
+		}
+		this->directMessages.clearQuick();
 	}
-	this->directMessages.clear();
 
 	/** Set Note State */
 	for (auto i : midiMessages) {
@@ -695,16 +707,12 @@ void SeqSourceProcessor::processBlock(
 		vMath::zeroAllAudioData(buffer);
 	}
 
-	/** Update Level Meter */
-	for (int i = 0; i < buffer.getNumChannels() && i < this->outputLevels.size(); i++) {
-		this->outputLevels.getReference(i) =
-			buffer.getRMSLevel(i, 0, buffer.getNumSamples());
-	}
+	/** Update Level Meter, Muted Blocks Are Measured As Silence */
+	this->outputMeter->process(buffer, this->getSampleRate());
 }
 
 double SeqSourceProcessor::getTailLengthSeconds() const {
-	int size = this->srcs.size();
-	return (size > 0) ? std::get<1>(this->srcs.getUnchecked(size - 1)) : 0;
+	return this->srcs.getEndTime();
 }
 
 void SeqSourceProcessor::clearGraph() {
@@ -809,17 +817,17 @@ std::unique_ptr<google::protobuf::Message> SeqSourceProcessor::serialize(
 
 void SeqSourceProcessor::readAudioData(
 	juce::AudioBuffer<float>& buffer, int bufferOffset,
-	int dataOffset, int length) const {
+	int dataOffset, int length) {
 	SourceManager::getInstance()->readAudioData(this->audioSourceRef,
-		buffer, bufferOffset, dataOffset, length);
+		this->audioVoice, buffer, bufferOffset, dataOffset, length);
 }
 
 void SeqSourceProcessor::readMIDIData(
 	juce::MidiBuffer& buffer, int baseTime,
-	int startTime, int endTime) const {
+	int startTime, int endTime) {
 	double sampleRate = this->getSampleRate();
 	SourceManager::getInstance()->readMIDIData(this->midiSourceRef,
-		buffer, baseTime / sampleRate, startTime / sampleRate, endTime / sampleRate,
+		this->midiCursor, buffer, baseTime / sampleRate, startTime / sampleRate, endTime / sampleRate,
 		this->currentMIDITrack);
 }
 
@@ -854,7 +862,10 @@ bool SeqSourceProcessor::isMIDIValid() const {
 }
 
 double SeqSourceProcessor::getSourceLength() const {
-	return std::max(this->getMIDILength(), this->getAudioLength());
+	/** Called In processBlock, Which May Run On An Audio Worker */
+	return std::max(
+		SourceManager::getInstance()->getLengthFast(this->midiSourceRef, SourceManager::SourceType::MIDI),
+		SourceManager::getInstance()->getLengthFast(this->audioSourceRef, SourceManager::SourceType::Audio));
 }
 
 double SeqSourceProcessor::getMIDILength() const {
@@ -4,7 +4,10 @@
 
 #include "SourceList.h"
 #include "PluginDecorator.h"
+#include "../source/SourceResampler.h"
 #include "../project/Serializable.h"
+#include "../misc/DSPProfiler.h"
+#include "../misc/LevelMeter.h"
 
 class SeqSourceProcessor final : public juce::AudioProcessorGraph,
 	public Serializable {
@@ -75,7 +78,8 @@ public:
 	void setMute(bool mute);
 	bool getMute() const;
 
-	const juce::Array<float> getOutputLevels() const;
+	std::shared_ptr<const LevelMeter> getOutputMeter() const;
+	const DSPProfiler::Load getDSPLoad() const;
 
 	void syncARAContext();
 
@@ -136,15 +140,19 @@ private:
 	juce::Colour trackColor;
 
 	uint64_t audioSourceRef = 0, midiSourceRef = 0;
+	SourceResampler audioVoice;
+	SourceMIDITemp::Cursor midiCursor;
 	std::atomic_int currentMIDITrack = 0;
 
 	std::atomic_bool recordingFlag = false;
 
 	std::atomic_bool isMute = false;
 
-	juce::Array<float> outputLevels;
+	std::shared_ptr<LevelMeter> outputMeter;
+	DSPProfiler::Node dspNode;
 
 	juce::Array<juce::MidiMessage> directMessages;
+	juce::SpinLock directMessageLock;
 
 	struct SourceInfo final {
 		double audioSampleRate = 0;
@@ -156,9 +164,9 @@ private:
 
 	friend class SourceRecordProcessor;
 	void readAudioData(juce::AudioBuffer<float>& buffer, int bufferOffset,
-		int dataOffset, int length) const;
+		int dataOffset, int length);
 	void readMIDIData(juce::MidiBuffer& buffer, int baseTime,
-		int startTime, int endTime) const;
+		int startTime, int endTime);
 	void writeAudioData(juce::AudioBuffer<float>& buffer, int offset);
 	void writeMIDIData(const juce::MidiBuffer& buffer, int offset);
 
@@ -1,5 +1,4 @@
 ﻿#include "SourceList.h"
-#include "../misc/AudioLock.h"
 #include "../uiCallback/UICallback.h"
 #include <VSP4.h>
 using namespace org::vocalsharp::vocalshaper;
@@ -8,66 +7,55 @@ void SourceList::updateIndex(int index) {
 	this->index = index;
 }
 
-std::tuple<int, int> SourceList::match(double startTime, double endTime) const {
-	/** Empty */
-	if (this->list.isEmpty()) { return { -1, -1 }; }
-
-	/** Search Range */
-	int sLow = 0, sHigh = this->list.size() - 1;
+AudioSnapshot<SourceList::Timeline>& SourceList::getTimeline() {
+	return this->timeline;
+}
 
-	/** Result Var */
-	int start = this->lastIndex;
+void SourceList::setSampleRate(double sampleRate) {
+	if (juce::approximatelyEqual(this->sampleRate.load(), sampleRate)) { return; }
+	this->sampleRate = sampleRate;
+	this->publish();
+}
 
-	do {
-		/** Try To Use Last Index */
-		if (this->lastIndex >= 0 && this->lastIndex < this->list.size()) {
-			/** Try Last Index */
-			auto& lastSeq = this->list.getReference(this->lastIndex);
-			if (std::get<0>(lastSeq) <= startTime && std::get<1>(lastSeq) > endTime) {
-				/** Last Index Match */
-				break;
-			}
-			else if (std::get<1>(lastSeq) <= startTime) {
-				/** After Last Index */
-				if (this->lastIndex < this->list.size() - 1) {
-					/** Try Next Index */
-					auto& nextSeq = this->list.getReference(this->lastIndex + 1);
-					if (std::get<1>(lastSeq) <= startTime && std::get<1>(nextSeq) > startTime) {
-						/** Next Index Match */
-						start = this->lastIndex + 1;
-						break;
-					}
-					else if (std::get<1>(nextSeq) <= startTime) {
-						/** After Next Index */
-						sLow = this->lastIndex + 1;
-					}
-				}
-				else {
-					/** Last Index Is End */
-					return { -1, -1 };
-				}
-			}
-			else {
-				/** Before Last Index */
-				sHigh = this->lastIndex;
-			}
+std::tuple<int, int> SourceList::match(const Timeline& timeline, double sampleRate,
+	int startSample, int endSample) const {
+	/** Timeline Not Converted To Current Sample Rate Yet */
+	if (!juce::approximatelyEqual(timeline.sampleRate, sampleRate)) { return { -1, -1 }; }
+
+	auto& blocks = timeline.blocks;
+	int size = static_cast<int>(blocks.size());
+
+	/** Cursor Is The First Block Ends After Start */
+	auto isCursor = [&blocks, size, startSample](int index) {
+		return (index >= 0 && index <= size)
+			&& (index == size || blocks[index].end > startSample)
+			&& (index == 0 || blocks[index - 1].end <= startSample);
+		};
+
+	/** Try Cached Cursor And Next Block Before Searching */
+	int start = this->cursorIndex;
+	if (this->cursorVersion != timeline.version || !isCursor(start)) {
+		if (this->cursorVersion == timeline.version && isCursor(start + 1)) {
+			start++;
 		}
-
-		/** Binary Search */
-		start = this->binarySearchStart(sLow, sHigh, startTime);
-		if (start > -1) {
-			break;
+		else {
+			start = static_cast<int>(std::partition_point(blocks.begin(), blocks.end(),
+				[startSample](const Timeline::Block& block) { return block.end <= startSample; }) - blocks.begin());
 		}
+	}
+	this->cursorVersion = timeline.version;
+	this->cursorIndex = start;
 
-		/** Seq Unexists */
-		return { -1, -1 };
-	} while (false);
-	
-	/** Found Result */
-	int end = this->seqSearchEnd(start, this->list.size() - 1, endTime);
+	/** No Block In Range */
+	if (start >= size || blocks[start].start >= endSample) { return { -1, -1 }; }
 
-	if (end <= -1) { return { -1, -1 }; }
-	return { start, this->lastIndex = end };
+	/** Blocks Are Sorted And Not Overlapped */
+	int end = start;
+	while (end + 1 < size && blocks[end + 1].start < endSample) {
+		end++;
+	}
+
+	return { start, end };
 }
 
 const SourceList::SeqBlock SourceList::get(int index) const {
@@ -86,10 +74,36 @@ int SourceList::size() const {
 	return this->list.size();
 }
 
+double SourceList::getEndTime() const {
+	return this->endTime;
+}
+
 int SourceList::add(const SourceList::SeqBlock& block) {
-	/** Get Lock */
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	int index = this->insertInternal(block);
+	if (index < 0) { return -1; }
+
+	/** Update Timeline */
+	this->publish();
+
+	/** Callback */
+	UICallbackAPI<int, int>::invoke(
+		UICallbackType::SeqBlockChanged, this->index, index);
+
+	return index;
+}
+
+void SourceList::remove(int index) {
+	if (this->removeInternal(index)) {
+		/** Update Timeline */
+		this->publish();
 
+		/** Callback */
+		UICallbackAPI<int, int>::invoke(
+			UICallbackType::SeqBlockChanged, this->index, index);
+	}
+}
+
+int SourceList::insertInternal(const SeqBlock& block) {
 	/** Get Insert Place */
 	int index = this->list.isEmpty()
 		? 0 : this->binarySearchInsert(0, this->list.size() - 1, std::get<0>(block));
@@ -107,28 +121,39 @@ int SourceList::add(const SourceList::SeqBlock& block) {
 
 	/** Insert Block */
 	this->list.insert(index, block);
-
-	/** Callback */
-	UICallbackAPI<int, int>::invoke(
-		UICallbackType::SeqBlockChanged, this->index, index);
-
 	return index;
 }
 
-void SourceList::remove(int index) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+bool SourceList::removeInternal(int index) {
 	if (index >= 0 && index < this->list.size()) {
 		this->list.remove(index);
+		return true;
+	}
+	return false;
+}
 
-		/** Callback */
-		UICallbackAPI<int, int>::invoke(
-			UICallbackType::SeqBlockChanged, this->index, index);
+void SourceList::publish() {
+	auto state = std::make_unique<Timeline>();
+	state->version = ++(this->timelineVersion);
+	state->sampleRate = this->sampleRate;
+
+	/** Convert To Samples */
+	{
+		juce::ScopedLock locker(this->list.getLock());
+		state->blocks.reserve(this->list.size());
+		for (auto& [startTime, endTime, offset] : this->list) {
+			state->blocks.push_back({
+				(int)std::floor(startTime * state->sampleRate),
+				(int)std::floor(endTime * state->sampleRate),
+				(int)std::floor(offset * state->sampleRate) });
+		}
+		this->endTime = this->list.isEmpty() ? 0 : std::get<1>(this->list.getLast());
 	}
+
+	this->timeline.publish(std::move(state));
 }
 
 bool SourceList::split(int index, double time) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-
 	if (index >= 0 && index < this->list.size()) {
 		auto [startTime, endTime, offset] = this->list.getUnchecked(index);
 		if (startTime < time && time < endTime) {
@@ -136,6 +161,7 @@ bool SourceList::split(int index, double time) {
 
 			this->list.insert(index, { startTime, time, offset });
 			this->list.insert(index + 1, { time, endTime, offset });
+			this->publish();
 
 			/** Callback */
 			UICallbackAPI<int, int>::invoke(
@@ -151,8 +177,6 @@ bool SourceList::split(int index, double time) {
 }
 
 bool SourceList::stickWithNext(int index) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-
 	if (index >= 0 && index < this->list.size() - 1) {
 		auto [startTimeFirst, endTimeFirst, offsetFirst] = this->list.getUnchecked(index);
 		auto [startTimeSecond, endTimeSecond, offsetSecond] = this->list.getUnchecked(index + 1);
@@ -162,6 +186,7 @@ bool SourceList::stickWithNext(int index) {
 			this->list.remove(index);
 
 			this->list.insert(index, { startTimeFirst, endTimeSecond, offsetFirst });
+			this->publish();
 
 			/** Callback */
 			UICallbackAPI<int, int>::invoke(
@@ -177,17 +202,26 @@ bool SourceList::stickWithNext(int index) {
 }
 
 int SourceList::resetTime(int index, const SeqBlock& block) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	if (!this->removeInternal(index)) { return -1; }
+	int newIndex = this->insertInternal(block);
+
+	/** Audio Thread Sees Both Changes At Once */
+	this->publish();
 
-	if (index < 0 || index >= this->list.size()) { return -1; }
-	this->remove(index);
-	return this->add(block);
+	/** Callback */
+	UICallbackAPI<int, int>::invoke(
+		UICallbackType::SeqBlockChanged, this->index, index);
+	if (newIndex > -1) {
+		UICallbackAPI<int, int>::invoke(
+			UICallbackType::SeqBlockChanged, this->index, newIndex);
+	}
+
+	return newIndex;
 }
 
 void SourceList::clearGraph() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
 	this->list.clear();
-	this->lastIndex = -1;
+	this->publish();
 
 	/** Callback */
 	UICallbackAPI<int, int>::invoke(
@@ -256,59 +290,3 @@ int SourceList::binarySearchInsert(int low, int high, double t) const {
 
 	return -1;
 }
-
-int SourceList::binarySearchStart(int low, int high, double t) const {
-	while (low <= high) {
-		int mid = low + (high - low) / 2;
-
-		auto& current = this->list.getReference(mid);
-		if (mid == low) {
-			if (t < std::get<1>(current)) {
-				return low;
-			}
-		}
-		if (mid == high) {
-			if (t >= std::get<0>(current) && t < std::get<1>(current)) {
-				return high;
-			}
-			else if (t >= std::get<1>(current)) {
-				return -1;
-			}
-		}
-
-		auto& next = this->list.getReference(mid + 1);
-		if (t >= std::get<0>(current) && t < std::get<0>(next)) {
-			return mid + 1;
-		}
-		else if (t < std::get<0>(current)) {
-			high = mid - 1;
-			continue;
-		}
-		else {
-			low = mid + 1;
-			continue;
-		}
-	}
-
-	return -1;
-}
-
-int SourceList::seqSearchEnd(int low, int high, double t) const {
-	for (int i = low; i <= high; i++) {
-		auto& current = this->list.getReference(i);
-
-		if (i == low && t < std::get<0>(current)) {
-			return -1;
-		}
-		if (i == high && t >= std::get<0>(current)) {
-			return i;
-		}
-
-		auto& next = this->list.getReference(i + 1);
-		if (t >= std::get<0>(current) && t < std::get<0>(next)) {
-			return i;
-		}
-	}
-
-	return -1;
-}
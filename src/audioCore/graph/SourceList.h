@@ -2,6 +2,7 @@
 
 #include <JuceHeader.h>
 #include "../project/Serializable.h"
+#include "../misc/AudioSnapshot.h"
 
 class SourceList final : public Serializable {
 public:
@@ -16,22 +17,48 @@ public:
 		double, double, double>;
 
 	/**
-	 * @attention Call this only on audio thread. Get the lock before use this method.
+	 * @brief	Immutable copy of the list with times in samples, which edits replace atomically.
 	 */
-	std::tuple<int, int> match(double startTime, double endTime) const;
+	struct Timeline final {
+		/** Start, end and source offset in samples */
+		struct Block final {
+			int start = 0, end = 0, offset = 0;
+		};
+
+		uint64_t version = 0;
+		double sampleRate = 0;
+		std::vector<Block> blocks;
+	};
+	using TimelineAccess = AudioSnapshot<Timeline>::ScopedRealtimeAccess;
+	AudioSnapshot<Timeline>& getTimeline();
+
+	/**
+	 * @brief	Set the sample rate used to convert the timeline. Never call this on the audio thread.
+	 */
+	void setSampleRate(double sampleRate);
+
+	/**
+	 * @brief	Get the first and last index of blocks overlapping [startSample, endSample) in the timeline.
+	 *			Steady playback hits the cached cursor, so this is O(1) per block.
+	 * @attention Call this only on audio thread.
+	 */
+	std::tuple<int, int> match(const Timeline& timeline, double sampleRate,
+		int startSample, int endSample) const;
+
 	/**
-	 * @attention Get the lock before use this method.
+	 * @attention The audio thread should read the timeline instead.
 	 */
 	const SeqBlock get(int index) const;
 	/**
-	 * @attention Get the lock before use this method.
+	 * @attention The audio thread should read the timeline instead.
 	 */
 	const SeqBlock getUnchecked(int index) const;
 	/**
-	 * @attention Get the lock before use this method.
+	 * @attention The audio thread should read the timeline instead.
 	 */
 	const SeqBlock& getReference(int index) const;
 	int size() const;
+	double getEndTime() const;
 	int add(const SeqBlock& block);
 	void remove(int index);
 
@@ -53,11 +80,22 @@ private:
 	int index = -1;
 
 	juce::Array<SeqBlock, juce::CriticalSection> list;
-	mutable int lastIndex = -1;
+
+	AudioSnapshot<Timeline> timeline;
+	uint64_t timelineVersion = 0;
+	std::atomic<double> sampleRate = 0;
+	std::atomic<double> endTime = 0;
+
+	/** Only used by the audio thread */
+	mutable uint64_t cursorVersion = 0;
+	mutable int cursorIndex = 0;
+
+	void publish();
+
+	int insertInternal(const SeqBlock& block);
+	bool removeInternal(int index);
 
 	int binarySearchInsert(int low, int high, double t) const;
-	int binarySearchStart(int low, int high, double t) const;
-	int seqSearchEnd(int low, int high, double t) const;
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourceList)
 };
@@ -1,14 +1,27 @@
 ﻿#include "SourceRecordProcessor.h"
 #include "MainGraph.h"
 #include "../uiCallback/UICallback.h"
+#include "../uiCallback/AudioEventQueue.h"
 #include "../misc/AudioLock.h"
 #include <VSP4.h>
 using namespace org::vocalsharp::vocalshaper;
 
 SourceRecordProcessor::SourceRecordProcessor(MainGraph* parent)
-	: parent(parent) {}
+	: parent(parent) {
+	/** Record Notification */
+	this->eventListenerID = AudioEventQueue::getInstance()->addListener(
+		[this](const AudioEvent& event) {
+			if (event.type == AudioEventType::Record) {
+				this->handleRecordEvent(event);
+			}
+		});
+}
 
-SourceRecordProcessor::~SourceRecordProcessor() {}
+SourceRecordProcessor::~SourceRecordProcessor() {
+	if (auto queue = AudioEventQueue::getInstanceWithoutCreate()) {
+		queue->removeListener(this->eventListenerID);
+	}
+}
 
 void SourceRecordProcessor::prepareToPlay(
 	double sampleRate, int maximumExpectedSamplesPerBlock) {
@@ -24,8 +37,11 @@ void SourceRecordProcessor::processBlock(
 	if (!playPosition->getIsPlaying() || !playPosition->getIsRecording()) { return; }
 	int timeInSamples = playPosition->getTimeInSamples().orFallback(0);
 
+	/** Block Index */
+	int blockIndex = this->recordBlockCount++;
+	auto eventQueue = AudioEventQueue::getInstanceWithoutCreate();
+
 	/** Check Each Task */
-	std::set<int> trackIndexList;
 	int trackNum = this->parent->getSourceNum();
 	for (int i = 0; i < trackNum; i++) {
 		auto track = this->parent->getSourceProcessor(i);
@@ -34,18 +50,37 @@ void SourceRecordProcessor::processBlock(
 			track->writeAudioData(buffer, timeInSamples);
 			track->writeMIDIData(midiMessages, timeInSamples);
 
-			/** Add Track Index to List */
-			trackIndexList.insert(i);
+			/** Send Track Index */
+			if (eventQueue && buffer.getNumSamples() > 0) {
+				AudioEvent event;
+				event.type = AudioEventType::Record;
+				event.target = this->eventListenerID;
+				event.value = blockIndex;
+				event.size = sizeof(int);
+				std::memcpy(event.data.data(), &i, sizeof(int));
+				eventQueue->push(event);
+			}
 		}
 	}
+}
 
-	/** Callback */
-	if (trackIndexList.size() > 0 && buffer.getNumSamples() > 0) {
-		this->limitedCall.call([trackIndexList] {
-			UICallbackAPI<const std::set<int>&>::invoke(
-				UICallbackType::SourceRecord, trackIndexList);
-			}, 500 / (1000 / (this->getSampleRate() / buffer.getNumSamples())), 500);
+void SourceRecordProcessor::handleRecordEvent(const AudioEvent& event) {
+	/** Tracks Of The Same Block */
+	if (event.value != this->recordBlockTemp) {
+		this->recordBlockTemp = event.value;
+		this->recordTrackTemp.clear();
 	}
+
+	int trackIndex = -1;
+	std::memcpy(&trackIndex, event.data.data(), sizeof(int));
+	this->recordTrackTemp.insert(trackIndex);
+
+	/** Callback */
+	double blockPerSecond = this->getSampleRate() / std::max(this->getBlockSize(), 1);
+	this->limitedCall.call([trackIndexList = this->recordTrackTemp] {
+		UICallbackAPI<const std::set<int>&>::invoke(
+			UICallbackType::SourceRecord, trackIndexList);
+		}, 500 / (1000 / blockPerSecond), 500);
 }
 
 double SourceRecordProcessor::getTailLengthSeconds() const {
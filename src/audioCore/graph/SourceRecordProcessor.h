@@ -6,6 +6,7 @@
 #include "../uiCallback/LimitedCall.h"
 
 class MainGraph;
+struct AudioEvent;
 
 class SourceRecordProcessor final : public juce::AudioProcessor {
 public:
@@ -61,6 +62,13 @@ private:
 	MainGraph* const parent;
 	LimitedCall limitedCall;
 
+	int eventListenerID = -1;
+	int recordBlockCount = 0;
+	int recordBlockTemp = -1;
+	std::set<int> recordTrackTemp;
+
+	void handleRecordEvent(const AudioEvent& event);
+
 	JUCE_DECLARE_WEAK_REFERENCEABLE(SourceRecordProcessor)
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourceRecordProcessor)
 };
@@ -1,7 +1,6 @@
 ﻿#include "Track.h"
 
 #include "../misc/Renderer.h"
-#include "../misc/AudioLock.h"
 #include "../misc/VMath.h"
 #include "../uiCallback/UICallback.h"
 #include "../Utils.h"
@@ -67,8 +66,12 @@ Track::Track(const juce::AudioChannelSet& type)
 	this->addConnection(
 		{ {this->midiInputNode->nodeID, this->midiChannelIndex}, {this->midiOutputNode->nodeID, this->midiChannelIndex} });
 
-	/** Set Level Size */
-	this->outputLevels.resize(mainBusOutputChannels);
+	/** Set Level Meter */
+	this->outputMeter = std::make_shared<LevelMeter>(mainBusOutputChannels, true);
+
+	/** Set Gain Temp Size */
+	this->inputGainTemp.resize(this->audioChannels.size());
+	this->outputGainTemp.resize(this->audioChannels.size());
 
 	/** Default Color */
 	this->trackColor = utils::getDefaultColour();
@@ -182,25 +185,20 @@ bool Track::getMute() const {
 }
 
 void Track::setGain(float gain) {
-	auto& gainDsp = this->gainAndPanner.get<0>();
-	gainDsp.setGainDecibels(gain);
+	this->gainValue = gain;
 
 	/** Callback */
 	UICallbackAPI<int>::invoke(UICallbackType::TrackGainChanged, this->index);
 }
 
 float Track::getGain() const {
-	auto& gainDsp = this->gainAndPanner.get<0>();
-	return gainDsp.getGainDecibels();
+	return this->gainValue;
 }
 
 void Track::setPan(float pan) {
 	pan = juce::jlimit(-1.0f, 1.0f, pan);
 	this->panValue = pan;
 
-	auto& panDsp = this->gainAndPanner.get<1>();
-	panDsp.setPan(pan);
-
 	/** Callback */
 	UICallbackAPI<int>::invoke(UICallbackType::TrackPanChanged, this->index);
 }
@@ -210,16 +208,14 @@ float Track::getPan() const {
 }
 
 void Track::setSlider(float slider) {
-	auto& sliderDsp = this->slider.get<0>();
-	sliderDsp.setGainLinear(slider);
+	this->sliderValue = slider;
 
 	/** Callback */
 	UICallbackAPI<int>::invoke(UICallbackType::TrackFaderChanged, this->index);
 }
 
 float Track::getSlider() const {
-	auto& sliderDsp = this->slider.get<0>();
-	return sliderDsp.getGainLinear();
+	return this->sliderValue;
 }
 
 void Track::setTrackName(const juce::String& name) {
@@ -257,18 +253,10 @@ void Track::prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBlock)
 		return;
 	}
 
-	if (this->audioChannels.size() > 0) {
-		/** Prepare Gain And Panner */
-		this->gainAndPanner.prepare(juce::dsp::ProcessSpec(
-			sampleRate, maximumExpectedSamplesPerBlock,
-			this->audioChannels.size()
-		));
-
-		/** Prepare Slider */
-		this->slider.prepare(juce::dsp::ProcessSpec(
-			sampleRate, maximumExpectedSamplesPerBlock,
-			this->audioChannels.size()
-		));
+	/** Reset Gain Ramp */
+	for (int i = 0; i < this->inputGainTemp.size(); i++) {
+		this->inputGainTemp[i] = this->getInputGain(i);
+		this->outputGainTemp[i] = this->getOutputGain();
 	}
 
 	/** Prepare Current Graph */
@@ -302,9 +290,15 @@ void Track::clearGraph() {
 	this->setSlider(1);
 }
 
-const juce::Array<float> Track::getOutputLevels() const {
-	juce::ScopedReadLock locker(audioLock::getLevelMeterLock());
-	return this->outputLevels;
+std::shared_ptr<const LevelMeter> Track::getOutputMeter() const {
+	return this->outputMeter;
+}
+
+const DSPProfiler::Load Track::getDSPLoad() const {
+	if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+		return profiler->getLoad(this->dspNode);
+	}
+	return {};
 }
 
 bool Track::parse(
@@ -360,6 +354,22 @@ std::unique_ptr<google::protobuf::Message> Track::serialize(
 	return std::unique_ptr<google::protobuf::Message>(mes.release());
 }
 
+float Track::getInputGain(int channel) const {
+	float gain = juce::Decibels::decibelsToGain(this->gainValue.load());
+
+	/** Balanced Pan Law On Stereo Tracks */
+	if (this->inputGainTemp.size() == 2) {
+		float pan = this->panValue;
+		gain *= (channel == 0) ? std::min(1.f, 1.f - pan) : std::min(1.f, 1.f + pan);
+	}
+
+	return gain;
+}
+
+float Track::getOutputGain() const {
+	return this->isMute ? 0.f : this->sliderValue.load();
+}
+
 bool Track::canAddBus(bool isInput) const {
 	return isInput;
 }
@@ -369,32 +379,29 @@ bool Track::canRemoveBus(bool isInput) const {
 }
 
 void Track::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) {
+	/** Profile */
+	DSPProfiler::ScopedTimer dspTimer(this->dspNode);
+
 	/** Check Buffer Is Empty */
 	if (buffer.getNumChannels() <= 0) { return; }
 	if (buffer.getNumSamples() <= 0) { return; }
 	
 	/** Process Gain And Panner */
-	int mainChannels = this->audioChannels.size();
-	auto block = juce::dsp::AudioBlock<float>(buffer).getSubsetChannelBlock(
-		0, mainChannels);
-	this->gainAndPanner.process(juce::dsp::ProcessContextReplacing<float>(block));
+	int mainChannels = std::min(buffer.getNumChannels(), (int)this->inputGainTemp.size());
+	int numSamples = buffer.getNumSamples();
+	for (int i = 0; i < mainChannels; i++) {
+		float gain = this->getInputGain(i);
+		vMath::gainAudioData(buffer, this->inputGainTemp[i], gain,
+			0, i, numSamples);
+		this->inputGainTemp[i] = gain;
+	}
 
 	/** Process Current Graph */
 	this->AudioProcessorGraph::processBlock(buffer, midiMessages);
 
-	/** Process Mute */
-	if (this->isMute) {
-		block.fill(0);
-	}
-
-	/** Process Slider */
-	this->slider.process(juce::dsp::ProcessContextReplacing<float>(block));
-
-	/** Update Level Meter */
-	for (int i = 0; i < buffer.getNumChannels() && i < this->outputLevels.size(); i++) {
-		this->outputLevels.getReference(i) =
-			buffer.getRMSLevel(i, 0, buffer.getNumSamples());
-	}
+	/** Process Mute And Slider With Level Meter In One Pass */
+	this->outputMeter->processWithGain(buffer, this->getSampleRate(),
+		this->outputGainTemp.data(), mainChannels, this->getOutputGain());
 
 	/** Render */
 	if (Renderer::getInstance()->getRendering()) {
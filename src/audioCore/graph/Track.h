@@ -3,6 +3,8 @@
 #include <JuceHeader.h>
 #include "PluginDock.h"
 #include "../project/Serializable.h"
+#include "../misc/DSPProfiler.h"
+#include "../misc/LevelMeter.h"
 
 class Track final : public juce::AudioProcessorGraph,
 	public Serializable {
@@ -45,7 +47,8 @@ public:
 
 	void clearGraph();
 
-	const juce::Array<float> getOutputLevels() const;
+	std::shared_ptr<const LevelMeter> getOutputMeter() const;
+	const DSPProfiler::Load getDSPLoad() const;
 
 	class SafePointer {
 	private:
@@ -84,16 +87,23 @@ private:
 
 	juce::AudioProcessorGraph::Node::Ptr pluginDockNode;
 
-	juce::dsp::ProcessorChain<juce::dsp::Gain<float>, juce::dsp::Panner<float>> gainAndPanner;
-	juce::dsp::ProcessorChain<juce::dsp::Gain<float>> slider;
 	std::atomic<bool> isMute = false;
 
+	std::atomic<float> gainValue = 0.0;
 	std::atomic<float> panValue = 0.0;
+	std::atomic<float> sliderValue = 1.0;
+
+	/** Gain applied at the end of the last block, ramped to the new value in the next block */
+	std::vector<float> inputGainTemp, outputGainTemp;
+
+	float getInputGain(int channel) const;
+	float getOutputGain() const;
 
 	juce::String trackName;
 	juce::Colour trackColor;
 
-	juce::Array<float> outputLevels;
+	std::shared_ptr<LevelMeter> outputMeter;
+	DSPProfiler::Node dspNode;
 
 private:
 	bool canAddBus(bool isInput) const override;
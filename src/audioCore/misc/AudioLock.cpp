@@ -8,7 +8,6 @@ namespace audioLock {
 		juce::ReadWriteLock pluginLock;
 		juce::ReadWriteLock positionLock;
 		juce::ReadWriteLock audioControlLock;
-		juce::ReadWriteLock levelMeterLock;
 	};
 
 	static LockHelper* lock = new LockHelper;
@@ -33,7 +32,148 @@ namespace audioLock {
 		return lock->audioControlLock;
 	}
 
-	juce::ReadWriteLock& getLevelMeterLock() {
-		return lock->levelMeterLock;
+	/** Each Reader Thread Owns A Slot Holding The Epoch It Entered At, 0 When Idle */
+	static constexpr int readerSlotNum = 256;
+	static std::atomic<uint64_t> readerEpoch = 1;
+	static std::array<std::atomic<uint64_t>, readerSlotNum> readerSlots{};
+	static std::array<std::atomic_bool, readerSlotNum> readerSlotUsed{};
+	static std::atomic<int> overflowReaderNum = 0;
+
+	class ReaderSlot final {
+	public:
+		ReaderSlot() {
+			for (int i = 0; i < readerSlotNum; i++) {
+				bool used = false;
+				if (readerSlotUsed[i].compare_exchange_strong(used, true)) {
+					this->index = i;
+					break;
+				}
+			}
+			jassert(this->index >= 0);
+		};
+		~ReaderSlot() {
+			if (this->index >= 0) {
+				readerSlots[this->index] = 0;
+				readerSlotUsed[this->index] = false;
+			}
+		};
+
+		/** Threads Beyond The Slot Num Share A Counter, Which Blocks Every Release */
+		int index = -1;
+		int depth = 0;
+
+		JUCE_DECLARE_NON_COPYABLE(ReaderSlot)
+	};
+
+	static thread_local ReaderSlot readerSlot;
+
+	ScopedReader::ScopedReader() {
+		if (readerSlot.depth++ > 0) { return; }
+
+		if (readerSlot.index < 0) {
+			overflowReaderNum++;
+			return;
+		}
+		readerSlots[readerSlot.index] = readerEpoch.load();
+	}
+
+	ScopedReader::~ScopedReader() {
+		if (--readerSlot.depth > 0) { return; }
+
+		if (readerSlot.index < 0) {
+			overflowReaderNum--;
+			return;
+		}
+		readerSlots[readerSlot.index] = 0;
+	}
+
+	uint64_t retire() {
+		return ++readerEpoch;
+	}
+
+	static bool isReleasable(uint64_t epoch, int skipIndex, int skipOverflowNum) {
+		if (overflowReaderNum.load() > skipOverflowNum) { return false; }
+
+		for (int i = 0; i < readerSlotNum; i++) {
+			if (i == skipIndex) { continue; }
+
+			uint64_t enterEpoch = readerSlots[i].load();
+			if (enterEpoch != 0 && enterEpoch < epoch) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool isReleasable(uint64_t epoch) {
+		return isReleasable(epoch, -1, 0);
+	}
+
+	void waitForReaders() {
+		/** Readers Of This Thread Are Its Own Business */
+		uint64_t epoch = retire();
+		bool reading = readerSlot.depth > 0;
+		int skipIndex = reading ? readerSlot.index : -1;
+		int skipOverflowNum = (reading && readerSlot.index < 0) ? 1 : 0;
+		while (!isReleasable(epoch, skipIndex, skipOverflowNum)) {
+			juce::Thread::sleep(1);
+		}
+	}
+
+	/** Audio Blocks And Editors Exclude Each Other Without The Audio Thread Ever Waiting */
+	static std::atomic<int> audioBlockNum = 0;
+	static std::atomic<int> audioEditorNum = 0;
+	static thread_local int audioBlockDepth = 0;
+	static thread_local int audioEditDepth = 0;
+
+	ScopedAudioBlock::ScopedAudioBlock() {
+		audioBlockDepth++;
+		audioBlockNum++;
+		if (audioEditorNum.load() > 0) {
+			audioBlockNum--;
+			this->editing = true;
+		}
+	}
+
+	ScopedAudioBlock::~ScopedAudioBlock() {
+		if (!this->editing) {
+			audioBlockNum--;
+		}
+		audioBlockDepth--;
+	}
+
+	bool ScopedAudioBlock::canProcess() const {
+		return !this->editing;
+	}
+
+	ScopedAudioWriteLock::ScopedAudioWriteLock(juce::ReadWriteLock& lock)
+		: locker(lock) {
+		if (audioEditDepth++ > 0) { return; }
+
+		/** Waiting Inside A Block Would Wait For Itself */
+		if (audioBlockDepth > 0) {
+			jassertfalse;
+			return;
+		}
+
+		this->editing = true;
+		audioEditorNum++;
+
+		/** Blocks Are Short, So Yield Before Sleeping */
+		for (int i = 0; audioBlockNum.load() > 0; i++) {
+			if (i < 100) {
+				juce::Thread::yield();
+			}
+			else {
+				juce::Thread::sleep(1);
+			}
+		}
+	}
+
+	ScopedAudioWriteLock::~ScopedAudioWriteLock() {
+		if (this->editing) {
+			audioEditorNum--;
+		}
+		audioEditDepth--;
 	}
 }
@@ -8,5 +8,69 @@ namespace audioLock {
 	juce::ReadWriteLock& getPluginLock();
 	juce::ReadWriteLock& getPositionLock();
 	juce::ReadWriteLock& getAudioControlLock();
-	juce::ReadWriteLock& getLevelMeterLock();
+
+	/**
+	 * @brief	Marks the current thread as processing one audio block. Wait-free, takes no lock.
+	 *			The block must be skipped if canProcess() is false, some thread is editing the audio state then.
+	 */
+	class ScopedAudioBlock final {
+	public:
+		ScopedAudioBlock();
+		~ScopedAudioBlock();
+
+		bool canProcess() const;
+
+	private:
+		bool editing = false;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedAudioBlock)
+	};
+
+	/**
+	 * @brief	Write lock of state which the audio thread reads without locking. Reentrant.
+	 *			After taking the lock, waits until the running audio blocks have finished.
+	 *			Blocks starting before the lock is released are skipped, so keep it short.
+	 *			Never take this inside an audio block.
+	 */
+	class ScopedAudioWriteLock final {
+	public:
+		ScopedAudioWriteLock() = delete;
+		explicit ScopedAudioWriteLock(juce::ReadWriteLock& lock);
+		~ScopedAudioWriteLock();
+
+	private:
+		const juce::ScopedWriteLock locker;
+		bool editing = false;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedAudioWriteLock)
+	};
+
+	/**
+	 * @brief	Marks the current thread as reading data shared with the audio thread. Wait-free and reentrant.
+	 *			Data replaced by another thread is only freed after every reader that could see it has left.
+	 *			Never wait for other threads inside.
+	 */
+	class ScopedReader final {
+	public:
+		ScopedReader();
+		~ScopedReader();
+
+	private:
+		JUCE_DECLARE_NON_COPYABLE(ScopedReader)
+	};
+
+	/**
+	 * @brief	Start the grace period of data which was just replaced.
+	 * @return	The epoch to check with isReleasable().
+	 */
+	uint64_t retire();
+	/**
+	 * @brief	Whether every reader which could see the data retired at the epoch has left.
+	 */
+	bool isReleasable(uint64_t epoch);
+	/**
+	 * @brief	Wait until every reader of other threads which is active now has left.
+	 *			Never call this on the audio thread.
+	 */
+	void waitForReaders();
 }
@@ -0,0 +1,94 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "AudioLock.h"
+
+/**
+ * @brief	Read-copy-update holder for state read by the audio thread.
+ *			Realtime readers get the current state with one atomic load and never block,
+ *			so the audio thread and its workers can read it at the same time.
+ *			Editing threads publish new states and old ones are freed off the audio thread
+ *			after every reader that could see them has left.
+ */
+template<typename T>
+class AudioSnapshot final {
+public:
+	AudioSnapshot() : AudioSnapshot(std::make_unique<T>()) {};
+	explicit AudioSnapshot(std::unique_ptr<T> initState)
+		: current(initState.release()) {};
+	~AudioSnapshot() {
+		juce::GenericScopedLock locker(this->writeLock);
+		this->retired.clear();
+		delete this->current.exchange(nullptr);
+	};
+
+	/**
+	 * @brief	Replace the current state. Never call this on the audio thread.
+	 */
+	void publish(std::unique_ptr<T> state) {
+		juce::GenericScopedLock locker(this->writeLock);
+
+		/** Swap State */
+		auto old = this->current.exchange(state.release());
+		this->retired.push_back({ audioLock::retire(), std::unique_ptr<T>(old) });
+
+		/** Release Unused States */
+		this->reclaim();
+	};
+
+	/**
+	 * @brief	Copy the current state, modify it and publish the copy.
+	 */
+	template<typename Func>
+	void update(Func&& func) {
+		juce::GenericScopedLock locker(this->writeLock);
+
+		auto state = std::make_unique<T>(*(this->current.load()));
+		func(*state);
+		this->publish(std::move(state));
+	};
+
+	/**
+	 * @brief	Access the current state from a non-realtime thread.
+	 */
+	template<typename Func>
+	auto read(Func&& func) const {
+		juce::GenericScopedLock locker(this->writeLock);
+		return func(*(this->current.load()));
+	};
+
+	/**
+	 * @brief	Access the current state from the audio thread or its workers.
+	 */
+	class ScopedRealtimeAccess final {
+	public:
+		ScopedRealtimeAccess() = delete;
+		explicit ScopedRealtimeAccess(AudioSnapshot& snapshot)
+			: state(snapshot.current.load()) {};
+
+		T* get() const noexcept { return this->state; };
+		T* operator->() const noexcept { return this->state; };
+		T& operator*() const noexcept { return *(this->state); };
+
+	private:
+		audioLock::ScopedReader reader;
+		T* state = nullptr;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedRealtimeAccess)
+	};
+
+private:
+	std::atomic<T*> current = nullptr;
+
+	mutable juce::CriticalSection writeLock;
+	/** Retire Epoch, State */
+	std::vector<std::tuple<uint64_t, std::unique_ptr<T>>> retired;
+
+	void reclaim() {
+		/** Keep States Still Used By Realtime Readers */
+		std::erase_if(this->retired,
+			[](const auto& item) { return audioLock::isReleasable(std::get<0>(item)); });
+	};
+
+	JUCE_DECLARE_NON_COPYABLE(AudioSnapshot)
+};
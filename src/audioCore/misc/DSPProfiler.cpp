@@ -0,0 +1,167 @@
+﻿#include "DSPProfiler.h"
+
+/** Time Of Nested Timers On The Current Thread */
+static thread_local int64_t childTicks = 0;
+
+DSPProfiler::Node::Node() {
+	/** Slot 0 Means No Node, Nodes Without A Free Slot Are Never Blamed */
+	for (uint32_t i = 1; i < Node::slotNum; i++) {
+		Node* expected = nullptr;
+		if (Node::slots[i].compare_exchange_strong(expected, this)) {
+			this->slot = i;
+			break;
+		}
+	}
+}
+
+DSPProfiler::Node::~Node() {
+	if (this->slot > 0) {
+		Node::slots[this->slot] = nullptr;
+	}
+}
+
+std::array<std::atomic<DSPProfiler::Node*>, DSPProfiler::Node::slotNum> DSPProfiler::Node::slots{};
+
+DSPProfiler::ScopedTimer::ScopedTimer(Node& node)
+	: node(node) {
+	this->parentChildTicks = childTicks;
+	childTicks = 0;
+	this->startTicks = juce::Time::getHighResolutionTicks();
+}
+
+DSPProfiler::ScopedTimer::~ScopedTimer() {
+	int64_t totalTicks = juce::Time::getHighResolutionTicks() - this->startTicks;
+	int64_t selfTicks = totalTicks - childTicks;
+	childTicks = this->parentChildTicks + totalTicks;
+
+	if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+		profiler->push(this->node, totalTicks);
+		profiler->blame(this->node, selfTicks);
+	}
+}
+
+DSPProfiler::ScopedBlock::ScopedBlock(int numSamples, double sampleRate) {
+	if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+		profiler->deadline = (sampleRate > 0) ? (numSamples / sampleRate) : 0;
+		profiler->blockMax = 0;
+	}
+	childTicks = 0;
+	this->startTicks = juce::Time::getHighResolutionTicks();
+}
+
+DSPProfiler::ScopedBlock::~ScopedBlock() {
+	int64_t totalTicks = juce::Time::getHighResolutionTicks() - this->startTicks;
+
+	if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+		profiler->push(profiler->callbackNode, totalTicks);
+
+		/** Blame The Slowest Node For Missing The Deadline */
+		double deadline = profiler->deadline;
+		if (deadline > 0 && juce::Time::highResolutionTicksToSeconds(totalTicks) > deadline) {
+			profiler->callbackNode.xrunNum++;
+			uint32_t slot = (uint32_t)(profiler->blockMax.load() & 0xFFFFFFFF);
+			if (slot > 0) {
+				if (auto node = Node::slots[slot].load()) {
+					node->xrunNum++;
+				}
+			}
+		}
+		profiler->blockMax = 0;
+	}
+}
+
+void DSPProfiler::push(Node& node, int64_t ticks) {
+	/** Clear Data Before Reset */
+	uint64_t currentEpoch = this->epoch;
+	if (node.epoch != currentEpoch) {
+		for (auto& i : node.ring) {
+			i.store(0, std::memory_order_relaxed);
+		}
+		node.writeIndex = 0;
+		node.worst = 0;
+		node.xrunNum = 0;
+		node.epoch = currentEpoch;
+	}
+
+	/** Write Ring */
+	float seconds = (float)juce::Time::highResolutionTicksToSeconds(ticks);
+	uint32_t index = node.writeIndex.load(std::memory_order_relaxed);
+	node.ring[index % Node::ringSize].store(seconds, std::memory_order_relaxed);
+	node.writeIndex.store(index + 1, std::memory_order_release);
+	if (seconds > node.worst.load(std::memory_order_relaxed)) {
+		node.worst.store(seconds, std::memory_order_relaxed);
+	}
+}
+
+void DSPProfiler::blame(Node& node, int64_t selfTicks) {
+	if (node.slot == 0) { return; }
+
+	/** Nodes May Run On Render Threads At The Same Time, So Ticks And Node Are Set By One CAS */
+	uint64_t ticks = (uint64_t)std::clamp<int64_t>(selfTicks, 0, UINT32_MAX);
+	uint64_t packed = (ticks << 32) | node.slot;
+	uint64_t current = this->blockMax;
+	while (packed > current
+		&& !this->blockMax.compare_exchange_weak(current, packed)) {}
+}
+
+const DSPProfiler::Load DSPProfiler::getLoad(const Node& node) const {
+	Load result;
+	if (node.epoch != this->epoch) { return result; }
+
+	/** Copy Ring */
+	uint32_t writeIndex = node.writeIndex.load(std::memory_order_acquire);
+	int num = (int)std::min<uint32_t>(writeIndex, Node::ringSize);
+	if (num <= 0) { return result; }
+
+	std::array<float, Node::ringSize> times{};
+	double sum = 0;
+	for (int i = 0; i < num; i++) {
+		times[i] = node.ring[i].load(std::memory_order_relaxed);
+		sum += times[i];
+	}
+
+	/** Statistics */
+	int p99Index = std::max(0, (int)std::ceil(num * 0.99) - 1);
+	std::nth_element(times.begin(), times.begin() + p99Index, times.begin() + num);
+
+	result.average = sum / num;
+	result.p99 = times[p99Index];
+	result.worst = node.worst;
+	result.xrunNum = node.xrunNum;
+
+	double deadline = this->deadline;
+	if (deadline > 0) {
+		result.averageShare = result.average / deadline;
+		result.p99Share = result.p99 / deadline;
+		result.worstShare = result.worst / deadline;
+	}
+
+	return result;
+}
+
+const DSPProfiler::Load DSPProfiler::getCallbackLoad() const {
+	return this->getLoad(this->callbackNode);
+}
+
+void DSPProfiler::reset() {
+	/** Nodes Are Cleared By The Audio Thread On Their Next Block */
+	this->epoch++;
+}
+
+DSPProfiler* DSPProfiler::getInstance() {
+	return DSPProfiler::instance ? DSPProfiler::instance
+		: (DSPProfiler::instance = new DSPProfiler{});
+}
+
+DSPProfiler* DSPProfiler::getInstanceWithoutCreate() {
+	return DSPProfiler::instance;
+}
+
+void DSPProfiler::releaseInstance() {
+	if (DSPProfiler::instance) {
+		delete DSPProfiler::instance;
+		DSPProfiler::instance = nullptr;
+	}
+}
+
+DSPProfiler* DSPProfiler::instance = nullptr;
@@ -0,0 +1,101 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @brief	Times graph nodes in each audio block with very low overhead.
+ *			Each node keeps its recent times in a ring written only by the audio thread,
+ *			so readers never block the audio thread.
+ */
+class DSPProfiler final : private juce::DeletedAtShutdown {
+public:
+	DSPProfiler() = default;
+
+	/** Processing Time In Seconds, Including Child Nodes */
+	struct Load final {
+		double average = 0, p99 = 0, worst = 0;
+		/** Share Of The Block Deadline */
+		double averageShare = 0, p99Share = 0, worstShare = 0;
+		/** Blocks Over The Deadline In Which This Node Took The Most Time By Itself */
+		uint64_t xrunNum = 0;
+	};
+
+	class Node final {
+	public:
+		Node();
+		~Node();
+
+	private:
+		friend class DSPProfiler;
+
+		/** Nodes Are Blamed By Slot, So The Slot And Its Time Fit In One Atomic */
+		static constexpr uint32_t slotNum = 4096;
+		static std::array<std::atomic<Node*>, slotNum> slots;
+		uint32_t slot = 0;
+
+		static constexpr int ringSize = 256;
+		std::array<std::atomic<float>, ringSize> ring{};
+		std::atomic<uint32_t> writeIndex = 0;
+		std::atomic<float> worst = 0;
+		std::atomic<uint64_t> xrunNum = 0;
+		std::atomic<uint64_t> epoch = 0;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Node)
+	};
+
+	/**
+	 * @brief	Time a node in the scope. Time of nested timers is excluded when blaming xruns.
+	 */
+	class ScopedTimer final {
+	public:
+		ScopedTimer() = delete;
+		explicit ScopedTimer(Node& node);
+		~ScopedTimer();
+
+	private:
+		Node& node;
+		int64_t startTicks = 0, parentChildTicks = 0;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedTimer)
+	};
+
+	/**
+	 * @brief	Time a whole audio callback and check it against the block deadline.
+	 */
+	class ScopedBlock final {
+	public:
+		ScopedBlock() = delete;
+		ScopedBlock(int numSamples, double sampleRate);
+		~ScopedBlock();
+
+	private:
+		int64_t startTicks = 0;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedBlock)
+	};
+
+	const Load getLoad(const Node& node) const;
+	const Load getCallbackLoad() const;
+	void reset();
+
+private:
+	Node callbackNode;
+	std::atomic<double> deadline = 0;
+	std::atomic<uint64_t> epoch = 0;
+
+	/** Self Ticks In The High Half And Node Slot In The Low Half Of The Slowest Node In The Current Block */
+	std::atomic<uint64_t> blockMax = 0;
+
+	void push(Node& node, int64_t ticks);
+	void blame(Node& node, int64_t selfTicks);
+
+public:
+	static DSPProfiler* getInstance();
+	static DSPProfiler* getInstanceWithoutCreate();
+	static void releaseInstance();
+
+private:
+	static DSPProfiler* instance;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DSPProfiler)
+};
@@ -0,0 +1,134 @@
+﻿#include "DummyAudioDevice.h"
+
+DummyAudioIODeviceType::DummyAudioIODeviceType()
+	: AudioIODeviceType(DummyAudioIODeviceType::typeName) {}
+
+void DummyAudioIODeviceType::scanForDevices() {}
+
+juce::StringArray DummyAudioIODeviceType::getDeviceNames(bool /*wantInputNames*/) const {
+	return { DummyAudioIODeviceType::deviceName };
+}
+
+int DummyAudioIODeviceType::getDefaultDeviceIndex(bool /*forInput*/) const {
+	return 0;
+}
+
+int DummyAudioIODeviceType::getIndexOfDevice(juce::AudioIODevice* device, bool /*asInput*/) const {
+	return dynamic_cast<DummyAudioIODevice*>(device) ? 0 : -1;
+}
+
+bool DummyAudioIODeviceType::hasSeparateInputsAndOutputs() const {
+	return false;
+}
+
+juce::AudioIODevice* DummyAudioIODeviceType::createDevice(
+	const juce::String& outputDeviceName, const juce::String& inputDeviceName) {
+	if (outputDeviceName == DummyAudioIODeviceType::deviceName
+		|| inputDeviceName == DummyAudioIODeviceType::deviceName) {
+		return new DummyAudioIODevice;
+	}
+	return nullptr;
+}
+
+DummyAudioIODevice::DummyAudioIODevice()
+	: AudioIODevice(DummyAudioIODeviceType::deviceName, DummyAudioIODeviceType::typeName) {}
+
+DummyAudioIODevice::~DummyAudioIODevice() {
+	this->close();
+}
+
+juce::StringArray DummyAudioIODevice::getOutputChannelNames() {
+	return { "Left", "Right" };
+}
+
+juce::StringArray DummyAudioIODevice::getInputChannelNames() {
+	return { "Left", "Right" };
+}
+
+juce::Array<double> DummyAudioIODevice::getAvailableSampleRates() {
+	return { 22050, 32000, 44100, 48000, 88200, 96000, 176400, 192000 };
+}
+
+juce::Array<int> DummyAudioIODevice::getAvailableBufferSizes() {
+	return { 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192 };
+}
+
+int DummyAudioIODevice::getDefaultBufferSize() {
+	return 512;
+}
+
+juce::String DummyAudioIODevice::open(const juce::BigInteger& inputChannels,
+	const juce::BigInteger& outputChannels,
+	double sampleRate, int bufferSizeSamples) {
+	this->inputChannels = inputChannels;
+	this->inputChannels.setRange(2, this->inputChannels.getHighestBit() + 1, false);
+	this->outputChannels = outputChannels;
+	this->outputChannels.setRange(2, this->outputChannels.getHighestBit() + 1, false);
+	if (sampleRate > 0) { this->sampleRate = sampleRate; }
+	if (bufferSizeSamples > 0) { this->bufferSize = bufferSizeSamples; }
+
+	this->opened = true;
+	return {};
+}
+
+void DummyAudioIODevice::close() {
+	this->stop();
+	this->opened = false;
+}
+
+bool DummyAudioIODevice::isOpen() {
+	return this->opened;
+}
+
+void DummyAudioIODevice::start(juce::AudioIODeviceCallback* callback) {
+	if (!this->opened || this->callback == callback) { return; }
+	this->stop();
+
+	if (callback) {
+		callback->audioDeviceAboutToStart(this);
+	}
+	this->callback = callback;
+}
+
+void DummyAudioIODevice::stop() {
+	if (auto ptr = this->callback) {
+		this->callback = nullptr;
+		ptr->audioDeviceStopped();
+	}
+}
+
+bool DummyAudioIODevice::isPlaying() {
+	return this->callback != nullptr;
+}
+
+juce::String DummyAudioIODevice::getLastError() {
+	return {};
+}
+
+int DummyAudioIODevice::getCurrentBufferSizeSamples() {
+	return this->bufferSize;
+}
+
+double DummyAudioIODevice::getCurrentSampleRate() {
+	return this->sampleRate;
+}
+
+int DummyAudioIODevice::getCurrentBitDepth() {
+	return 32;
+}
+
+juce::BigInteger DummyAudioIODevice::getActiveOutputChannels() const {
+	return this->outputChannels;
+}
+
+juce::BigInteger DummyAudioIODevice::getActiveInputChannels() const {
+	return this->inputChannels;
+}
+
+int DummyAudioIODevice::getOutputLatencyInSamples() {
+	return 0;
+}
+
+int DummyAudioIODevice::getInputLatencyInSamples() {
+	return 0;
+}
@@ -0,0 +1,65 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @brief	Audio device type without hardware, for headless hosts.
+ *			The device never calls back by itself, the engine is driven by offline rendering.
+ */
+class DummyAudioIODeviceType final : public juce::AudioIODeviceType {
+public:
+	DummyAudioIODeviceType();
+
+	static constexpr auto typeName = "Dummy";
+	static constexpr auto deviceName = "Dummy Device";
+
+	void scanForDevices() override;
+	juce::StringArray getDeviceNames(bool wantInputNames = false) const override;
+	int getDefaultDeviceIndex(bool forInput) const override;
+	int getIndexOfDevice(juce::AudioIODevice* device, bool asInput) const override;
+	bool hasSeparateInputsAndOutputs() const override;
+	juce::AudioIODevice* createDevice(const juce::String& outputDeviceName,
+		const juce::String& inputDeviceName) override;
+
+private:
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DummyAudioIODeviceType)
+};
+
+class DummyAudioIODevice final : public juce::AudioIODevice {
+public:
+	DummyAudioIODevice();
+	~DummyAudioIODevice() override;
+
+	juce::StringArray getOutputChannelNames() override;
+	juce::StringArray getInputChannelNames() override;
+	juce::Array<double> getAvailableSampleRates() override;
+	juce::Array<int> getAvailableBufferSizes() override;
+	int getDefaultBufferSize() override;
+
+	juce::String open(const juce::BigInteger& inputChannels,
+		const juce::BigInteger& outputChannels,
+		double sampleRate, int bufferSizeSamples) override;
+	void close() override;
+	bool isOpen() override;
+	void start(juce::AudioIODeviceCallback* callback) override;
+	void stop() override;
+	bool isPlaying() override;
+	juce::String getLastError() override;
+
+	int getCurrentBufferSizeSamples() override;
+	double getCurrentSampleRate() override;
+	int getCurrentBitDepth() override;
+	juce::BigInteger getActiveOutputChannels() const override;
+	juce::BigInteger getActiveInputChannels() const override;
+	int getOutputLatencyInSamples() override;
+	int getInputLatencyInSamples() override;
+
+private:
+	bool opened = false;
+	double sampleRate = 48000;
+	int bufferSize = 512;
+	juce::BigInteger inputChannels, outputChannels;
+	juce::AudioIODeviceCallback* callback = nullptr;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DummyAudioIODevice)
+};
@@ -0,0 +1,331 @@
+﻿#include "LevelMeter.h"
+#include "VMath.h"
+
+LevelMeter::LevelMeter(int channels, bool measureLoudness)
+	: channels(std::max(channels, 0)), measureLoudness(measureLoudness) {
+	/** Build Filter Before The Audio Thread Uses It */
+	LevelMeter::getTruePeakTaps();
+}
+
+double LevelMeter::Biquad::process(double x) {
+	double y = this->b0 * x + this->z1;
+	this->z1 = this->b1 * x - this->a1 * y + this->z2;
+	this->z2 = this->b2 * x - this->a2 * y;
+	return y;
+}
+
+void LevelMeter::process(const juce::AudioSampleBuffer& buffer, double sampleRate) {
+	if (!this->prepareBlock(sampleRate)) { return; }
+	if (buffer.getNumSamples() <= 0) { return; }
+
+	/** Sample Level */
+	int channelNum = std::min(buffer.getNumChannels(), (int)this->channels.size());
+	for (int i = 0; i < channelNum; i++) {
+		float peak = 0, rms = 0;
+		vMath::levelAudioData(buffer, 0, i, buffer.getNumSamples(), peak, rms);
+		this->processChannel(buffer, i, peak, rms);
+	}
+
+	this->processLoudness(buffer);
+}
+
+void LevelMeter::processWithGain(juce::AudioSampleBuffer& buffer, double sampleRate,
+	float* startGains, int gainChannels, float endGain) {
+	bool prepared = this->prepareBlock(sampleRate);
+	int numSamples = buffer.getNumSamples();
+	if (numSamples <= 0) { return; }
+
+	/** Gain Is Applied Even If The Meter Can't Measure */
+	gainChannels = std::min(gainChannels, buffer.getNumChannels());
+	int channelNum = prepared ? std::min(buffer.getNumChannels(), (int)this->channels.size()) : 0;
+	for (int i = 0; i < std::max(gainChannels, channelNum); i++) {
+		float peak = 0, rms = 0;
+		if (i < gainChannels) {
+			vMath::gainAndLevelAudioData(buffer, startGains[i], endGain,
+				0, i, numSamples, peak, rms);
+			startGains[i] = endGain;
+		}
+		else {
+			vMath::levelAudioData(buffer, 0, i, numSamples, peak, rms);
+		}
+
+		if (i < channelNum) {
+			this->processChannel(buffer, i, peak, rms);
+		}
+	}
+
+	if (prepared) {
+		this->processLoudness(buffer);
+	}
+}
+
+bool LevelMeter::prepareBlock(double sampleRate) {
+	/** Check Sample Rate And Reset */
+	if (sampleRate != this->sampleRate) {
+		this->prepare(sampleRate);
+	}
+	uint64_t epoch = this->resetRequest.load(std::memory_order_acquire);
+	if (epoch != this->resetEpoch) {
+		this->clear();
+		this->resetEpoch = epoch;
+	}
+	return this->sampleRate > 0;
+}
+
+void LevelMeter::processChannel(
+	const juce::AudioSampleBuffer& buffer, int channelIndex, float peak, float rms) {
+	auto& channel = this->channels[channelIndex];
+	int numSamples = buffer.getNumSamples();
+
+	/** Sample Level */
+	channel.rms.store(rms, std::memory_order_relaxed);
+	channel.peak.store(peak, std::memory_order_relaxed);
+
+	/** Peak Hold */
+	float hold = channel.peakHold.load(std::memory_order_relaxed);
+	if (peak >= hold || channel.holdRemain <= 0) {
+		hold = peak;
+		channel.holdRemain = this->holdSamples;
+	}
+	else {
+		channel.holdRemain -= numSamples;
+	}
+	channel.peakHold.store(hold, std::memory_order_relaxed);
+
+	/** True Peak By Polyphase Interpolation */
+	if (!this->measureLoudness) { return; }
+	auto& firTaps = LevelMeter::getTruePeakTaps();
+	auto data = buffer.getReadPointer(channelIndex);
+	float truePeak = peak;
+	for (int s = 0; s < numSamples; s++) {
+		int index = channel.historyIndex;
+		channel.history[index] = channel.history[index + tapsPerPhase] = data[s];
+		channel.historyIndex = (index + 1) % tapsPerPhase;
+
+		/** Oldest To Newest */
+		const float* window = &(channel.history[index + 1]);
+		for (int p = 0; p < oversampling; p++) {
+			float sum = 0;
+			for (int k = 0; k < tapsPerPhase; k++) {
+				sum += firTaps[p + k * oversampling] * window[tapsPerPhase - 1 - k];
+			}
+			truePeak = std::max(truePeak, std::abs(sum));
+		}
+	}
+	channel.truePeak.store(truePeak, std::memory_order_relaxed);
+	if (truePeak > channel.truePeakMax.load(std::memory_order_relaxed)) {
+		channel.truePeakMax.store(truePeak, std::memory_order_relaxed);
+	}
+}
+
+void LevelMeter::processLoudness(const juce::AudioSampleBuffer& buffer) {
+	if (!this->measureLoudness) { return; }
+
+	int channelNum = std::min(buffer.getNumChannels(), (int)this->channels.size());
+	int numSamples = buffer.getNumSamples();
+
+	/** Loudness In Gating Steps */
+	int pos = 0;
+	while (pos < numSamples) {
+		int length = std::min(numSamples - pos, this->gatingStep - this->gatingCount);
+
+		for (int i = 0; i < channelNum; i++) {
+			auto& channel = this->channels[i];
+			auto data = buffer.getReadPointer(i, pos);
+
+			double sum = 0;
+			for (int s = 0; s < length; s++) {
+				double y = channel.highPass.process(channel.shelf.process(data[s]));
+				sum += y * y;
+			}
+			this->gatingSum += sum;
+		}
+
+		this->gatingCount += length;
+		pos += length;
+
+		if (this->gatingCount >= this->gatingStep) {
+			this->pushGatingBlock(this->gatingSum / this->gatingStep);
+			this->gatingSum = 0;
+			this->gatingCount = 0;
+		}
+	}
+}
+
+int LevelMeter::getChannelNum() const {
+	return (int)this->channels.size();
+}
+
+const LevelMeter::Level LevelMeter::getLevel(int channel) const {
+	if (channel < 0 || channel >= this->channels.size()) { return {}; }
+	auto& data = this->channels[channel];
+
+	Level result;
+	result.rms = data.rms.load(std::memory_order_relaxed);
+	result.peak = data.peak.load(std::memory_order_relaxed);
+	result.peakHold = data.peakHold.load(std::memory_order_relaxed);
+	result.truePeak = data.truePeak.load(std::memory_order_relaxed);
+	result.truePeakMax = data.truePeakMax.load(std::memory_order_relaxed);
+	return result;
+}
+
+const LevelMeter::Loudness LevelMeter::getLoudness() const {
+	Loudness result;
+	result.momentary = this->momentary.load(std::memory_order_relaxed);
+	result.shortTerm = this->shortTerm.load(std::memory_order_relaxed);
+
+	/** Absolute Gated Mean */
+	double energy = 0;
+	uint64_t count = 0;
+	for (int i = 0; i < binNum; i++) {
+		count += this->binCount[i].load(std::memory_order_relaxed);
+		energy += this->binEnergy[i].load(std::memory_order_relaxed);
+	}
+	if (count == 0) { return result; }
+
+	/** Relative Gate, Resolved To The Histogram Step */
+	double gate = LevelMeter::toLoudness(energy / count) + relativeGate;
+	int startBin = std::clamp((int)std::floor((gate - absoluteGate) * binsPerLU), 0, binNum);
+
+	double gatedEnergy = 0;
+	uint64_t gatedCount = 0;
+	for (int i = startBin; i < binNum; i++) {
+		gatedCount += this->binCount[i].load(std::memory_order_relaxed);
+		gatedEnergy += this->binEnergy[i].load(std::memory_order_relaxed);
+	}
+	if (gatedCount > 0) {
+		result.integrated = LevelMeter::toLoudness(gatedEnergy / gatedCount);
+	}
+
+	return result;
+}
+
+void LevelMeter::reset() const {
+	this->resetRequest.fetch_add(1, std::memory_order_release);
+}
+
+void LevelMeter::prepare(double sampleRate) {
+	this->sampleRate = sampleRate;
+	this->clear();
+	if (sampleRate <= 0) { return; }
+
+	this->holdSamples = (int64_t)(peakHoldSeconds * sampleRate);
+	this->gatingStep = std::max((int)std::round(sampleRate * 0.1), 1);
+
+	/** K-Weighting Filters Of ITU-R BS.1770 For Any Sample Rate */
+	Biquad shelf, highPass;
+	{
+		double f0 = 1681.974450955533, gain = 3.999843853973347, q = 0.7071752369554196;
+		double k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+		double vh = std::pow(10.0, gain / 20.0);
+		double vb = std::pow(vh, 0.4996667741545416);
+		double a0 = 1.0 + k / q + k * k;
+		shelf.b0 = (vh + vb * k / q + k * k) / a0;
+		shelf.b1 = 2.0 * (k * k - vh) / a0;
+		shelf.b2 = (vh - vb * k / q + k * k) / a0;
+		shelf.a1 = 2.0 * (k * k - 1.0) / a0;
+		shelf.a2 = (1.0 - k / q + k * k) / a0;
+	}
+	{
+		double f0 = 38.13547087602444, q = 0.5003270373238773;
+		double k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+		double a0 = 1.0 + k / q + k * k;
+		highPass.b0 = 1.0;
+		highPass.b1 = -2.0;
+		highPass.b2 = 1.0;
+		highPass.a1 = 2.0 * (k * k - 1.0) / a0;
+		highPass.a2 = (1.0 - k / q + k * k) / a0;
+	}
+	for (auto& i : this->channels) {
+		i.shelf = shelf;
+		i.highPass = highPass;
+	}
+}
+
+void LevelMeter::clear() {
+	for (auto& i : this->channels) {
+		i.rms.store(0, std::memory_order_relaxed);
+		i.peak.store(0, std::memory_order_relaxed);
+		i.peakHold.store(0, std::memory_order_relaxed);
+		i.truePeak.store(0, std::memory_order_relaxed);
+		i.truePeakMax.store(0, std::memory_order_relaxed);
+
+		i.holdRemain = 0;
+		i.shelf.z1 = i.shelf.z2 = 0;
+		i.highPass.z1 = i.highPass.z2 = 0;
+		i.history.fill(0);
+		i.historyIndex = 0;
+	}
+
+	this->gatingCount = 0;
+	this->gatingSum = 0;
+	this->gatingRing.fill(0);
+	this->gatingIndex = 0;
+	this->gatingFilled = 0;
+
+	this->momentary.store(-INFINITY, std::memory_order_relaxed);
+	this->shortTerm.store(-INFINITY, std::memory_order_relaxed);
+	for (int i = 0; i < binNum; i++) {
+		this->binCount[i].store(0, std::memory_order_relaxed);
+		this->binEnergy[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+void LevelMeter::pushGatingBlock(double energy) {
+	this->gatingRing[this->gatingIndex] = energy;
+	this->gatingIndex = (this->gatingIndex + 1) % shortTermBlocks;
+	this->gatingFilled = std::min(this->gatingFilled + 1, shortTermBlocks);
+
+	auto mean = [this](int num) {
+		double sum = 0;
+		for (int i = 1; i <= num; i++) {
+			sum += this->gatingRing[(this->gatingIndex - i + shortTermBlocks) % shortTermBlocks];
+		}
+		return sum / num;
+		};
+
+	/** Momentary Window Is Also The Gating Block Of Integrated Loudness */
+	if (this->gatingFilled >= momentaryBlocks) {
+		double blockEnergy = mean(momentaryBlocks);
+		double loudness = LevelMeter::toLoudness(blockEnergy);
+		this->momentary.store((float)loudness, std::memory_order_relaxed);
+
+		if (loudness > absoluteGate) {
+			int bin = std::min((int)((loudness - absoluteGate) * binsPerLU), binNum - 1);
+			this->binCount[bin].store(
+				this->binCount[bin].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			this->binEnergy[bin].store(
+				this->binEnergy[bin].load(std::memory_order_relaxed) + blockEnergy, std::memory_order_relaxed);
+		}
+	}
+
+	if (this->gatingFilled >= shortTermBlocks) {
+		this->shortTerm.store((float)LevelMeter::toLoudness(mean(shortTermBlocks)), std::memory_order_relaxed);
+	}
+}
+
+double LevelMeter::toLoudness(double energy) {
+	if (energy <= 0) { return -INFINITY; }
+	return -0.691 + 10.0 * std::log10(energy);
+}
+
+const std::array<float, LevelMeter::taps>& LevelMeter::getTruePeakTaps() {
+	static const std::array<float, taps> result = [] {
+		std::array<float, taps> list{};
+
+		/** Blackman Windowed Sinc At The Original Nyquist, Each Phase Has Unity Gain */
+		constexpr double pi = juce::MathConstants<double>::pi;
+		double center = (LevelMeter::taps - 1) / 2.0;
+		for (int i = 0; i < LevelMeter::taps; i++) {
+			double x = (i - center) / oversampling;
+			double sinc = (x == 0) ? 1.0 : (std::sin(pi * x) / (pi * x));
+			double window = 0.42
+				- 0.5 * std::cos(2 * pi * i / (LevelMeter::taps - 1))
+				+ 0.08 * std::cos(4 * pi * i / (LevelMeter::taps - 1));
+			list[i] = (float)(sinc * window);
+		}
+
+		return list;
+		}();
+	return result;
+}
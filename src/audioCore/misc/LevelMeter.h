@@ -0,0 +1,117 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @brief	Level and loudness meter of an audio output.
+ *			Only the audio thread writes the meter. Values are published in per-channel atomic slots,
+ *			so readers never block the audio thread and never allocate.
+ */
+class LevelMeter final {
+public:
+	LevelMeter() = delete;
+	/**
+	 * @param measureLoudness	Measure true peak and loudness too. Only meters which display them need it.
+	 */
+	LevelMeter(int channels, bool measureLoudness);
+
+	/** Channel Levels In Gain */
+	struct Level final {
+		float rms = 0, peak = 0, peakHold = 0;
+		/** 4x Oversampled Peak Of The Last Block And The Max Since Reset */
+		float truePeak = 0, truePeakMax = 0;
+	};
+
+	/** EBU R128 Loudness In LUFS, -inf Before Enough Audio Is Measured */
+	struct Loudness final {
+		float momentary = -INFINITY, shortTerm = -INFINITY, integrated = -INFINITY;
+	};
+
+	/**
+	 * @brief	Measure a block. Only call this on the audio thread.
+	 */
+	void process(const juce::AudioSampleBuffer& buffer, double sampleRate);
+	/**
+	 * @brief	Multiply the first gainChannels channels by a gain which moves linearly from
+	 *			startGains to endGain, and measure the block in the same pass.
+	 *			startGains are set to endGain. Only call this on the audio thread.
+	 */
+	void processWithGain(juce::AudioSampleBuffer& buffer, double sampleRate,
+		float* startGains, int gainChannels, float endGain);
+
+	int getChannelNum() const;
+	const Level getLevel(int channel) const;
+	const Loudness getLoudness() const;
+
+	/**
+	 * @brief	Clear peak hold, max true peak and integrated loudness in the next block.
+	 */
+	void reset() const;
+
+	static constexpr double peakHoldSeconds = 1.5;
+
+private:
+	static constexpr int oversampling = 4;
+	static constexpr int tapsPerPhase = 12;
+	static constexpr int taps = oversampling * tapsPerPhase;
+
+	/** Gating Blocks Step By 100 ms, 400 ms Momentary And 3 s Short-Term Windows */
+	static constexpr int momentaryBlocks = 4;
+	static constexpr int shortTermBlocks = 30;
+
+	/** Gated Block Loudness Histogram From -70 LUFS In 0.1 LU Steps */
+	static constexpr double absoluteGate = -70;
+	static constexpr double relativeGate = -10;
+	static constexpr int binsPerLU = 10;
+	static constexpr int binNum = 800;
+
+	struct Biquad final {
+		double b0 = 1, b1 = 0, b2 = 0, a1 = 0, a2 = 0;
+		double z1 = 0, z2 = 0;
+
+		double process(double x);
+	};
+
+	struct Channel final {
+		/** Published */
+		std::atomic<float> rms = 0, peak = 0, peakHold = 0;
+		std::atomic<float> truePeak = 0, truePeakMax = 0;
+
+		/** Audio Thread State */
+		int64_t holdRemain = 0;
+		Biquad shelf, highPass;
+		/** Twice The Window, So Each Phase Reads A Contiguous Range */
+		std::array<float, tapsPerPhase * 2> history{};
+		int historyIndex = 0;
+	};
+	std::vector<Channel> channels;
+	const bool measureLoudness;
+
+	/** Audio Thread State */
+	double sampleRate = 0;
+	int64_t holdSamples = 0;
+	int gatingStep = 0, gatingCount = 0;
+	double gatingSum = 0;
+	std::array<double, shortTermBlocks> gatingRing{};
+	int gatingIndex = 0, gatingFilled = 0;
+	uint64_t resetEpoch = 0;
+
+	/** Published */
+	std::atomic<float> momentary = -INFINITY, shortTerm = -INFINITY;
+	std::array<std::atomic<uint32_t>, binNum> binCount{};
+	std::array<std::atomic<double>, binNum> binEnergy{};
+	mutable std::atomic<uint64_t> resetRequest = 0;
+
+	bool prepareBlock(double sampleRate);
+	void processChannel(const juce::AudioSampleBuffer& buffer, int channelIndex, float peak, float rms);
+	void processLoudness(const juce::AudioSampleBuffer& buffer);
+
+	void prepare(double sampleRate);
+	void clear();
+	void pushGatingBlock(double energy);
+
+	static double toLoudness(double energy);
+	static const std::array<float, taps>& getTruePeakTaps();
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeter)
+};
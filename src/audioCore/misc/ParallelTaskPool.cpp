@@ -0,0 +1,315 @@
+﻿#include "ParallelTaskPool.h"
+
+ParallelTaskPool::Worker::Worker(ParallelTaskPool* parent, const juce::String& name, int index)
+	: Thread(name), parent(parent), index(index) {}
+
+void ParallelTaskPool::Worker::run() {
+	/** Workers Run Audio Tasks */
+	juce::ScopedNoDenormals noDenormals;
+
+	while (!juce::Thread::threadShouldExit()) {
+		/** Wait For Batch */
+		this->startEvent.wait(-1);
+		if (juce::Thread::threadShouldExit()) { break; }
+
+		/** Work If The Batch Is Still Open */
+		if (this->parent->enterBatch()) {
+			this->parent->runBatch(this->index);
+			this->parent->leaveBatch();
+		}
+	}
+}
+
+void ParallelTaskPool::Worker::wake() {
+	this->startEvent.signal();
+}
+
+ParallelTaskPool::TaskGraph::TaskGraph(int taskNum)
+	: taskNum(std::max(taskNum, 0)),
+	outputs(this->taskNum), dependencyNum(this->taskNum, 0) {}
+
+void ParallelTaskPool::TaskGraph::addDependency(int task, int dependency) {
+	if (task < 0 || task >= this->taskNum) { return; }
+	if (dependency < 0 || dependency >= this->taskNum) { return; }
+	if (this->outputs[dependency].contains(task)) { return; }
+
+	this->outputs[dependency].add(task);
+	this->dependencyNum[task]++;
+	this->valid = false;
+}
+
+bool ParallelTaskPool::TaskGraph::prepare(int threadNum) {
+	/** Kahn's Algorithm, Ready Tasks Are Taken In Index Order */
+	std::vector<int> inDegree = this->dependencyNum;
+	std::vector<int> level(this->taskNum, 1);
+	std::set<int> ready;
+	for (int i = 0; i < this->taskNum; i++) {
+		if (inDegree[i] == 0) { ready.insert(i); }
+	}
+
+	this->order.clear();
+	this->roots.assign(ready.begin(), ready.end());
+	this->depth = 0;
+	while (!ready.empty()) {
+		int task = *(ready.begin());
+		ready.erase(ready.begin());
+
+		this->order.push_back(task);
+		this->depth = std::max(this->depth, level[task]);
+		for (auto i : this->outputs[task]) {
+			level[i] = std::max(level[i], level[task] + 1);
+			if (--inDegree[i] == 0) { ready.insert(i); }
+		}
+	}
+
+	/** Tasks In Loops Never Get Ready */
+	this->valid = (this->order.size() == this->taskNum);
+	if (!this->valid) {
+		this->order.resize(this->taskNum);
+		std::iota(this->order.begin(), this->order.end(), 0);
+		this->depth = this->taskNum;
+	}
+
+	/** Queues Hold Every Task At Most */
+	this->queues.clear();
+	for (int i = 0; i < threadNum; i++) {
+		auto queue = std::make_unique<Queue>();
+		queue->tasks.resize(this->taskNum);
+		this->queues.push_back(std::move(queue));
+	}
+	this->remaining = std::make_unique<std::atomic_int[]>(this->taskNum);
+
+	return this->valid;
+}
+
+int ParallelTaskPool::TaskGraph::getTaskNum() const {
+	return this->taskNum;
+}
+
+int ParallelTaskPool::TaskGraph::getDepth() const {
+	return this->depth;
+}
+
+void ParallelTaskPool::TaskGraph::push(int thread, int task) {
+	auto& queue = *(this->queues[thread]);
+	juce::SpinLock::ScopedLockType locker(queue.lock);
+	queue.tasks[queue.tail++] = task;
+}
+
+int ParallelTaskPool::TaskGraph::pop(int thread) {
+	/** Newest Task Of Own Queue Uses Data Still In Cache */
+	auto& queue = *(this->queues[thread]);
+	juce::SpinLock::ScopedLockType locker(queue.lock);
+	if (queue.head >= queue.tail) { return -1; }
+	return queue.tasks[--queue.tail];
+}
+
+int ParallelTaskPool::TaskGraph::steal(int thread) {
+	/** Oldest Task Of Other Queues */
+	auto& queue = *(this->queues[thread]);
+	juce::SpinLock::ScopedTryLockType locker(queue.lock);
+	if (!locker.isLocked()) { return -1; }
+	if (queue.head >= queue.tail) { return -1; }
+	return queue.tasks[queue.head++];
+}
+
+ParallelTaskPool::ParallelTaskPool(int threadNum, const juce::String& name, bool realtime) {
+	/** The Calling Thread Works Too */
+	for (int i = 1; i < threadNum; i++) {
+		auto worker = new Worker{ this, name + " " + juce::String(i), i };
+		this->workers.add(worker);
+		if (realtime) {
+			worker->startRealtimeThread(juce::Thread::RealtimeOptions{});
+		}
+		else {
+			worker->startThread();
+		}
+	}
+}
+
+ParallelTaskPool::~ParallelTaskPool() {
+	for (auto i : this->workers) {
+		i->signalThreadShouldExit();
+		i->wake();
+	}
+	for (auto i : this->workers) {
+		i->stopThread(3000);
+	}
+}
+
+void ParallelTaskPool::run(int taskNum, const Task& task) {
+	if (taskNum <= 0) { return; }
+
+	/** Run On Current Thread */
+	if (this->workers.isEmpty() || taskNum == 1) {
+		for (int i = 0; i < taskNum; i++) {
+			task(i);
+		}
+		return;
+	}
+
+	/** A Worker Still Inside The Last Batch */
+	if (!this->openBatch()) {
+		for (int i = 0; i < taskNum; i++) {
+			task(i);
+		}
+		return;
+	}
+
+	/** Prepare Batch */
+	this->currentGraph = nullptr;
+	this->currentTask = &task;
+	this->nextTask = 0;
+	this->doneTaskNum = 0;
+	this->taskNum = taskNum;
+	this->batchState = ParallelTaskPool::batchOpenFlag;
+
+	/** Wake Workers */
+	for (auto i : this->workers) {
+		i->wake();
+	}
+
+	/** Work On Current Thread */
+	this->runTasks();
+
+	/** Wait For Tasks Taken By Workers */
+	while (this->doneTaskNum < taskNum) {
+		juce::Thread::yield();
+	}
+
+	/** Late Workers Find The Batch Closed */
+	this->closeBatch();
+}
+
+void ParallelTaskPool::run(TaskGraph& graph, const Task& task) {
+	if (graph.taskNum <= 0) { return; }
+
+	/** Run On Current Thread In Dependency Order */
+	int threadNum = this->getThreadNum();
+	if (this->workers.isEmpty() || !graph.valid
+		|| graph.queues.size() < threadNum || graph.depth >= graph.taskNum) {
+		for (auto i : graph.order) {
+			task(i);
+		}
+		return;
+	}
+
+	/** A Worker Still Inside The Last Batch */
+	if (!this->openBatch()) {
+		for (auto i : graph.order) {
+			task(i);
+		}
+		return;
+	}
+
+	/** Reset Graph */
+	for (int i = 0; i < graph.taskNum; i++) {
+		graph.remaining[i] = graph.dependencyNum[i];
+	}
+	for (auto& i : graph.queues) {
+		i->head = i->tail = 0;
+	}
+	graph.doneNum = 0;
+
+	/** Deal Ready Tasks To Threads In Turn */
+	for (int i = 0; i < graph.roots.size(); i++) {
+		graph.push(i % threadNum, graph.roots[i]);
+	}
+
+	/** Prepare Batch */
+	this->currentTask = &task;
+	this->currentGraph = &graph;
+	this->batchState = ParallelTaskPool::batchOpenFlag;
+
+	/** Wake Workers */
+	for (auto i : this->workers) {
+		i->wake();
+	}
+
+	/** Work On Current Thread Until Every Task Is Done */
+	this->runGraphTasks(0);
+
+	/** Late Workers Find The Batch Closed */
+	this->closeBatch();
+}
+
+int ParallelTaskPool::getThreadNum() const {
+	return this->workers.size() + 1;
+}
+
+void ParallelTaskPool::waitForIdle() const {
+	while ((this->batchState & ~ParallelTaskPool::batchOpenFlag) != 0) {
+		juce::Thread::yield();
+	}
+}
+
+bool ParallelTaskPool::enterBatch() {
+	uint32_t state = this->batchState;
+	do {
+		if (!(state & ParallelTaskPool::batchOpenFlag)) { return false; }
+	} while (!this->batchState.compare_exchange_weak(state, state + 1));
+	return true;
+}
+
+void ParallelTaskPool::leaveBatch() {
+	this->batchState--;
+}
+
+bool ParallelTaskPool::openBatch() {
+	/** Workers Inside A Closed Batch Only Check That It Is Done, Which Takes A Moment */
+	for (int i = 0; i < 64; i++) {
+		if (this->batchState == 0) { return true; }
+		juce::Thread::yield();
+	}
+	return false;
+}
+
+void ParallelTaskPool::closeBatch() {
+	this->batchState &= ~ParallelTaskPool::batchOpenFlag;
+}
+
+void ParallelTaskPool::runBatch(int thread) {
+	if (this->currentGraph) {
+		this->runGraphTasks(thread);
+	}
+	else {
+		this->runTasks();
+	}
+}
+
+void ParallelTaskPool::runTasks() {
+	int num = this->taskNum;
+	for (int i = this->nextTask++; i < num; i = this->nextTask++) {
+		(*(this->currentTask))(i);
+		this->doneTaskNum++;
+	}
+}
+
+void ParallelTaskPool::runGraphTasks(int thread) {
+	auto& graph = *(this->currentGraph);
+	int threadNum = this->getThreadNum();
+
+	while (graph.doneNum < graph.taskNum) {
+		/** Get Task */
+		int task = graph.pop(thread);
+		for (int i = 1; task < 0 && i < threadNum; i++) {
+			task = graph.steal((thread + i) % threadNum);
+		}
+		if (task < 0) {
+			/** Wait For Running Tasks */
+			juce::Thread::yield();
+			continue;
+		}
+
+		/** Run */
+		(*(this->currentTask))(task);
+
+		/** Ready Tasks Depending On This */
+		for (auto i : graph.outputs[task]) {
+			if (--(graph.remaining[i]) == 0) {
+				graph.push(thread, i);
+			}
+		}
+		graph.doneNum++;
+	}
+}
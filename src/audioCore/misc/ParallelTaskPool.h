@@ -0,0 +1,130 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @brief	Persistent worker threads which run one batch of indexed tasks at a time.
+ *			The calling thread works on the batch too and returns when every task is done.
+ *			Workers are only woken, the caller never waits for a worker which got no task.
+ *			Nothing is allocated while running a batch.
+ */
+class ParallelTaskPool final {
+public:
+	ParallelTaskPool() = delete;
+	explicit ParallelTaskPool(int threadNum,
+		const juce::String& name = "Parallel Task Worker", bool realtime = false);
+	~ParallelTaskPool();
+
+	using Task = std::function<void(int)>;
+	/**
+	 * @brief	Call task(0) to task(taskNum - 1). The task must stay alive until this returns.
+	 */
+	void run(int taskNum, const Task& task);
+
+	/**
+	 * @brief	Tasks and the dependencies between them. A task starts after every task it depends on is done.
+	 *			Build and prepare the graph off the audio thread, running it allocates nothing.
+	 */
+	class TaskGraph final {
+	public:
+		TaskGraph() = default;
+		explicit TaskGraph(int taskNum);
+
+		void addDependency(int task, int dependency);
+
+		/**
+		 * @brief	Allocate the queues used to run the graph on threadNum threads.
+		 * @return	False if the dependencies form a loop. The graph then runs in index order on one thread.
+		 */
+		bool prepare(int threadNum);
+
+		int getTaskNum() const;
+		/**
+		 * @brief	Get the number of tasks on the longest dependency chain.
+		 */
+		int getDepth() const;
+
+	private:
+		friend class ParallelTaskPool;
+
+		int taskNum = 0, depth = 0;
+		std::vector<juce::Array<int>> outputs;
+		std::vector<int> dependencyNum;
+
+		/** Tasks in dependency order, used when running on one thread */
+		std::vector<int> order;
+		/** Tasks without dependencies */
+		std::vector<int> roots;
+		bool valid = false;
+
+		/** Each thread takes tasks from the back of its own queue and steals from the front of others */
+		struct Queue final {
+			juce::SpinLock lock;
+			std::vector<int> tasks;
+			int head = 0, tail = 0;
+		};
+		std::vector<std::unique_ptr<Queue>> queues;
+		std::unique_ptr<std::atomic_int[]> remaining;
+		std::atomic_int doneNum = 0;
+
+		void push(int thread, int task);
+		int pop(int thread);
+		int steal(int thread);
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TaskGraph)
+	};
+	/**
+	 * @brief	Run every task of the graph with work stealing. The task must stay alive until this returns.
+	 *			Which thread runs a task changes between runs, so tasks should only write their own outputs.
+	 */
+	void run(TaskGraph& graph, const Task& task);
+
+	/**
+	 * @brief	Get the number of threads working on a batch, including the calling thread.
+	 */
+	int getThreadNum() const;
+
+	/**
+	 * @brief	Wait until no worker is inside a finished batch.
+	 *			Call this before destroying a task or graph which was run. Never call this on the audio thread.
+	 */
+	void waitForIdle() const;
+
+private:
+	class Worker final : public juce::Thread {
+	public:
+		Worker() = delete;
+		Worker(ParallelTaskPool* parent, const juce::String& name, int index);
+
+		void run() override;
+		void wake();
+
+	private:
+		ParallelTaskPool* const parent;
+		const int index;
+		juce::WaitableEvent startEvent;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+	};
+	juce::OwnedArray<Worker> workers;
+
+	const Task* currentTask = nullptr;
+	TaskGraph* currentGraph = nullptr;
+	std::atomic_int taskNum = 0;
+	std::atomic_int nextTask = 0;
+	std::atomic_int doneTaskNum = 0;
+
+	/** Open flag and the number of workers inside the batch */
+	static constexpr uint32_t batchOpenFlag = 0x80000000u;
+	std::atomic<uint32_t> batchState = 0;
+	bool enterBatch();
+	void leaveBatch();
+	bool openBatch();
+	void closeBatch();
+
+	void runBatch(int thread);
+	void runTasks();
+	void runGraphTasks(int thread);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParallelTaskPool)
+};
@@ -4,14 +4,46 @@
 #include "../uiCallback/UICallback.h"
 #include "../misc/AudioLock.h"
 
+MovablePlayHead::MovablePlayHead() {
+	this->publishPosition();
+	this->updateTempoSyncState();
+}
+
 juce::Optional<juce::AudioPlayHead::PositionInfo> MovablePlayHead::getPosition() const {
+	/** Copy Published Position, Retry If It Was Written Meanwhile */
+	juce::AudioPlayHead::PositionInfo result;
+	uint32_t seq = 0;
+	do {
+		seq = this->publishedPositionSeq.load(std::memory_order_acquire);
+		result = this->publishedPosition;
+		std::atomic_thread_fence(std::memory_order_acquire);
+	} while ((seq & 1) || seq != this->publishedPositionSeq.load(std::memory_order_relaxed));
+
 	/** Get System Clock Nanoseconds */
 	std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
 	std::chrono::nanoseconds ns
 		= std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch());
-	this->position.setHostTimeNs((uint64_t)ns.count());
+	result.setHostTimeNs((uint64_t)ns.count());
 
-	return juce::makeOptional(this->position);
+	return juce::makeOptional(result);
+}
+
+void MovablePlayHead::beginBlock() {
+	this->blockProcessing = true;
+
+	/** Publish Edits Made During The Last Block, Unless An Edit Is Running */
+	juce::ScopedTryReadLock locker(audioLock::getPositionLock());
+	if (locker.isLocked()) {
+		this->publishPosition();
+	}
+}
+
+void MovablePlayHead::endBlock(bool positionLocked) {
+	this->blockProcessing = false;
+
+	if (positionLocked) {
+		this->publishPosition();
+	}
 }
 
 bool MovablePlayHead::canControlTransport() {
@@ -26,6 +58,7 @@ void MovablePlayHead::transportPlay(bool shouldStartPlaying) {
 		this->position.setIsRecording(false);
 		this->overflowFlag = false;
 	}
+	this->positionChanged();
 
 	UICallbackAPI<bool>::invoke(
 		UICallbackType::PlayStateChanged, shouldStartPlaying);
@@ -37,6 +70,7 @@ void MovablePlayHead::transportRecord(bool shouldStartRecording) {
 	if (shouldStartRecording) {
 		this->position.setIsPlaying(true);
 	}
+	this->positionChanged();
 
 	UICallbackAPI<bool>::invoke(
 		UICallbackType::RecordStateChanged, shouldStartRecording);
@@ -50,6 +84,7 @@ void MovablePlayHead::transportRewind() {
 	this->position.setPpqPositionOfLastBarStart(0);
 	this->position.setPpqPosition(0);
 	this->overflowFlag = false;
+	this->positionChanged();
 }
 
 void MovablePlayHead::setTimeFormat(short ticksPerQuarter) {
@@ -63,11 +98,13 @@ void MovablePlayHead::setSampleRate(double sampleRate) {
 
 	this->position.setTimeInSamples(
 		(int64_t)std::floor(this->position.getTimeInSeconds().orFallback(0) * this->sampleRate));
+	this->positionChanged();
 }
 
 void MovablePlayHead::setLooping(bool looping) {
 	juce::ScopedWriteLock locker(audioLock::getPositionLock());
 	this->position.setIsLooping(looping);
+	this->positionChanged();
 }
 
 void MovablePlayHead::setLoopPointsInSeconds(const std::tuple<double, double>& points) {
@@ -79,6 +116,7 @@ void MovablePlayHead::setLoopPointsInSeconds(const std::tuple<double, double>& p
 
 	this->position.setLoopPoints(
 		juce::AudioPlayHead::LoopPoints{ startQuarter, endQuarter });
+	this->positionChanged();
 }
 
 void MovablePlayHead::setPositionInSeconds(double time) {
@@ -418,6 +456,7 @@ void MovablePlayHead::updatePositionByTimeInSecond() {
 	auto [barCount, barPpq] = this->toBarQ(timeQuarter);
 	this->position.setBarCount(barCount);
 	this->position.setPpqPositionOfLastBarStart(barPpq);
+	this->positionChanged();
 }
 
 void MovablePlayHead::updatePositionByTimeInSample() {
@@ -430,6 +469,7 @@ void MovablePlayHead::updatePositionByTimeInSample() {
 	auto [barCount, barPpq] = this->toBarQ(timeQuarter);
 	this->position.setBarCount(barCount);
 	this->position.setPpqPositionOfLastBarStart(barPpq);
+	this->positionChanged();
 }
 
 int MovablePlayHead::getTempoInsertIndex(double time) const {
@@ -485,6 +525,8 @@ void MovablePlayHead::updateLabelTypeTemp() {
 			continue;
 		}
 	}
+
+	this->updateTempoSyncState();
 }
 
 int MovablePlayHead::getTempoTypeLabelNum() const {
@@ -509,6 +551,64 @@ int MovablePlayHead::getBeatTypeLabelIndex(int typeIndex) const {
 	return -1;
 }
 
+AudioSnapshot<MovablePlayHead::TempoSyncState>& MovablePlayHead::getTempoSyncState() {
+	return this->tempoSyncState;
+}
+
+void MovablePlayHead::positionChanged() {
+	/** Published By The Audio Thread At The Next Block */
+	if (this->blockProcessing) { return; }
+
+	this->publishPosition();
+}
+
+void MovablePlayHead::publishPosition() {
+	uint32_t seq = this->publishedPositionSeq.load(std::memory_order_relaxed);
+	this->publishedPositionSeq.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	this->publishedPosition = this->position;
+
+	this->publishedPositionSeq.store(seq + 2, std::memory_order_release);
+}
+
+void MovablePlayHead::updateTempoSyncState() {
+	auto state = std::make_unique<TempoSyncState>();
+
+	/** At Least 2 Tempo Sync Points */
+	int tempoNum = this->getTempoTypeLabelNum();
+	if (tempoNum < 1) {
+		state->tempos.push_back({ 0, 0 });
+	}
+	for (int i = 0; i < tempoNum; i++) {
+		double timeSec = this->getTempoLabelTime(this->getTempoTypeLabelIndex(i));
+		state->tempos.push_back({ timeSec, this->toQuarter(timeSec) });
+	}
+
+	/** Last Tempo Sync Point */
+	{
+		double timeSec = 0;
+		if (int num = this->getTempoLabelNum()) {
+			timeSec = this->getTempoLabelTime(num - 1);
+		}
+		timeSec += 1;
+		state->tempos.push_back({ timeSec, this->toQuarter(timeSec) });
+	}
+
+	/** At Least 1 Bar Signature */
+	for (int i = 0; i < this->getBeatTypeLabelNum(); i++) {
+		int labelIndex = this->getBeatTypeLabelIndex(i);
+		auto [numerator, denominator] = this->getTempoLabelBeat(labelIndex);
+		double timeQuarter = this->toQuarter(this->getTempoLabelTime(labelIndex));
+		state->bars.push_back({ numerator, denominator, timeQuarter });
+	}
+	if (state->bars.empty()) {
+		state->bars.push_back({ 4, 4, 0 });
+	}
+
+	this->tempoSyncState.publish(std::move(state));
+}
+
 PlayPosition* PlayPosition::getInstance() {
 	return PlayPosition::instance ? PlayPosition::instance : (PlayPosition::instance = new PlayPosition());
 }
@@ -2,14 +2,31 @@
 
 #include <JuceHeader.h>
 #include "TempoTemp.h"
+#include "AudioSnapshot.h"
 
 class MovablePlayHead : public juce::AudioPlayHead {
 public:
-	MovablePlayHead() = default;
+	MovablePlayHead();
 	~MovablePlayHead() override = default;
 
+	/**
+	 * @brief	Get the published position without locking. Safe on any thread.
+	 *			Edits made while a block is processed are published with the next block,
+	 *			so every node of one block sees the same position.
+	 */
 	juce::Optional<juce::AudioPlayHead::PositionInfo> getPosition() const override;
 
+	/**
+	 * @brief	Called by the audio thread before the graph of a block is processed.
+	 */
+	void beginBlock();
+	/**
+	 * @brief	Called by the audio thread after the graph of a block is processed, before moving the position.
+	 * @param positionLocked	Whether the caller holds the position write lock,
+	 *							edits made during the block are published then.
+	 */
+	void endBlock(bool positionLocked);
+
 	bool canControlTransport() override;
 	void transportPlay(bool shouldStartPlaying) override;
 	void transportRecord(bool shouldStartRecording) override;
@@ -72,8 +89,18 @@ public:
 	int getTempoTypeLabelIndex(int typeIndex) const;
 	int getBeatTypeLabelIndex(int typeIndex) const;
 
+	/** Tempo sync points and bar signatures for readers which can't take the position lock */
+	struct TempoSyncState final {
+		/** timeInSec, timeInQuarter */
+		std::vector<std::tuple<double, double>> tempos;
+		/** numerator, denominator, timeInQuarter */
+		std::vector<std::tuple<int, int, double>> bars;
+	};
+	AudioSnapshot<TempoSyncState>& getTempoSyncState();
+
 protected:
-	mutable juce::AudioPlayHead::PositionInfo position;
+	/** Edited under the position write lock */
+	juce::AudioPlayHead::PositionInfo position;
 	juce::Array<juce::MidiMessage> tempos;
 	TempoTemp tempoTemp;
 	std::atomic_short timeFormat = 480;
@@ -89,7 +116,22 @@ protected:
 	void updatePositionByTimeInSecond();
 	void updatePositionByTimeInSample();
 
+	/**
+	 * @brief	Publish the edited position unless a block is being processed. Call with the position write lock.
+	 */
+	void positionChanged();
+
 private:
+	/** Copy of the position read without locking, guarded by a sequence counter */
+	juce::AudioPlayHead::PositionInfo publishedPosition;
+	std::atomic<uint32_t> publishedPositionSeq = 0;
+	std::atomic_bool blockProcessing = false;
+
+	AudioSnapshot<TempoSyncState> tempoSyncState;
+
+	void publishPosition();
+	void updateTempoSyncState();
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MovablePlayHead)
 };
 
@@ -0,0 +1,416 @@
+﻿#include "RenderEngine.h"
+
+#include "PlayPosition.h"
+#include "AudioLock.h"
+#include "VMath.h"
+#include "../graph/MainGraph.h"
+
+RenderEngine::RenderEngine(std::shared_ptr<ParallelTaskPool> pool)
+	: pool(pool),
+	task([this](int index) {
+		int groupNum = this->sourceGroups.size();
+		if (index < groupNum) {
+			this->processSourceGroup(index);
+		}
+		else {
+			this->processTrack(index - groupNum);
+		}
+	}) {}
+
+RenderEngine::~RenderEngine() {
+	this->release();
+}
+
+void RenderEngine::prepare(MainGraph* graph, int blockSize) {
+	this->release();
+	if (!graph || !this->pool) { return; }
+
+	this->graph = graph;
+	this->blockSize = blockSize;
+	this->currentSamples = blockSize;
+
+	/** Device */
+	int inputChannels = graph->getTotalNumInputChannels();
+	int outputChannels = graph->getTotalNumOutputChannels();
+	this->deviceAudio.setSize(inputChannels, blockSize, false, true, false);
+	this->deviceMidi.ensureSize(4096);
+	this->offlineAudio.setSize(std::max(inputChannels, outputChannels), blockSize, false, true, false);
+	this->offlineMidi.ensureSize(4096);
+	auto midiInputID = graph->midiInputNode->nodeID;
+	auto isMIDIFromDevice = [graph, midiInputID](juce::AudioProcessorGraph::NodeID nodeID) {
+		return graph->isConnected({ { midiInputID, juce::AudioProcessorGraph::midiChannelIndex },
+			{ nodeID, juce::AudioProcessorGraph::midiChannelIndex } });
+	};
+
+	/** Sources */
+	int sourceNum = graph->getSourceNum();
+	this->sources.resize(sourceNum);
+	for (int i = 0; i < sourceNum; i++) {
+		auto& node = this->sources[i];
+		node.node = graph->audioSourceNodeList[i];
+		node.processor = graph->getSourceProcessor(i);
+		node.audioRef = node.processor->getAudioRef();
+		node.midiRef = node.processor->getMIDIRef();
+		node.midiFromDevice = isMIDIFromDevice(node.node->nodeID);
+
+		int channels = std::max(node.processor->getTotalNumInputChannels(),
+			node.processor->getTotalNumOutputChannels());
+		node.audio.setSize(channels, blockSize, false, true, false);
+		node.midi.ensureSize(4096);
+	}
+
+	/** Tracks */
+	int trackNum = graph->getTrackNum();
+	this->tracks.resize(trackNum);
+	for (int i = 0; i < trackNum; i++) {
+		auto& node = this->tracks[i];
+		node.node = graph->trackNodeList[i];
+		node.processor = graph->getTrackProcessor(i);
+
+		int channels = std::max(node.processor->getTotalNumInputChannels(),
+			node.processor->getTotalNumOutputChannels());
+		node.audio.setSize(channels, blockSize, false, true, false);
+		node.midi.ensureSize(4096);
+
+		/** Connections */
+		for (auto& [src, srcChannel, dst, dstChannel] : graph->getTrackInputFromSrcConnections(i)) {
+			node.audioFromSource.add({ src, srcChannel, dstChannel });
+		}
+		for (auto& [src, srcChannel, dst, dstChannel] : graph->getTrackInputFromTrackConnections(i)) {
+			node.audioFromTrack.add({ src, srcChannel, dstChannel });
+		}
+		for (auto& [src, srcChannel, dst, dstChannel] : graph->getTrackInputFromDeviceConnections(i)) {
+			node.audioFromDevice.add({ srcChannel, dstChannel });
+		}
+		for (auto& [src, srcChannel, dst, dstChannel] : graph->getTrackOutputToDeviceConnections(i)) {
+			node.audioToDevice.add({ srcChannel, dstChannel });
+		}
+		for (auto& [src, dst] : graph->getTrackMidiInputFromSrcConnections(i)) {
+			node.midiFromSource.add(src);
+		}
+		node.midiFromDevice = isMIDIFromDevice(node.node->nodeID);
+		node.midiToDevice = graph->isMIDITrk2OConnected(i);
+	}
+
+	/** Schedule */
+	this->buildSourceGroups();
+	this->buildTaskGraph();
+}
+
+void RenderEngine::release() {
+	/** Workers May Still Be Leaving The Last Block */
+	if (this->pool) {
+		this->pool->waitForIdle();
+	}
+
+	this->graph = nullptr;
+	this->blockSize = 0;
+	this->currentSamples = 0;
+	this->sources.clear();
+	this->tracks.clear();
+	this->sourceGroups.clear();
+	this->taskGraph = nullptr;
+}
+
+void RenderEngine::renderBlock() {
+	if (!this->graph) { return; }
+
+	while (true) {
+		/** Wait While Another Thread Edits Audio State */
+		audioLock::ScopedAudioBlock block;
+		if (block.canProcess()) {
+			/** Publish Position Of This Block For All Nodes */
+			auto playPosition = dynamic_cast<PlayPosition*>(this->graph->getPlayHead());
+			if (playPosition) {
+				playPosition->beginBlock();
+			}
+
+			/** Process With Silent Input */
+			vMath::zeroAllAudioData(this->offlineAudio);
+			this->offlineMidi.clear();
+			this->process(this->offlineAudio, this->offlineMidi);
+
+			/** Add Position, Rendered Blocks Wait For Edits */
+			if (auto position = playPosition) {
+				juce::ScopedWriteLock positionLocker(audioLock::getPositionLock());
+				position->endBlock(true);
+
+				int currentPos = position->getPosition()->getTimeInSamples().orFallback(0);
+				if (INT_MAX - this->blockSize > currentPos) {
+					position->next(this->blockSize);
+				}
+				else {
+					position->setOverflow();
+				}
+			}
+
+			return;
+		}
+
+		/** Offline Render Can Wait For Editing */
+		if (juce::Thread::currentThreadShouldExit()) { return; }
+		juce::Thread::sleep(1);
+	}
+}
+
+bool RenderEngine::process(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi) {
+	/** Check Schedule */
+	if (!this->graph || !this->taskGraph) { return false; }
+	int numSamples = audio.getNumSamples();
+	if (numSamples <= 0 || numSamples > this->blockSize) { return false; }
+	if (!this->isUpToDate()) { return false; }
+	this->currentSamples = numSamples;
+
+	/** Keep Device Input */
+	this->deviceAudio.setSize(this->deviceAudio.getNumChannels(), numSamples, false, false, true);
+	for (int i = 0; i < this->deviceAudio.getNumChannels(); i++) {
+		if (i < audio.getNumChannels()) {
+			vMath::copyAudioData(this->deviceAudio, audio, 0, 0, i, i, numSamples);
+		}
+		else {
+			vMath::zeroAllAudioDataOnChannel(this->deviceAudio, i);
+		}
+	}
+	this->deviceMidi.clear();
+	this->deviceMidi.addEvents(midi, 0, numSamples, 0);
+
+	/** Process Nodes */
+	this->pool->run(*(this->taskGraph), this->task);
+
+	/** Device Output In Track Order */
+	vMath::zeroAllAudioData(audio);
+	midi.clear();
+	for (auto& node : this->tracks) {
+		for (auto& [srcChannel, dstChannel] : node.audioToDevice) {
+			if (srcChannel < 0 || srcChannel >= node.audio.getNumChannels()) { continue; }
+			if (dstChannel < 0 || dstChannel >= audio.getNumChannels()) { continue; }
+
+			vMath::addAudioData(audio, node.audio,
+				0, 0, dstChannel, srcChannel, numSamples);
+		}
+		if (node.midiToDevice) {
+			midi.addEvents(node.midi, 0, numSamples, 0);
+		}
+	}
+
+	return true;
+}
+
+int RenderEngine::getBlockSize() const {
+	return this->blockSize;
+}
+
+int RenderEngine::getThreadNum() const {
+	return this->pool ? this->pool->getThreadNum() : 0;
+}
+
+int RenderEngine::getTaskNum() const {
+	return this->taskGraph ? this->taskGraph->getTaskNum() : 0;
+}
+
+int RenderEngine::getDepth() const {
+	return this->taskGraph ? this->taskGraph->getDepth() : 0;
+}
+
+void RenderEngine::buildSourceGroups() {
+	/** Union Sources With The Same Source Data */
+	std::vector<int> groupOf(this->sources.size(), -1);
+	std::map<uint64_t, int> audioRefGroup, midiRefGroup;
+	for (int i = 0; i < this->sources.size(); i++) {
+		auto processor = this->sources[i].processor;
+		uint64_t audioRef = processor->getAudioRef();
+		uint64_t midiRef = processor->getMIDIRef();
+
+		/** Find Group */
+		int group = -1;
+		if (audioRef != 0) {
+			auto it = audioRefGroup.find(audioRef);
+			if (it != audioRefGroup.end()) { group = it->second; }
+		}
+		if (midiRef != 0) {
+			auto it = midiRefGroup.find(midiRef);
+			if (it != midiRefGroup.end()) {
+				if (group > -1 && group != it->second) {
+					/** Merge Groups */
+					int oldGroup = it->second;
+					for (auto& g : groupOf) {
+						if (g == oldGroup) { g = group; }
+					}
+					for (auto& [ref, g] : audioRefGroup) {
+						if (g == oldGroup) { g = group; }
+					}
+					for (auto& [ref, g] : midiRefGroup) {
+						if (g == oldGroup) { g = group; }
+					}
+				}
+				else {
+					group = it->second;
+				}
+			}
+		}
+		if (group < 0) { group = i; }
+
+		groupOf[i] = group;
+		if (audioRef != 0) { audioRefGroup[audioRef] = group; }
+		if (midiRef != 0) { midiRefGroup[midiRef] = group; }
+	}
+
+	/** Collect Groups In Source Order */
+	std::map<int, int> groupIndex;
+	for (int i = 0; i < groupOf.size(); i++) {
+		auto it = groupIndex.find(groupOf[i]);
+		if (it == groupIndex.end()) {
+			it = groupIndex.insert(std::make_pair(groupOf[i], (int)this->sourceGroups.size())).first;
+			this->sourceGroups.push_back({});
+		}
+		this->sourceGroups[it->second].add(i);
+	}
+}
+
+void RenderEngine::buildTaskGraph() {
+	int groupNum = this->sourceGroups.size();
+	int trackNum = this->tracks.size();
+	this->taskGraph = std::make_unique<ParallelTaskPool::TaskGraph>(groupNum + trackNum);
+
+	/** Group Of Each Source */
+	std::vector<int> groupOf(this->sources.size(), -1);
+	for (int i = 0; i < groupNum; i++) {
+		for (auto j : this->sourceGroups[i]) {
+			groupOf[j] = i;
+		}
+	}
+
+	for (int i = 0; i < trackNum; i++) {
+		auto& node = this->tracks[i];
+
+		/** Tracks Wait For Their Sources */
+		for (auto& [src, srcChannel, dstChannel] : node.audioFromSource) {
+			if (src < 0 || src >= groupOf.size()) { continue; }
+			this->taskGraph->addDependency(groupNum + i, groupOf[src]);
+		}
+		for (auto src : node.midiFromSource) {
+			if (src < 0 || src >= groupOf.size()) { continue; }
+			this->taskGraph->addDependency(groupNum + i, groupOf[src]);
+		}
+
+		/** Tracks Wait For Tracks Sending To Them */
+		for (auto& [src, srcChannel, dstChannel] : node.audioFromTrack) {
+			if (src < 0 || src >= trackNum) { continue; }
+			this->taskGraph->addDependency(groupNum + i, groupNum + src);
+		}
+	}
+
+	/** The Graph Refuses Feedback Loops, Anything Left Runs In Index Order */
+	bool noLoop = this->taskGraph->prepare(this->pool->getThreadNum());
+	jassert(noLoop);
+}
+
+bool RenderEngine::isUpToDate() const {
+	/** Source Data And Buses Can Change Without Changing The Graph */
+	for (auto& node : this->sources) {
+		if (node.processor->getAudioRef() != node.audioRef) { return false; }
+		if (node.processor->getMIDIRef() != node.midiRef) { return false; }
+		if (std::max(node.processor->getTotalNumInputChannels(),
+			node.processor->getTotalNumOutputChannels()) != node.audio.getNumChannels()) {
+			return false;
+		}
+	}
+	for (auto& node : this->tracks) {
+		if (std::max(node.processor->getTotalNumInputChannels(),
+			node.processor->getTotalNumOutputChannels()) != node.audio.getNumChannels()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void RenderEngine::processSourceGroup(int groupIndex) {
+	for (auto i : this->sourceGroups[groupIndex]) {
+		auto& node = this->sources[i];
+
+		/** Clear */
+		node.audio.setSize(node.audio.getNumChannels(), this->currentSamples, false, false, true);
+		vMath::zeroAllAudioData(node.audio);
+		node.midi.clear();
+
+		/** Process */
+		const juce::ScopedLock locker(node.processor->getCallbackLock());
+		if (node.processor->isSuspended()) { continue; }
+		if (node.midiFromDevice) {
+			node.midi.addEvents(this->deviceMidi, 0, this->currentSamples, 0);
+		}
+		if (node.node->isBypassed()) {
+			node.processor->processBlockBypassed(node.audio, node.midi);
+		}
+		else {
+			node.processor->processBlock(node.audio, node.midi);
+		}
+	}
+}
+
+void RenderEngine::processTrack(int trackIndex) {
+	auto& node = this->tracks[trackIndex];
+	int channels = node.audio.getNumChannels();
+	int numSamples = this->currentSamples;
+
+	/** Clear */
+	node.audio.setSize(channels, numSamples, false, false, true);
+	vMath::zeroAllAudioData(node.audio);
+	node.midi.clear();
+
+	/** Audio From Sources */
+	for (auto& [src, srcChannel, dstChannel] : node.audioFromSource) {
+		if (src < 0 || src >= this->sources.size()) { continue; }
+		auto& srcBuffer = this->sources[src].audio;
+		if (srcChannel < 0 || srcChannel >= srcBuffer.getNumChannels()) { continue; }
+		if (dstChannel < 0 || dstChannel >= channels) { continue; }
+
+		vMath::addAudioData(node.audio, srcBuffer,
+			0, 0, dstChannel, srcChannel, numSamples);
+	}
+
+	/** Audio From Tracks */
+	for (auto& [src, srcChannel, dstChannel] : node.audioFromTrack) {
+		if (src < 0 || src >= this->tracks.size()) { continue; }
+		auto& srcBuffer = this->tracks[src].audio;
+		if (srcChannel < 0 || srcChannel >= srcBuffer.getNumChannels()) { continue; }
+		if (dstChannel < 0 || dstChannel >= channels) { continue; }
+
+		vMath::addAudioData(node.audio, srcBuffer,
+			0, 0, dstChannel, srcChannel, numSamples);
+	}
+
+	/** Audio From Device */
+	for (auto& [srcChannel, dstChannel] : node.audioFromDevice) {
+		if (srcChannel < 0 || srcChannel >= this->deviceAudio.getNumChannels()) { continue; }
+		if (dstChannel < 0 || dstChannel >= channels) { continue; }
+
+		vMath::addAudioData(node.audio, this->deviceAudio,
+			0, 0, dstChannel, srcChannel, numSamples);
+	}
+
+	/** MIDI From Sources */
+	for (auto src : node.midiFromSource) {
+		if (src < 0 || src >= this->sources.size()) { continue; }
+		node.midi.addEvents(this->sources[src].midi, 0, numSamples, 0);
+	}
+
+	/** MIDI From Device */
+	if (node.midiFromDevice) {
+		node.midi.addEvents(this->deviceMidi, 0, numSamples, 0);
+	}
+
+	/** Process */
+	const juce::ScopedLock locker(node.processor->getCallbackLock());
+	if (node.processor->isSuspended()) {
+		vMath::zeroAllAudioData(node.audio);
+		node.midi.clear();
+		return;
+	}
+	if (node.node->isBypassed()) {
+		node.processor->processBlockBypassed(node.audio, node.midi);
+	}
+	else {
+		node.processor->processBlock(node.audio, node.midi);
+	}
+}
@@ -0,0 +1,113 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "ParallelTaskPool.h"
+
+class MainGraph;
+class SeqSourceProcessor;
+class Track;
+
+/**
+ * @brief	Engine which processes the main graph on a worker pool, used offline and in real time.
+ *			Sequencer sources and mixer tracks are tasks of one dependency graph built from the
+ *			send, sidechain and output connections, so independent nodes run at the same time.
+ *			Sources sharing the same source data are processed in the same task.
+ *			Each node writes its own buffer and inputs are summed in connection order,
+ *			so the result doesn't depend on which thread runs which node.
+ *			All buffers are allocated in prepare(), so processing a block allocates nothing.
+ *			Nodes run on workers while the calling thread holds the audio locks, and a worker can't
+ *			enter a lock held for writing by another thread, so node processBlock must not lock them.
+ */
+class RenderEngine final {
+public:
+	RenderEngine() = delete;
+	explicit RenderEngine(std::shared_ptr<ParallelTaskPool> pool);
+	~RenderEngine();
+
+	/**
+	 * @brief	Build the schedule from the main graph and allocate buffers.
+	 *			Call this after the main graph is prepared with the same block size.
+	 */
+	void prepare(MainGraph* graph, int blockSize);
+	void release();
+
+	/**
+	 * @brief	Render one block offline at the current play position and move the play head.
+	 */
+	void renderBlock();
+
+	/**
+	 * @brief	Process one block with the device input in the buffers and write the device output back.
+	 *			The caller must hold the audio locks, source nodes read source data with the lock-free getters.
+	 * @return	False if the schedule is out of date or the block is too large, so nothing is processed.
+	 */
+	bool process(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi);
+	/**
+	 * @brief	Check whether source data and buses are the same as when the schedule was built.
+	 */
+	bool isUpToDate() const;
+
+	int getBlockSize() const;
+	int getThreadNum() const;
+	int getTaskNum() const;
+	int getDepth() const;
+
+private:
+	struct SourceNode final {
+		juce::AudioProcessorGraph::Node::Ptr node;
+		SeqSourceProcessor* processor = nullptr;
+		uint64_t audioRef = 0, midiRef = 0;
+		bool midiFromDevice = false;
+		juce::AudioBuffer<float> audio;
+		juce::MidiBuffer midi;
+	};
+	struct TrackNode final {
+		juce::AudioProcessorGraph::Node::Ptr node;
+		Track* processor = nullptr;
+		juce::AudioBuffer<float> audio;
+		juce::MidiBuffer midi;
+
+		/** Source index, source channel, destination channel */
+		juce::Array<std::tuple<int, int, int>> audioFromSource;
+		/** Track index, source channel, destination channel */
+		juce::Array<std::tuple<int, int, int>> audioFromTrack;
+		/** Device channel, destination channel */
+		juce::Array<std::tuple<int, int>> audioFromDevice;
+		/** Source channel, device channel */
+		juce::Array<std::tuple<int, int>> audioToDevice;
+		/** Source index */
+		juce::Array<int> midiFromSource;
+		bool midiFromDevice = false, midiToDevice = false;
+	};
+
+	MainGraph* graph = nullptr;
+	int blockSize = 0;
+	int currentSamples = 0;
+
+	std::vector<SourceNode> sources;
+	std::vector<TrackNode> tracks;
+
+	/** Device input of the current block */
+	juce::AudioBuffer<float> deviceAudio;
+	juce::MidiBuffer deviceMidi;
+
+	/** Silent device buffers used offline */
+	juce::AudioBuffer<float> offlineAudio;
+	juce::MidiBuffer offlineMidi;
+
+	/** Sources in the same group share source data */
+	std::vector<juce::Array<int>> sourceGroups;
+	/** Source groups come first, then tracks */
+	std::unique_ptr<ParallelTaskPool::TaskGraph> taskGraph;
+
+	std::shared_ptr<ParallelTaskPool> pool;
+	const ParallelTaskPool::Task task;
+
+	void buildSourceGroups();
+	void buildTaskGraph();
+
+	void processSourceGroup(int groupIndex);
+	void processTrack(int trackIndex);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderEngine)
+};
@@ -6,6 +6,9 @@
 #include "../plugin/PluginLoader.h"
 #include "../misc/VMath.h"
 #include "../misc/AudioLock.h"
+#include "../AudioConfig.h"
+#include "../uiCallback/UICallback.h"
+#include "RenderEngine.h"
 
 class RenderThread final : public juce::Thread {
 public:
@@ -50,6 +53,9 @@ void RenderThread::run() {
 	/** Check Renderer */
 	if (!this->renderer) { return; }
 
+	/** Denormals Are Only Flushed On The Audio Device Thread By Default */
+	juce::ScopedNoDenormals noDenormals;
+
 	/** Get Main Graph */
 	auto mainGraph = AudioCore::getInstance()->getGraph();
 	if (!mainGraph) { return; }
@@ -57,12 +63,17 @@ void RenderThread::run() {
 	/** Reset Play Head State */
 	AudioCore::getInstance()->stop();
 
+	/** Block Size */
+	int blockSize = this->renderer->renderBlockSize;
+
 	/** Buffer Audio */
 	{
 		double bufferArea = this->renderer->audioBufferArea;
 		int bufferLength = bufferArea * this->renderer->sampleRate;
-		int bufferBlockNum = std::ceil(bufferLength / this->renderer->bufferSize);
+		int bufferBlockNum = std::ceil(bufferLength / (double)blockSize);
 
+		juce::AudioSampleBuffer audio(1, blockSize);
+		juce::MidiBuffer midi;
 		for (int i = 0; i < bufferBlockNum; i++) {
 			/** Stop */
 			if (juce::Thread::currentThreadShouldExit()) {
@@ -70,9 +81,8 @@ void RenderThread::run() {
 			}
 
 			/** Render */
-			juce::AudioSampleBuffer audio(1, this->renderer->bufferSize);
-			juce::MidiBuffer midi;
 			mainGraph->processBlock(audio, midi);
+			midi.clear();
 		}
 	}
 
@@ -91,20 +101,77 @@ void RenderThread::run() {
 	/** Reset Play Position */
 	PlayPosition::getInstance()->setPositionInSamples(0);
 
+	/** Open Files */
+	this->renderer->openFiles(this->dir, this->name, this->extension,
+		this->metaData, this->bitDepth, this->quality);
+
+	/** Prepare Render Engine */
+	RenderEngine engine(std::make_shared<ParallelTaskPool>(
+		AudioConfig::getRenderThreadNum(), "Render Worker"));
+	{
+		juce::ScopedReadLock audioLocker(audioLock::getAudioLock());
+		engine.prepare(mainGraph, blockSize);
+	}
+
 	/** Render Each Block */
-	juce::GenericScopedLock graphLocker(mainGraph->getCallbackLock());
-	while (PlayPosition::getInstance()->getPosition()
-		->getTimeInSeconds().orFallback(0) < totalLength) {
-		/** Stop */
-		if (juce::Thread::currentThreadShouldExit()) {
-			break;
+	std::vector<double> blockTimes;
+	blockTimes.reserve((size_t)std::ceil(totalLength * this->renderer->sampleRate / blockSize) + 1);
+	auto startTicks = juce::Time::getHighResolutionTicks();
+	{
+		juce::GenericScopedLock graphLocker(mainGraph->getCallbackLock());
+		int diskCheckBlocks = std::max(1, (int)(this->renderer->sampleRate / blockSize));
+		while (PlayPosition::getInstance()->getPosition()
+			->getTimeInSeconds().orFallback(0) < totalLength) {
+			/** Stop */
+			if (juce::Thread::currentThreadShouldExit()) {
+				break;
+			}
+
+			/** Disk Full */
+			if (blockTimes.size() % diskCheckBlocks == 0
+				&& this->dir.getBytesFreeOnVolume() < this->renderer->minFreeBytes) {
+				this->renderer->failAllTracks();
+				break;
+			}
+
+			/** Render */
+			auto blockStartTicks = juce::Time::getHighResolutionTicks();
+			engine.renderBlock();
+			blockTimes.push_back(juce::Time::highResolutionTicksToSeconds(
+				juce::Time::getHighResolutionTicks() - blockStartTicks));
 		}
+	}
+	double renderSeconds = juce::Time::highResolutionTicksToSeconds(
+		juce::Time::getHighResolutionTicks() - startTicks);
 
-		/** Render */
-		juce::AudioSampleBuffer audio(1, this->renderer->bufferSize);
-		juce::MidiBuffer midi;
-		mainGraph->processBlock(audio, midi);
+	/** Timing */
+	{
+		Renderer::Stats stats;
+		stats.length = blockTimes.size() * (double)blockSize / this->renderer->sampleRate;
+		stats.seconds = renderSeconds;
+		stats.sampleRate = this->renderer->sampleRate;
+		stats.blockSize = blockSize;
+		stats.threadNum = engine.getThreadNum();
+		stats.blockNum = blockTimes.size();
+
+		for (auto t : blockTimes) {
+			stats.averageBlock += t;
+			stats.worstBlock = std::max(stats.worstBlock, t);
+
+			int bucket = (int)std::floor(std::log2(std::max(t * 1000000, 1.0)));
+			stats.histogram[std::clamp(bucket, 0, Renderer::Stats::histogramSize - 1)]++;
+		}
+		if (!blockTimes.empty()) {
+			stats.averageBlock /= blockTimes.size();
+
+			auto p99It = blockTimes.begin() + (blockTimes.size() - 1) * 99 / 100;
+			std::nth_element(blockTimes.begin(), p99It, blockTimes.end());
+			stats.p99Block = *p99It;
+		}
+
+		this->renderer->setLastStats(stats);
 	}
+	engine.release();
 
 	/** Reset Rendering Mode */
 	this->renderer->setRendering(false);
@@ -116,13 +183,24 @@ void RenderThread::run() {
 				ac->stop();
 				ac->setIsolation(false);
 			}});
-	
-	/** Save Audio */
-	this->renderer->saveFile(this->dir, this->name, this->extension,
-		this->metaData, this->bitDepth, this->quality);
 
-	/** Clear Buffer */
-	this->renderer->releaseBuffer();
+	/** Flush And Close Files */
+	this->renderer->closeFiles();
+
+	/** Report Failed Tracks */
+	auto failedFiles = this->renderer->getFailedFiles();
+	if (!failedFiles.isEmpty()) {
+		juce::MessageManager::callAsync(
+			[failedFiles] {
+				UICallbackAPI<const juce::String&, const juce::String&>::invoke(
+					UICallbackType::ErrorAlert, "Render",
+					"Can't write rendered audio, the disk may be full or unavailable:\n"
+					+ failedFiles.joinIntoString("\n"));
+			});
+	}
+
+	/** Clear Tasks */
+	this->renderer->releaseTasks();
 }
 
 Renderer::Renderer() {
@@ -134,6 +212,7 @@ Renderer::~Renderer() {
 	if (this->renderThread) {
 		this->renderThread->stopThread(3000);
 	}
+	this->closeFiles();
 }
 
 bool Renderer::start(const juce::Array<int>& tracks, const juce::String& path,
@@ -177,6 +256,7 @@ bool Renderer::start(const juce::Array<int>& tracks, const juce::String& path,
 	}
 
 	/** Set Tasks */
+	this->renderBlockSize = AudioConfig::getRenderBlockSize();
 	this->prepareToRender(tasks);
 
 	/** Isolate Main Graph */
@@ -189,12 +269,12 @@ bool Renderer::start(const juce::Array<int>& tracks, const juce::String& path,
 	/** Prepare Main Graph */
 	{
 		juce::GenericScopedLock locker(this->lock);
-		graph->prepareToPlay(this->sampleRate, this->bufferSize);
+		graph->prepareToPlay(this->sampleRate, this->renderBlockSize);
 	}
 
 	/** Process Block To Close All MIDI Notes */
 	{
-		juce::AudioSampleBuffer audio(1, this->bufferSize);
+		juce::AudioSampleBuffer audio(1, this->renderBlockSize);
 		juce::MidiBuffer midi;
 		graph->processBlock(audio, midi);
 	}
@@ -218,18 +298,7 @@ void Renderer::updateSampleRateAndBufferSize(
 	double sampleRate, int bufferSize) {
 	juce::GenericScopedLock locker(this->lock);
 
-	if (this->sampleRate != sampleRate) {
-		/** Clear Buffer */
-		for (auto& i : this->buffers) {
-			auto& [id, channels, buffer] = i.second;
-
-			int newSize =
-				std::ceil(buffer.getNumSamples() * (sampleRate / this->sampleRate));
-			buffer.setSize(channels.size(), newSize, false, true, true);
-		}
-
-		this->sampleRate = sampleRate;
-	}
+	this->sampleRate = sampleRate;
 	this->bufferSize = bufferSize;
 }
 
@@ -237,59 +306,103 @@ bool Renderer::getRendering() const {
 	return this->rendering;
 }
 
-void Renderer::prepareToRender(const RenderTaskList& tasks) {
+bool Renderer::isRunning() const {
+	return this->renderThread->isThreadRunning();
+}
+
+double Renderer::Stats::getRealtimeFactor() const {
+	return (this->seconds > 0) ? (this->length / this->seconds) : 0;
+}
+
+const Renderer::Stats Renderer::getLastStats() const {
 	juce::GenericScopedLock locker(this->lock);
+	return this->lastStats;
+}
 
-	this->releaseBuffer();
+void Renderer::setLastStats(const Stats& stats) {
+	juce::GenericScopedLock locker(this->lock);
+	uint64_t id = this->lastStats.id;
+	this->lastStats = stats;
+	this->lastStats.id = id + 1;
+}
 
-	auto graph = AudioCore::getInstance()->getGraph();
-	double totalLength = graph ? graph->getTailLengthSeconds() : 0;
-	int bufferSize = std::ceil(totalLength * this->sampleRate);
+void Renderer::prepareToRender(const RenderTaskList& tasks) {
+	juce::GenericScopedLock locker(this->lock);
+
+	this->releaseTasks();
 
 	for (auto& [ptr, id, channels] : tasks) {
-		juce::AudioBuffer<float> buffer;
-		buffer.setSize(channels.size(), bufferSize, false, true, true);
-		this->buffers.insert(std::make_pair(
-			ptr, std::make_tuple(id, channels, buffer)));
+		auto& track = this->writers[ptr];
+		track.id = id;
+		track.channels = channels;
 	}
 }
 
-void Renderer::saveFile(const juce::File& dir,
+void Renderer::openFiles(const juce::File& dir,
 	const juce::String& name, const juce::String& extension,
 	const juce::StringPairArray& metaData, int bitDepth, int quality) {
 	/** Lock */
 	juce::GenericScopedLock locker(this->lock);
 
-	/** Save Each Buffer */
-	for (auto& i : this->buffers) {
-		/** Stop */
-		if (juce::Thread::currentThreadShouldExit()) {
-			break;
-		}
+	/** FIFO Size */
+	int fifoSize = std::max(this->renderBlockSize * 4,
+		(int)std::ceil(this->writerBufferArea * this->sampleRate));
+
+	/** Open Each File */
+	for (auto& i : this->writers) {
+		/** Get Track */
+		auto& track = i.second;
 
-		/** Get Buffer */
-		auto& [id, channels, buffer] = i.second;
-		
 		/** Create File */
-		auto file = dir.getChildFile(name + "_" + juce::String(id) + extension);
+		auto file = dir.getChildFile(name + "_" + juce::String(track.id) + extension);
 		if (file.exists()) {
 			file.deleteFile();
 		}
+		track.file = file;
+		track.failed = false;
 
 		/** Create Audio Writer */
 		auto writer = utils::createAudioWriter(
-			file, this->sampleRate, channels,
+			file, this->sampleRate, track.channels,
 			metaData, bitDepth, quality);
 		if (!writer) { continue; }
 
-		/** Write Data */
-		writer->writeFromAudioSampleBuffer(buffer, 0, buffer.getNumSamples());
+		/** Create Background Writer */
+		track.writer = std::make_unique<juce::AudioFormatWriter::ThreadedWriter>(
+			writer.release(), this->writerThread, fifoSize);
+		track.channelData.resize(track.channels.size());
+		track.silence.setSize(track.channels.size(), this->renderBlockSize);
+		track.silence.clear();
+		track.writtenSamples = 0;
 	}
+
+	/** Start Writing */
+	this->writerThread.startThread();
 }
 
-void Renderer::releaseBuffer() {
+void Renderer::closeFiles() {
+	/** Lock */
 	juce::GenericScopedLock locker(this->lock);
-	this->buffers.clear();
+
+	/** Flush Each Writer */
+	for (auto& i : this->writers) {
+		i.second.writer = nullptr;
+	}
+
+	/** Stop Writing */
+	this->writerThread.stopThread(3000);
+
+	/** Remove Incomplete Files */
+	for (auto& i : this->writers) {
+		if (i.second.failed) {
+			i.second.file.deleteFile();
+		}
+	}
+}
+
+void Renderer::releaseTasks() {
+	juce::GenericScopedLock locker(this->lock);
+	this->writers.clear();
 }
 
 void Renderer::writeData(const Track* trackPtr,
@@ -297,25 +410,71 @@ void Renderer::writeData(const Track* trackPtr,
 	/** Check Rendering State */
 	if (!this->rendering) { return; }
 
-	/** Lock */
-	juce::GenericScopedLock locker(this->lock);
+	/** Find Writer (Writers don't change while rendering, and each track is written by one thread) */
+	auto writerIt = this->writers.find(trackPtr);
+	if (writerIt == this->writers.end()) { return; }
+	auto& track = writerIt->second;
+	if (!track.writer || track.failed) { return; }
 
-	/** Find Buffer */
-	auto bufferIt = this->buffers.find(trackPtr);
-	if (bufferIt == this->buffers.end()) { return; }
-	auto& dstBuffer = std::get<2>(bufferIt->second);
+	/** Check Channels */
+	int channels = track.channelData.size();
+	if (buffer.getNumChannels() < channels) { return; }
 
-	/** Increase Buffer Size */
-	if (dstBuffer.getNumSamples() - buffer.getNumSamples() < offset) {
-		dstBuffer.setSize(dstBuffer.getNumChannels(),
-			offset + buffer.getNumSamples(), true, false, true);
+	/** Fill Gap */
+	while (track.writtenSamples < offset) {
+		int num = std::min((int64_t)track.silence.getNumSamples(), offset - track.writtenSamples);
+		if (!this->writeToFifo(track, track.silence.getArrayOfReadPointers(), num)) { return; }
 	}
 
-	/** Copy Data */
-	for (int i = 0; i < dstBuffer.getNumChannels(); i++) {
-		vMath::copyAudioData(dstBuffer, buffer,
-			offset, 0, i, i, buffer.getNumSamples());
+	/** Skip Written Part */
+	int skip = std::max((int64_t)0, track.writtenSamples - offset);
+	if (skip >= buffer.getNumSamples()) { return; }
+
+	/** Write Data */
+	for (int i = 0; i < channels; i++) {
+		track.channelData[i] = buffer.getReadPointer(i, skip);
+	}
+	this->writeToFifo(track, track.channelData.data(), buffer.getNumSamples() - skip);
+}
+
+bool Renderer::writeToFifo(TrackWriter& track,
+	const float* const* data, int numSamples) {
+	/** Wait For The Writer Thread When FIFO Is Full */
+	auto startTime = juce::Time::getMillisecondCounter();
+	while (!track.writer->write(data, numSamples)) {
+		/** Render Stopped */
+		if (this->renderThread->threadShouldExit()) {
+			return false;
+		}
+
+		/** Writer Stalled */
+		if (juce::Time::getMillisecondCounter() - startTime > (juce::uint32)this->writerTimeoutMs) {
+			track.failed = true;
+			return false;
+		}
+
+		juce::Thread::sleep(1);
+	}
+	track.writtenSamples += numSamples;
+	return true;
+}
+
+void Renderer::failAllTracks() {
+	for (auto& i : this->writers) {
+		i.second.failed = true;
+	}
+}
+
+const juce::StringArray Renderer::getFailedFiles() const {
+	juce::GenericScopedLock locker(this->lock);
+
+	juce::StringArray result;
+	for (auto& i : this->writers) {
+		if (i.second.failed) {
+			result.add(i.second.file.getFullPathName());
+		}
 	}
+	return result;
 }
 
 Renderer* Renderer::getInstance() {
@@ -21,19 +21,39 @@ public:
 	void startThreadInternal();
 
 	bool getRendering() const;
+	bool isRunning() const;
 
 	void updateSampleRateAndBufferSize(double sampleRate, int bufferSize);
 
+	/** Timing of a finished render */
+	struct Stats final {
+		uint64_t id = 0;
+		double length = 0, seconds = 0;
+		double sampleRate = 0;
+		int blockSize = 0, threadNum = 0;
+		int64_t blockNum = 0;
+		double averageBlock = 0, p99Block = 0, worstBlock = 0;
+
+		/** Block count by time, bucket i covers [2^i, 2^(i+1)) microseconds */
+		static constexpr int histogramSize = 24;
+		std::array<int64_t, histogramSize> histogram{};
+
+		/** Rendered seconds per second */
+		double getRealtimeFactor() const;
+	};
+	const Stats getLastStats() const;
+
 private:
 	friend class RenderThread;
 
 	void setRendering(bool rendering);
 
 	void prepareToRender(const RenderTaskList& tasks);
-	void saveFile(const juce::File& dir,
+	void openFiles(const juce::File& dir,
 		const juce::String& name, const juce::String& extension,
 		const juce::StringPairArray& metaData, int bitDepth, int quality);
-	void releaseBuffer();
+	void closeFiles();
+	void releaseTasks();
 
 private:
 	friend class Track;
@@ -42,14 +62,40 @@ private:
 
 private:
 	std::atomic_bool rendering = false;
-	juce::CriticalSection lock;
+	mutable juce::CriticalSection lock;
 	const double audioBufferArea = 2;
+	const double writerBufferArea = 2;
 	double sampleRate = 0;
 	int bufferSize = 0;
-	std::map<const Track*, std::tuple<
-		int, juce::AudioChannelSet, juce::AudioBuffer<float>>> buffers;
+	int renderBlockSize = 4096;
+	/** A writer accepting nothing for this long is treated as failed */
+	const int writerTimeoutMs = 10000;
+	/** Rendering stops when the volume has less space left */
+	const int64_t minFreeBytes = 64 * 1024 * 1024;
+
+	/** Each track streams its blocks to disk through a bounded FIFO */
+	struct TrackWriter final {
+		int id = -1;
+		juce::AudioChannelSet channels;
+		std::unique_ptr<juce::AudioFormatWriter::ThreadedWriter> writer = nullptr;
+		std::vector<const float*> channelData;
+		juce::AudioBuffer<float> silence;
+		int64_t writtenSamples = 0;
+		juce::File file;
+		std::atomic_bool failed = false;
+	};
+	std::map<const Track*, TrackWriter> writers;
+	juce::TimeSliceThread writerThread{ "Render Writer" };
 	std::unique_ptr<juce::Thread> renderThread = nullptr;
 
+	bool writeToFifo(TrackWriter& track,
+		const float* const* data, int numSamples);
+	void failAllTracks();
+	const juce::StringArray getFailedFiles() const;
+
+	Stats lastStats;
+	void setLastStats(const Stats& stats);
+
 public:
 	static Renderer* getInstance();
 	static void releaseInstance();
@@ -1,8 +1,25 @@
 ﻿#include "VMath.h"
 
-#if (!JUCE_MSVC) && (__SSE3__ || __AVX2__ || __AVX512F__)
+#if JUCE_INTEL && (JUCE_MSVC || JUCE_GCC || JUCE_CLANG)
+#define VMATH_X86 1
 #include <immintrin.h>
-#endif //(!JUCE_MSVC) && (__SSE3__ || __AVX2__ || __AVX512F__)
+#else //JUCE_INTEL && (JUCE_MSVC || JUCE_GCC || JUCE_CLANG)
+#define VMATH_X86 0
+#endif //JUCE_INTEL && (JUCE_MSVC || JUCE_GCC || JUCE_CLANG)
+
+/**
+ * Each kernel is compiled for its own instruction set, so every variant exists
+ * without global architecture flags and the one to use is chosen by CPUID at runtime.
+ */
+#if VMATH_X86 && !JUCE_MSVC
+#define VMATH_TARGET_SSE3 __attribute__((target("sse3")))
+#define VMATH_TARGET_AVX2 __attribute__((target("avx2")))
+#define VMATH_TARGET_AVX512 __attribute__((target("avx512f")))
+#else //VMATH_X86 && !JUCE_MSVC
+#define VMATH_TARGET_SSE3
+#define VMATH_TARGET_AVX2
+#define VMATH_TARGET_AVX512
+#endif //VMATH_X86 && !JUCE_MSVC
 
 namespace vMath {
 	static void copyDataNormal(float* dst, const float* src, int length) {
@@ -27,279 +44,1262 @@ namespace vMath {
 		}
 	}
 
-#if __SSE3__ || JUCE_MSVC
-	static void copyDataSSE3(float* dst, const float* src, int length) {
+	static float dotProductNormal(const float* src0, const float* src1, int length) {
+		float result = 0;
+		for (int i = 0; i < length; i++) {
+			result += src0[i] * src1[i];
+		}
+		return result;
+	}
+
+	static void gainAndLevelNormal(float* dst, float gain, float step,
+		int length, float& peak, float& sumSquare) {
+		for (int i = 0; i < length; i++) {
+			float data = dst[i] * (gain + step * i);
+			dst[i] = data;
+			peak = std::max(peak, std::abs(data));
+			sumSquare += data * data;
+		}
+	}
+
+	static void levelNormal(const float* src,
+		int length, float& peak, float& sumSquare) {
+		for (int i = 0; i < length; i++) {
+			float data = src[i];
+			peak = std::max(peak, std::abs(data));
+			sumSquare += data * data;
+		}
+	}
+
+	static void gainNormal(float* dst, float gain, float step, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = dst[i] * (gain + step * i);
+		}
+	}
+
+	static void addWithGainNormal(float* dst, const float* src,
+		float gain, float step, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = dst[i] + src[i] * (gain + step * i);
+		}
+	}
+
+	static void clampNormal(float* dst, float minValue, float maxValue, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = std::min(std::max(dst[i], minValue), maxValue);
+		}
+	}
+
+	static void flushDenormalNormal(float* dst, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = (std::abs(dst[i]) >= std::numeric_limits<float>::min()) ? dst[i] : 0.f;
+		}
+	}
+
+	static void floatToIntNormal(int32_t* dst, const float* src, float scale, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = (int32_t)std::lrintf(std::min(std::max(src[i] * scale, -scale), scale));
+		}
+	}
+
+	static void intToFloatNormal(float* dst, const int32_t* src, float scale, int length) {
+		float invScale = 1.f / scale;
+		for (int i = 0; i < length; i++) {
+			dst[i] = (float)src[i] * invScale;
+		}
+	}
+
+	static void floatToDoubleNormal(double* dst, const float* src, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = (double)src[i];
+		}
+	}
+
+	static void doubleToFloatNormal(float* dst, const double* src, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = (float)src[i];
+		}
+	}
+
+	static void interleaveNormal(float* dst,
+		const float* src0, const float* src1, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i * 2] = src0[i];
+			dst[i * 2 + 1] = src1[i];
+		}
+	}
+
+	static void deinterleaveNormal(float* dst0, float* dst1,
+		const float* src, int length) {
+		for (int i = 0; i < length; i++) {
+			dst0[i] = src[i * 2];
+			dst1[i] = src[i * 2 + 1];
+		}
+	}
+
+#if VMATH_X86
+	/** Aligned Kernels Only Run On Buffers Aligned To The Vector Width */
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static inline __m128 loadSSE3(const float* src) {
+		if constexpr (Aligned) { return _mm_load_ps(src); }
+		else { return _mm_loadu_ps(src); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static inline void storeSSE3(float* dst, __m128 data) {
+		if constexpr (Aligned) { _mm_store_ps(dst, data); }
+		else { _mm_storeu_ps(dst, data); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static inline __m128i loadIntSSE3(const int32_t* src) {
+		if constexpr (Aligned) { return _mm_load_si128(reinterpret_cast<const __m128i*>(src)); }
+		else { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static inline void storeIntSSE3(int32_t* dst, __m128i data) {
+		if constexpr (Aligned) { _mm_store_si128(reinterpret_cast<__m128i*>(dst), data); }
+		else { _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), data); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static inline __m128d loadDoubleSSE3(const double* src) {
+		if constexpr (Aligned) { return _mm_load_pd(src); }
+		else { return _mm_loadu_pd(src); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static inline void storeDoubleSSE3(double* dst, __m128d data) {
+		if constexpr (Aligned) { _mm_store_pd(dst, data); }
+		else { _mm_storeu_pd(dst, data); }
+	}
+
+	VMATH_TARGET_SSE3 static inline float reduceMaxSSE3(__m128 data) {
+		data = _mm_max_ps(data, _mm_movehl_ps(data, data));
+		data = _mm_max_ss(data, _mm_shuffle_ps(data, data, 1));
+		return _mm_cvtss_f32(data);
+	}
+
+	VMATH_TARGET_SSE3 static inline float reduceAddSSE3(__m128 data) {
+		data = _mm_hadd_ps(data, data);
+		data = _mm_hadd_ps(data, data);
+		return _mm_cvtss_f32(data);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void copyDataSSE3(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = loadSSE3<Aligned>(&(src[i]));
+			storeSSE3<Aligned>(&(dst[i]), data);
+		}
+
+		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void addDataSSE3(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = loadSSE3<Aligned>(&(dst[i]));
+			__m128 data1 = loadSSE3<Aligned>(&(src[i]));
+			__m128 result = _mm_add_ps(data0, data1);
+			storeSSE3<Aligned>(&(dst[i]), result);
+		}
+
+		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void fillDataSSE3(float* dst, float data, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 dataV = _mm_set1_ps(data);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			storeSSE3<Aligned>(&(dst[i]), dataV);
+		}
+
+		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void averageDataSSE3(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 averV = _mm_set1_ps(0.5f);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = loadSSE3<Aligned>(&(dst[i]));
+			__m128 data1 = loadSSE3<Aligned>(&(src[i]));
+			__m128 sum = _mm_add_ps(data0, data1);
+			__m128 result = _mm_mul_ps(sum, averV);
+			storeSSE3<Aligned>(&(dst[i]), result);
+		}
+
+		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static float dotProductSSE3(const float* src0, const float* src1, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 sumV = _mm_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = loadSSE3<Aligned>(&(src0[i]));
+			__m128 data1 = loadSSE3<Aligned>(&(src1[i]));
+			sumV = _mm_add_ps(sumV, _mm_mul_ps(data0, data1));
+		}
+
+		return reduceAddSSE3(sumV)
+			+ dotProductNormal(&(src0[clipMax]), &(src1[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void gainAndLevelSSE3(float* dst, float gain, float step,
+		int length, float& peak, float& sumSquare) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 gainV = _mm_set1_ps(gain);
+		__m128 stepV = _mm_set1_ps(step);
+		__m128 indexV = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+		__m128 indexStepV = _mm_set1_ps((float)clipSize);
+		__m128 absMaskV = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		__m128 peakV = _mm_setzero_ps();
+		__m128 sumV = _mm_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = loadSSE3<Aligned>(&(dst[i]));
+			__m128 gainCurrentV = _mm_add_ps(gainV, _mm_mul_ps(stepV, indexV));
+			__m128 result = _mm_mul_ps(data, gainCurrentV);
+			storeSSE3<Aligned>(&(dst[i]), result);
+
+			peakV = _mm_max_ps(peakV, _mm_and_ps(result, absMaskV));
+			sumV = _mm_add_ps(sumV, _mm_mul_ps(result, result));
+			indexV = _mm_add_ps(indexV, indexStepV);
+		}
+		peak = std::max(peak, reduceMaxSSE3(peakV));
+		sumSquare += reduceAddSSE3(sumV);
+
+		gainAndLevelNormal(&(dst[clipMax]), gain + step * clipMax, step,
+			length - clipMax, peak, sumSquare);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void levelSSE3(const float* src,
+		int length, float& peak, float& sumSquare) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 absMaskV = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		__m128 peakV = _mm_setzero_ps();
+		__m128 sumV = _mm_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = loadSSE3<Aligned>(&(src[i]));
+			peakV = _mm_max_ps(peakV, _mm_and_ps(data, absMaskV));
+			sumV = _mm_add_ps(sumV, _mm_mul_ps(data, data));
+		}
+		peak = std::max(peak, reduceMaxSSE3(peakV));
+		sumSquare += reduceAddSSE3(sumV);
+
+		levelNormal(&(src[clipMax]), length - clipMax, peak, sumSquare);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void gainSSE3(float* dst, float gain, float step, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 gainV = _mm_set1_ps(gain);
+		__m128 stepV = _mm_set1_ps(step);
+		__m128 indexV = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+		__m128 indexStepV = _mm_set1_ps((float)clipSize);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = loadSSE3<Aligned>(&(dst[i]));
+			__m128 gainCurrentV = _mm_add_ps(gainV, _mm_mul_ps(stepV, indexV));
+			storeSSE3<Aligned>(&(dst[i]), _mm_mul_ps(data, gainCurrentV));
+			indexV = _mm_add_ps(indexV, indexStepV);
+		}
+
+		gainNormal(&(dst[clipMax]), gain + step * clipMax, step, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void addWithGainSSE3(float* dst, const float* src,
+		float gain, float step, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 gainV = _mm_set1_ps(gain);
+		__m128 stepV = _mm_set1_ps(step);
+		__m128 indexV = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+		__m128 indexStepV = _mm_set1_ps((float)clipSize);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = loadSSE3<Aligned>(&(dst[i]));
+			__m128 data1 = loadSSE3<Aligned>(&(src[i]));
+			__m128 gainCurrentV = _mm_add_ps(gainV, _mm_mul_ps(stepV, indexV));
+			storeSSE3<Aligned>(&(dst[i]), _mm_add_ps(data0, _mm_mul_ps(data1, gainCurrentV)));
+			indexV = _mm_add_ps(indexV, indexStepV);
+		}
+
+		addWithGainNormal(&(dst[clipMax]), &(src[clipMax]),
+			gain + step * clipMax, step, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void clampSSE3(float* dst, float minValue, float maxValue, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 minV = _mm_set1_ps(minValue);
+		__m128 maxV = _mm_set1_ps(maxValue);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = loadSSE3<Aligned>(&(dst[i]));
+			storeSSE3<Aligned>(&(dst[i]), _mm_min_ps(_mm_max_ps(data, minV), maxV));
+		}
+
+		clampNormal(&(dst[clipMax]), minValue, maxValue, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void flushDenormalSSE3(float* dst, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 absMaskV = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		__m128 normalMinV = _mm_set1_ps(std::numeric_limits<float>::min());
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = loadSSE3<Aligned>(&(dst[i]));
+			__m128 maskV = _mm_cmpge_ps(_mm_and_ps(data, absMaskV), normalMinV);
+			storeSSE3<Aligned>(&(dst[i]), _mm_and_ps(data, maskV));
+		}
+
+		flushDenormalNormal(&(dst[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void floatToIntSSE3(int32_t* dst, const float* src, float scale, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 scaleV = _mm_set1_ps(scale);
+		__m128 minV = _mm_set1_ps(-scale);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = _mm_mul_ps(loadSSE3<Aligned>(&(src[i])), scaleV);
+			data = _mm_min_ps(_mm_max_ps(data, minV), scaleV);
+			storeIntSSE3<Aligned>(&(dst[i]), _mm_cvtps_epi32(data));
+		}
+
+		floatToIntNormal(&(dst[clipMax]), &(src[clipMax]), scale, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void intToFloatSSE3(float* dst, const int32_t* src, float scale, int length) {
 		int clipSize = sizeof(__m128) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		for (int i = 0; i < clipMax; i+= clipSize) {
-			__m128 data = _mm_loadu_ps(&(src[i]));
-			_mm_storeu_ps(&(dst[i]), data);
+		__m128 invScaleV = _mm_set1_ps(1.f / scale);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = _mm_cvtepi32_ps(loadIntSSE3<Aligned>(&(src[i])));
+			storeSSE3<Aligned>(&(dst[i]), _mm_mul_ps(data, invScaleV));
+		}
+
+		intToFloatNormal(&(dst[clipMax]), &(src[clipMax]), scale, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void floatToDoubleSSE3(double* dst, const float* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = loadSSE3<Aligned>(&(src[i]));
+			storeDoubleSSE3<Aligned>(&(dst[i]), _mm_cvtps_pd(data));
+			storeDoubleSSE3<Aligned>(&(dst[i + 2]), _mm_cvtps_pd(_mm_movehl_ps(data, data)));
+		}
+
+		floatToDoubleNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void doubleToFloatSSE3(float* dst, const double* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 low = _mm_cvtpd_ps(loadDoubleSSE3<Aligned>(&(src[i])));
+			__m128 high = _mm_cvtpd_ps(loadDoubleSSE3<Aligned>(&(src[i + 2])));
+			storeSSE3<Aligned>(&(dst[i]), _mm_movelh_ps(low, high));
+		}
+
+		doubleToFloatNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void interleaveSSE3(float* dst,
+		const float* src0, const float* src1, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = loadSSE3<Aligned>(&(src0[i]));
+			__m128 data1 = loadSSE3<Aligned>(&(src1[i]));
+			storeSSE3<Aligned>(&(dst[i * 2]), _mm_unpacklo_ps(data0, data1));
+			storeSSE3<Aligned>(&(dst[i * 2 + clipSize]), _mm_unpackhi_ps(data0, data1));
+		}
+
+		interleaveNormal(&(dst[clipMax * 2]),
+			&(src0[clipMax]), &(src1[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_SSE3 static void deinterleaveSSE3(float* dst0, float* dst1,
+		const float* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = loadSSE3<Aligned>(&(src[i * 2]));
+			__m128 data1 = loadSSE3<Aligned>(&(src[i * 2 + clipSize]));
+			storeSSE3<Aligned>(&(dst0[i]), _mm_shuffle_ps(data0, data1, _MM_SHUFFLE(2, 0, 2, 0)));
+			storeSSE3<Aligned>(&(dst1[i]), _mm_shuffle_ps(data0, data1, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+
+		deinterleaveNormal(&(dst0[clipMax]), &(dst1[clipMax]),
+			&(src[clipMax * 2]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static inline __m256 loadAVX2(const float* src) {
+		if constexpr (Aligned) { return _mm256_load_ps(src); }
+		else { return _mm256_loadu_ps(src); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static inline void storeAVX2(float* dst, __m256 data) {
+		if constexpr (Aligned) { _mm256_store_ps(dst, data); }
+		else { _mm256_storeu_ps(dst, data); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static inline __m256i loadIntAVX2(const int32_t* src) {
+		if constexpr (Aligned) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(src)); }
+		else { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static inline void storeIntAVX2(int32_t* dst, __m256i data) {
+		if constexpr (Aligned) { _mm256_store_si256(reinterpret_cast<__m256i*>(dst), data); }
+		else { _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), data); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static inline __m256d loadDoubleAVX2(const double* src) {
+		if constexpr (Aligned) { return _mm256_load_pd(src); }
+		else { return _mm256_loadu_pd(src); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static inline void storeDoubleAVX2(double* dst, __m256d data) {
+		if constexpr (Aligned) { _mm256_store_pd(dst, data); }
+		else { _mm256_storeu_pd(dst, data); }
+	}
+
+	VMATH_TARGET_AVX2 static inline float reduceMaxAVX2(__m256 data) {
+		return reduceMaxSSE3(
+			_mm_max_ps(_mm256_castps256_ps128(data), _mm256_extractf128_ps(data, 1)));
+	}
+
+	VMATH_TARGET_AVX2 static inline float reduceAddAVX2(__m256 data) {
+		return reduceAddSSE3(
+			_mm_add_ps(_mm256_castps256_ps128(data), _mm256_extractf128_ps(data, 1)));
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void copyDataAVX2(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = loadAVX2<Aligned>(&(src[i]));
+			storeAVX2<Aligned>(&(dst[i]), data);
+		}
+
+		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void addDataAVX2(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = loadAVX2<Aligned>(&(dst[i]));
+			__m256 data1 = loadAVX2<Aligned>(&(src[i]));
+			__m256 result = _mm256_add_ps(data0, data1);
+			storeAVX2<Aligned>(&(dst[i]), result);
+		}
+
+		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void fillDataAVX2(float* dst, float data, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 dataV = _mm256_set1_ps(data);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			storeAVX2<Aligned>(&(dst[i]), dataV);
+		}
+
+		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void averageDataAVX2(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 averV = _mm256_set1_ps(0.5f);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = loadAVX2<Aligned>(&(dst[i]));
+			__m256 data1 = loadAVX2<Aligned>(&(src[i]));
+			__m256 sum = _mm256_add_ps(data0, data1);
+			__m256 result = _mm256_mul_ps(sum, averV);
+			storeAVX2<Aligned>(&(dst[i]), result);
+		}
+
+		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static float dotProductAVX2(const float* src0, const float* src1, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 sumV = _mm256_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = loadAVX2<Aligned>(&(src0[i]));
+			__m256 data1 = loadAVX2<Aligned>(&(src1[i]));
+			sumV = _mm256_add_ps(sumV, _mm256_mul_ps(data0, data1));
+		}
+
+		return reduceAddAVX2(sumV)
+			+ dotProductNormal(&(src0[clipMax]), &(src1[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void gainAndLevelAVX2(float* dst, float gain, float step,
+		int length, float& peak, float& sumSquare) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 gainV = _mm256_set1_ps(gain);
+		__m256 stepV = _mm256_set1_ps(step);
+		__m256 indexV = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+		__m256 indexStepV = _mm256_set1_ps((float)clipSize);
+		__m256 absMaskV = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+		__m256 peakV = _mm256_setzero_ps();
+		__m256 sumV = _mm256_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = loadAVX2<Aligned>(&(dst[i]));
+			__m256 gainCurrentV = _mm256_add_ps(gainV, _mm256_mul_ps(stepV, indexV));
+			__m256 result = _mm256_mul_ps(data, gainCurrentV);
+			storeAVX2<Aligned>(&(dst[i]), result);
+
+			peakV = _mm256_max_ps(peakV, _mm256_and_ps(result, absMaskV));
+			sumV = _mm256_add_ps(sumV, _mm256_mul_ps(result, result));
+			indexV = _mm256_add_ps(indexV, indexStepV);
+		}
+		peak = std::max(peak, reduceMaxAVX2(peakV));
+		sumSquare += reduceAddAVX2(sumV);
+
+		gainAndLevelNormal(&(dst[clipMax]), gain + step * clipMax, step,
+			length - clipMax, peak, sumSquare);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void levelAVX2(const float* src,
+		int length, float& peak, float& sumSquare) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 absMaskV = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+		__m256 peakV = _mm256_setzero_ps();
+		__m256 sumV = _mm256_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = loadAVX2<Aligned>(&(src[i]));
+			peakV = _mm256_max_ps(peakV, _mm256_and_ps(data, absMaskV));
+			sumV = _mm256_add_ps(sumV, _mm256_mul_ps(data, data));
+		}
+		peak = std::max(peak, reduceMaxAVX2(peakV));
+		sumSquare += reduceAddAVX2(sumV);
+
+		levelNormal(&(src[clipMax]), length - clipMax, peak, sumSquare);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void gainAVX2(float* dst, float gain, float step, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 gainV = _mm256_set1_ps(gain);
+		__m256 stepV = _mm256_set1_ps(step);
+		__m256 indexV = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+		__m256 indexStepV = _mm256_set1_ps((float)clipSize);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = loadAVX2<Aligned>(&(dst[i]));
+			__m256 gainCurrentV = _mm256_add_ps(gainV, _mm256_mul_ps(stepV, indexV));
+			storeAVX2<Aligned>(&(dst[i]), _mm256_mul_ps(data, gainCurrentV));
+			indexV = _mm256_add_ps(indexV, indexStepV);
+		}
+
+		gainNormal(&(dst[clipMax]), gain + step * clipMax, step, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void addWithGainAVX2(float* dst, const float* src,
+		float gain, float step, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 gainV = _mm256_set1_ps(gain);
+		__m256 stepV = _mm256_set1_ps(step);
+		__m256 indexV = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+		__m256 indexStepV = _mm256_set1_ps((float)clipSize);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = loadAVX2<Aligned>(&(dst[i]));
+			__m256 data1 = loadAVX2<Aligned>(&(src[i]));
+			__m256 gainCurrentV = _mm256_add_ps(gainV, _mm256_mul_ps(stepV, indexV));
+			storeAVX2<Aligned>(&(dst[i]), _mm256_add_ps(data0, _mm256_mul_ps(data1, gainCurrentV)));
+			indexV = _mm256_add_ps(indexV, indexStepV);
+		}
+
+		addWithGainNormal(&(dst[clipMax]), &(src[clipMax]),
+			gain + step * clipMax, step, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void clampAVX2(float* dst, float minValue, float maxValue, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 minV = _mm256_set1_ps(minValue);
+		__m256 maxV = _mm256_set1_ps(maxValue);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = loadAVX2<Aligned>(&(dst[i]));
+			storeAVX2<Aligned>(&(dst[i]), _mm256_min_ps(_mm256_max_ps(data, minV), maxV));
+		}
+
+		clampNormal(&(dst[clipMax]), minValue, maxValue, length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void flushDenormalAVX2(float* dst, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 absMaskV = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+		__m256 normalMinV = _mm256_set1_ps(std::numeric_limits<float>::min());
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = loadAVX2<Aligned>(&(dst[i]));
+			__m256 maskV = _mm256_cmp_ps(_mm256_and_ps(data, absMaskV), normalMinV, _CMP_GE_OQ);
+			storeAVX2<Aligned>(&(dst[i]), _mm256_and_ps(data, maskV));
 		}
 
-		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		flushDenormalNormal(&(dst[clipMax]), length - clipMax);
 	}
 
-	static void addDataSSE3(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m128) / sizeof(float);
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void floatToIntAVX2(int32_t* dst, const float* src, float scale, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
+		__m256 scaleV = _mm256_set1_ps(scale);
+		__m256 minV = _mm256_set1_ps(-scale);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m128 data0 = _mm_loadu_ps(&(dst[i]));
-			__m128 data1 = _mm_loadu_ps(&(src[i]));
-			__m128 result = _mm_add_ps(data0, data1);
-			_mm_storeu_ps(&(dst[i]), result);
+			__m256 data = _mm256_mul_ps(loadAVX2<Aligned>(&(src[i])), scaleV);
+			data = _mm256_min_ps(_mm256_max_ps(data, minV), scaleV);
+			storeIntAVX2<Aligned>(&(dst[i]), _mm256_cvtps_epi32(data));
 		}
 
-		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		floatToIntNormal(&(dst[clipMax]), &(src[clipMax]), scale, length - clipMax);
 	}
 
-	static void fillDataSSE3(float* dst, float data, int length) {
-		int clipSize = sizeof(__m128) / sizeof(float);
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void intToFloatAVX2(float* dst, const int32_t* src, float scale, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m128 dataV = _mm_set1_ps(data);
+		__m256 invScaleV = _mm256_set1_ps(1.f / scale);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			_mm_storeu_ps(&(dst[i]), dataV);
+			__m256 data = _mm256_cvtepi32_ps(loadIntAVX2<Aligned>(&(src[i])));
+			storeAVX2<Aligned>(&(dst[i]), _mm256_mul_ps(data, invScaleV));
 		}
 
-		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
+		intToFloatNormal(&(dst[clipMax]), &(src[clipMax]), scale, length - clipMax);
 	}
 
-	static void averageDataSSE3(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m128) / sizeof(float);
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void floatToDoubleAVX2(double* dst, const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m128 averV = _mm_set1_ps(0.5f);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m128 data0 = _mm_loadu_ps(&(dst[i]));
-			__m128 data1 = _mm_loadu_ps(&(src[i]));
-			__m128 sum = _mm_add_ps(data0, data1);
-			__m128 result = _mm_mul_ps(sum, averV);
-			_mm_storeu_ps(&(dst[i]), result);
+			__m256 data = loadAVX2<Aligned>(&(src[i]));
+			storeDoubleAVX2<Aligned>(&(dst[i]), _mm256_cvtps_pd(_mm256_castps256_ps128(data)));
+			storeDoubleAVX2<Aligned>(&(dst[i + 4]), _mm256_cvtps_pd(_mm256_extractf128_ps(data, 1)));
 		}
 
-		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		floatToDoubleNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void doubleToFloatAVX2(float* dst, const double* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 low = _mm256_cvtpd_ps(loadDoubleAVX2<Aligned>(&(src[i])));
+			__m128 high = _mm256_cvtpd_ps(loadDoubleAVX2<Aligned>(&(src[i + 4])));
+			storeAVX2<Aligned>(&(dst[i]), _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1));
+		}
+
+		doubleToFloatNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-#else //__SSE3__ || JUCE_MSVC
-	static void copyDataSSE3(float* dst, const float* src, int length) {
-		copyDataNormal(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void interleaveAVX2(float* dst,
+		const float* src0, const float* src1, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = loadAVX2<Aligned>(&(src0[i]));
+			__m256 data1 = loadAVX2<Aligned>(&(src1[i]));
+
+			/** Unpack Works In 128-bit Lanes, So Swap The Middle Lanes After It */
+			__m256 low = _mm256_unpacklo_ps(data0, data1);
+			__m256 high = _mm256_unpackhi_ps(data0, data1);
+			storeAVX2<Aligned>(&(dst[i * 2]), _mm256_permute2f128_ps(low, high, 0x20));
+			storeAVX2<Aligned>(&(dst[i * 2 + clipSize]), _mm256_permute2f128_ps(low, high, 0x31));
+		}
+
+		interleaveNormal(&(dst[clipMax * 2]),
+			&(src0[clipMax]), &(src1[clipMax]), length - clipMax);
 	}
 
-	static void addDataSSE3(float* dst, const float* src, int length) {
-		addDataNormal(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX2 static void deinterleaveAVX2(float* dst0, float* dst1,
+		const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = loadAVX2<Aligned>(&(src[i * 2]));
+			__m256 data1 = loadAVX2<Aligned>(&(src[i * 2 + clipSize]));
+
+			/** Shuffle Works In 128-bit Lanes, So Reorder The 64-bit Pairs After It */
+			__m256 even = _mm256_shuffle_ps(data0, data1, _MM_SHUFFLE(2, 0, 2, 0));
+			__m256 odd = _mm256_shuffle_ps(data0, data1, _MM_SHUFFLE(3, 1, 3, 1));
+			storeAVX2<Aligned>(&(dst0[i]), _mm256_castpd_ps(
+				_mm256_permute4x64_pd(_mm256_castps_pd(even), _MM_SHUFFLE(3, 1, 2, 0))));
+			storeAVX2<Aligned>(&(dst1[i]), _mm256_castpd_ps(
+				_mm256_permute4x64_pd(_mm256_castps_pd(odd), _MM_SHUFFLE(3, 1, 2, 0))));
+		}
+
+		deinterleaveNormal(&(dst0[clipMax]), &(dst1[clipMax]),
+			&(src[clipMax * 2]), length - clipMax);
 	}
 
-	static void fillDataSSE3(float* dst, float data, int length) {
-		fillDataNormal(dst, data, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static inline __m512 loadAVX512(const float* src) {
+		if constexpr (Aligned) { return _mm512_load_ps(src); }
+		else { return _mm512_loadu_ps(src); }
 	}
 
-	static void averageDataSSE3(float* dst, const float* src, int length) {
-		averageDataNormal(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static inline void storeAVX512(float* dst, __m512 data) {
+		if constexpr (Aligned) { _mm512_store_ps(dst, data); }
+		else { _mm512_storeu_ps(dst, data); }
 	}
 
-#endif //__SSE3__ || JUCE_MSVC
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static inline __m512i loadIntAVX512(const int32_t* src) {
+		if constexpr (Aligned) { return _mm512_load_si512(src); }
+		else { return _mm512_loadu_si512(src); }
+	}
 
-#if __AVX2__ || JUCE_MSVC
-	static void copyDataAVX2(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m256) / sizeof(float);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static inline void storeIntAVX512(int32_t* dst, __m512i data) {
+		if constexpr (Aligned) { _mm512_store_si512(dst, data); }
+		else { _mm512_storeu_si512(dst, data); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static inline __m512d loadDoubleAVX512(const double* src) {
+		if constexpr (Aligned) { return _mm512_load_pd(src); }
+		else { return _mm512_loadu_pd(src); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static inline void storeDoubleAVX512(double* dst, __m512d data) {
+		if constexpr (Aligned) { _mm512_store_pd(dst, data); }
+		else { _mm512_storeu_pd(dst, data); }
+	}
+
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void copyDataAVX512(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m256 data = _mm256_loadu_ps(&(src[i]));
-			_mm256_storeu_ps(&(dst[i]), data);
+			__m512 data = loadAVX512<Aligned>(&(src[i]));
+			storeAVX512<Aligned>(&(dst[i]), data);
 		}
 
 		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-	static void addDataAVX2(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m256) / sizeof(float);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void addDataAVX512(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m256 data0 = _mm256_loadu_ps(&(dst[i]));
-			__m256 data1 = _mm256_loadu_ps(&(src[i]));
-			__m256 result = _mm256_add_ps(data0, data1);
-			_mm256_storeu_ps(&(dst[i]), result);
+			__m512 data0 = loadAVX512<Aligned>(&(dst[i]));
+			__m512 data1 = loadAVX512<Aligned>(&(src[i]));
+			__m512 result = _mm512_add_ps(data0, data1);
+			storeAVX512<Aligned>(&(dst[i]), result);
 		}
 
 		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-	static void fillDataAVX2(float* dst, float data, int length) {
-		int clipSize = sizeof(__m256) / sizeof(float);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void fillDataAVX512(float* dst, float data, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m256 dataV = _mm256_set1_ps(data);
+		__m512 dataV = _mm512_set1_ps(data);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			_mm256_storeu_ps(&(dst[i]), dataV);
+			storeAVX512<Aligned>(&(dst[i]), dataV);
 		}
 
 		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
 	}
 
-	static void averageDataAVX2(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m256) / sizeof(float);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void averageDataAVX512(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m256 averV = _mm256_set1_ps(0.5f);
+		__m512 averV = _mm512_set1_ps(0.5f);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m256 data0 = _mm256_loadu_ps(&(dst[i]));
-			__m256 data1 = _mm256_loadu_ps(&(src[i]));
-			__m256 sum = _mm256_add_ps(data0, data1);
-			__m256 result = _mm256_mul_ps(sum, averV);
-			_mm256_storeu_ps(&(dst[i]), result);
+			__m512 data0 = loadAVX512<Aligned>(&(dst[i]));
+			__m512 data1 = loadAVX512<Aligned>(&(src[i]));
+			__m512 sum = _mm512_add_ps(data0, data1);
+			__m512 result = _mm512_mul_ps(sum, averV);
+			storeAVX512<Aligned>(&(dst[i]), result);
 		}
 
 		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-#else //__AVX2__ || JUCE_MSVC
-	static void copyDataAVX2(float* dst, const float* src, int length) {
-		copyDataSSE3(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static float dotProductAVX512(const float* src0, const float* src1, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m512 sumV = _mm512_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data0 = loadAVX512<Aligned>(&(src0[i]));
+			__m512 data1 = loadAVX512<Aligned>(&(src1[i]));
+			sumV = _mm512_fmadd_ps(data0, data1, sumV);
+		}
+
+		return _mm512_reduce_add_ps(sumV)
+			+ dotProductNormal(&(src0[clipMax]), &(src1[clipMax]), length - clipMax);
 	}
 
-	static void addDataAVX2(float* dst, const float* src, int length) {
-		addDataSSE3(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void gainAndLevelAVX512(float* dst, float gain, float step,
+		int length, float& peak, float& sumSquare) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m512 gainV = _mm512_set1_ps(gain);
+		__m512 stepV = _mm512_set1_ps(step);
+		__m512 indexV = _mm512_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f,
+			8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f);
+		__m512 indexStepV = _mm512_set1_ps((float)clipSize);
+		__m512 peakV = _mm512_setzero_ps();
+		__m512 sumV = _mm512_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data = loadAVX512<Aligned>(&(dst[i]));
+			__m512 gainCurrentV = _mm512_fmadd_ps(stepV, indexV, gainV);
+			__m512 result = _mm512_mul_ps(data, gainCurrentV);
+			storeAVX512<Aligned>(&(dst[i]), result);
+
+			peakV = _mm512_max_ps(peakV, _mm512_abs_ps(result));
+			sumV = _mm512_fmadd_ps(result, result, sumV);
+			indexV = _mm512_add_ps(indexV, indexStepV);
+		}
+		peak = std::max(peak, _mm512_reduce_max_ps(peakV));
+		sumSquare += _mm512_reduce_add_ps(sumV);
+
+		gainAndLevelNormal(&(dst[clipMax]), gain + step * clipMax, step,
+			length - clipMax, peak, sumSquare);
 	}
 
-	static void fillDataAVX2(float* dst, float data, int length) {
-		fillDataSSE3(dst, data, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void levelAVX512(const float* src,
+		int length, float& peak, float& sumSquare) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m512 peakV = _mm512_setzero_ps();
+		__m512 sumV = _mm512_setzero_ps();
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data = loadAVX512<Aligned>(&(src[i]));
+			peakV = _mm512_max_ps(peakV, _mm512_abs_ps(data));
+			sumV = _mm512_fmadd_ps(data, data, sumV);
+		}
+		peak = std::max(peak, _mm512_reduce_max_ps(peakV));
+		sumSquare += _mm512_reduce_add_ps(sumV);
+
+		levelNormal(&(src[clipMax]), length - clipMax, peak, sumSquare);
 	}
 
-	static void averageDataAVX2(float* dst, const float* src, int length) {
-		averageDataSSE3(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void gainAVX512(float* dst, float gain, float step, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m512 gainV = _mm512_set1_ps(gain);
+		__m512 stepV = _mm512_set1_ps(step);
+		__m512 indexV = _mm512_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f,
+			8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f);
+		__m512 indexStepV = _mm512_set1_ps((float)clipSize);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data = loadAVX512<Aligned>(&(dst[i]));
+			__m512 gainCurrentV = _mm512_fmadd_ps(stepV, indexV, gainV);
+			storeAVX512<Aligned>(&(dst[i]), _mm512_mul_ps(data, gainCurrentV));
+			indexV = _mm512_add_ps(indexV, indexStepV);
+		}
+
+		gainNormal(&(dst[clipMax]), gain + step * clipMax, step, length - clipMax);
 	}
 
-#endif //__AVX2__ || JUCE_MSVC
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void addWithGainAVX512(float* dst, const float* src,
+		float gain, float step, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m512 gainV = _mm512_set1_ps(gain);
+		__m512 stepV = _mm512_set1_ps(step);
+		__m512 indexV = _mm512_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f,
+			8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f);
+		__m512 indexStepV = _mm512_set1_ps((float)clipSize);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data0 = loadAVX512<Aligned>(&(dst[i]));
+			__m512 data1 = loadAVX512<Aligned>(&(src[i]));
+			__m512 gainCurrentV = _mm512_fmadd_ps(stepV, indexV, gainV);
+			storeAVX512<Aligned>(&(dst[i]), _mm512_fmadd_ps(data1, gainCurrentV, data0));
+			indexV = _mm512_add_ps(indexV, indexStepV);
+		}
+
+		addWithGainNormal(&(dst[clipMax]), &(src[clipMax]),
+			gain + step * clipMax, step, length - clipMax);
+	}
 
-#if __AVX512F__ || JUCE_MSVC
-	static void copyDataAVX512(float* dst, const float* src, int length) {
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void clampAVX512(float* dst, float minValue, float maxValue, int length) {
 		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
+		__m512 minV = _mm512_set1_ps(minValue);
+		__m512 maxV = _mm512_set1_ps(maxValue);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m512 data = _mm512_loadu_ps(&(src[i]));
-			_mm512_storeu_ps(&(dst[i]), data);
+			__m512 data = loadAVX512<Aligned>(&(dst[i]));
+			storeAVX512<Aligned>(&(dst[i]), _mm512_min_ps(_mm512_max_ps(data, minV), maxV));
 		}
 
-		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		clampNormal(&(dst[clipMax]), minValue, maxValue, length - clipMax);
 	}
 
-	static void addDataAVX512(float* dst, const float* src, int length) {
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void flushDenormalAVX512(float* dst, int length) {
 		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
+		__m512 normalMinV = _mm512_set1_ps(std::numeric_limits<float>::min());
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m512 data0 = _mm512_loadu_ps(&(dst[i]));
-			__m512 data1 = _mm512_loadu_ps(&(src[i]));
-			__m512 result = _mm512_add_ps(data0, data1);
-			_mm512_storeu_ps(&(dst[i]), result);
+			__m512 data = loadAVX512<Aligned>(&(dst[i]));
+			__mmask16 mask = _mm512_cmp_ps_mask(_mm512_abs_ps(data), normalMinV, _CMP_GE_OQ);
+			storeAVX512<Aligned>(&(dst[i]), _mm512_maskz_mov_ps(mask, data));
 		}
 
-		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		flushDenormalNormal(&(dst[clipMax]), length - clipMax);
 	}
 
-	static void fillDataAVX512(float* dst, float data, int length) {
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void floatToIntAVX512(int32_t* dst, const float* src, float scale, int length) {
 		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m512 dataV = _mm512_set1_ps(data);
+		__m512 scaleV = _mm512_set1_ps(scale);
+		__m512 minV = _mm512_set1_ps(-scale);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			_mm512_storeu_ps(&(dst[i]), dataV);
+			__m512 data = _mm512_mul_ps(loadAVX512<Aligned>(&(src[i])), scaleV);
+			data = _mm512_min_ps(_mm512_max_ps(data, minV), scaleV);
+			storeIntAVX512<Aligned>(&(dst[i]), _mm512_cvtps_epi32(data));
 		}
 
-		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
+		floatToIntNormal(&(dst[clipMax]), &(src[clipMax]), scale, length - clipMax);
 	}
 
-	static void averageDataAVX512(float* dst, const float* src, int length) {
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void intToFloatAVX512(float* dst, const int32_t* src, float scale, int length) {
 		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m512 averV = _mm512_set1_ps(0.5f);
+		__m512 invScaleV = _mm512_set1_ps(1.f / scale);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m512 data0 = _mm512_loadu_ps(&(dst[i]));
-			__m512 data1 = _mm512_loadu_ps(&(src[i]));
-			__m512 sum = _mm512_add_ps(data0, data1);
-			__m512 result = _mm512_mul_ps(sum, averV);
-			_mm512_storeu_ps(&(dst[i]), result);
+			__m512 data = _mm512_cvtepi32_ps(loadIntAVX512<Aligned>(&(src[i])));
+			storeAVX512<Aligned>(&(dst[i]), _mm512_mul_ps(data, invScaleV));
 		}
 
-		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		intToFloatNormal(&(dst[clipMax]), &(src[clipMax]), scale, length - clipMax);
 	}
 
-#else //__AVX512F__ || JUCE_MSVC
-	static void copyDataAVX512(float* dst, const float* src, int length) {
-		copyDataAVX2(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void floatToDoubleAVX512(double* dst, const float* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data = loadAVX512<Aligned>(&(src[i]));
+			__m256 high = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(data), 1));
+			storeDoubleAVX512<Aligned>(&(dst[i]), _mm512_cvtps_pd(_mm512_castps512_ps256(data)));
+			storeDoubleAVX512<Aligned>(&(dst[i + 8]), _mm512_cvtps_pd(high));
+		}
+
+		floatToDoubleNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-	static void addDataAVX512(float* dst, const float* src, int length) {
-		addDataAVX2(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void doubleToFloatAVX512(float* dst, const double* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 low = _mm512_cvtpd_ps(loadDoubleAVX512<Aligned>(&(src[i])));
+			__m256 high = _mm512_cvtpd_ps(loadDoubleAVX512<Aligned>(&(src[i + 8])));
+			storeAVX512<Aligned>(&(dst[i]), _mm512_castpd_ps(_mm512_insertf64x4(
+				_mm512_castps_pd(_mm512_castps256_ps512(low)), _mm256_castps_pd(high), 1)));
+		}
+
+		doubleToFloatNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-	static void fillDataAVX512(float* dst, float data, int length) {
-		fillDataAVX2(dst, data, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void interleaveAVX512(float* dst,
+		const float* src0, const float* src1, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		/** Index 0-15 Picks From The First Source And 16-31 From The Second */
+		__m512i lowIndexV = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19,
+			4, 20, 5, 21, 6, 22, 7, 23);
+		__m512i highIndexV = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27,
+			12, 28, 13, 29, 14, 30, 15, 31);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data0 = loadAVX512<Aligned>(&(src0[i]));
+			__m512 data1 = loadAVX512<Aligned>(&(src1[i]));
+			storeAVX512<Aligned>(&(dst[i * 2]), _mm512_permutex2var_ps(data0, lowIndexV, data1));
+			storeAVX512<Aligned>(&(dst[i * 2 + clipSize]), _mm512_permutex2var_ps(data0, highIndexV, data1));
+		}
+
+		interleaveNormal(&(dst[clipMax * 2]),
+			&(src0[clipMax]), &(src1[clipMax]), length - clipMax);
 	}
 
-	static void averageDataAVX512(float* dst, const float* src, int length) {
-		averageDataAVX2(dst, src, length);
+	template <bool Aligned>
+	VMATH_TARGET_AVX512 static void deinterleaveAVX512(float* dst0, float* dst1,
+		const float* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m512i evenIndexV = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14,
+			16, 18, 20, 22, 24, 26, 28, 30);
+		__m512i oddIndexV = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15,
+			17, 19, 21, 23, 25, 27, 29, 31);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data0 = loadAVX512<Aligned>(&(src[i * 2]));
+			__m512 data1 = loadAVX512<Aligned>(&(src[i * 2 + clipSize]));
+			storeAVX512<Aligned>(&(dst0[i]), _mm512_permutex2var_ps(data0, evenIndexV, data1));
+			storeAVX512<Aligned>(&(dst1[i]), _mm512_permutex2var_ps(data0, oddIndexV, data1));
+		}
+
+		deinterleaveNormal(&(dst0[clipMax]), &(dst1[clipMax]),
+			&(src[clipMax * 2]), length - clipMax);
 	}
 
-#endif //__AVX512F__ || JUCE_MSVC
+	/** Each Kernel List Is Indexed By Instruction Set, Then By Whether The Buffers Are Aligned */
+#define VMATH_KERNEL_LIST(name) { { \
+	{ vMath::name##Normal, vMath::name##Normal }, \
+	{ vMath::name##SSE3<false>, vMath::name##SSE3<true> }, \
+	{ vMath::name##AVX2<false>, vMath::name##AVX2<true> }, \
+	{ vMath::name##AVX512<false>, vMath::name##AVX512<true> } } }
+
+#else //VMATH_X86
+
+#define VMATH_KERNEL_LIST(name) { { \
+	{ vMath::name##Normal, vMath::name##Normal }, \
+	{ vMath::name##Normal, vMath::name##Normal }, \
+	{ vMath::name##Normal, vMath::name##Normal }, \
+	{ vMath::name##Normal, vMath::name##Normal } } }
+
+#endif //VMATH_X86
+
+	template <typename Func>
+	using KernelList = std::array<std::array<Func*, 2>, InsType::MaxNum>;
+
+	constexpr KernelList<decltype(copyDataNormal)> copyDataList = VMATH_KERNEL_LIST(copyData);
+	constexpr KernelList<decltype(addDataNormal)> addDataList = VMATH_KERNEL_LIST(addData);
+	constexpr KernelList<decltype(fillDataNormal)> fillDataList = VMATH_KERNEL_LIST(fillData);
+	constexpr KernelList<decltype(averageDataNormal)> averageDataList = VMATH_KERNEL_LIST(averageData);
+	constexpr KernelList<decltype(dotProductNormal)> dotProductList = VMATH_KERNEL_LIST(dotProduct);
+	constexpr KernelList<decltype(gainAndLevelNormal)> gainAndLevelList = VMATH_KERNEL_LIST(gainAndLevel);
+	constexpr KernelList<decltype(levelNormal)> levelList = VMATH_KERNEL_LIST(level);
+	constexpr KernelList<decltype(gainNormal)> gainList = VMATH_KERNEL_LIST(gain);
+	constexpr KernelList<decltype(addWithGainNormal)> addWithGainList = VMATH_KERNEL_LIST(addWithGain);
+	constexpr KernelList<decltype(clampNormal)> clampList = VMATH_KERNEL_LIST(clamp);
+	constexpr KernelList<decltype(flushDenormalNormal)> flushDenormalList = VMATH_KERNEL_LIST(flushDenormal);
+	constexpr KernelList<decltype(floatToIntNormal)> floatToIntList = VMATH_KERNEL_LIST(floatToInt);
+	constexpr KernelList<decltype(intToFloatNormal)> intToFloatList = VMATH_KERNEL_LIST(intToFloat);
+	constexpr KernelList<decltype(floatToDoubleNormal)> floatToDoubleList = VMATH_KERNEL_LIST(floatToDouble);
+	constexpr KernelList<decltype(doubleToFloatNormal)> doubleToFloatList = VMATH_KERNEL_LIST(doubleToFloat);
+	constexpr KernelList<decltype(interleaveNormal)> interleaveList = VMATH_KERNEL_LIST(interleave);
+	constexpr KernelList<decltype(deinterleaveNormal)> deinterleaveList = VMATH_KERNEL_LIST(deinterleave);
+
+#undef VMATH_KERNEL_LIST
+
+	/** Vector Width In Bytes */
+	constexpr std::array<int, InsType::MaxNum> alignmentList{
+		(int)sizeof(float), 16, 32, 64 };
 
 	static InsType type = InsType::Normal;
-	static auto copyData = copyDataNormal;
-	static auto addData = addDataNormal;
-	static auto fillData = fillDataNormal;
-	static auto averageData = averageDataNormal;
+
+	template <typename... Ptrs>
+	static bool isAligned(InsType type, const Ptrs*... ptrs) {
+		auto mask = (uintptr_t)(vMath::alignmentList[type] - 1);
+		return ((reinterpret_cast<uintptr_t>(ptrs) | ...) & mask) == 0;
+	}
 
 	void setInsType(InsType type) {
 		/** Check And Fallback */
-		if (type == InsType::AVX512 && !juce::SystemStats::hasAVX512F()) {
-			type = InsType::AVX2;
+		if (type >= InsType::MaxNum) {
+			type = InsType::AVX512;
 		}
-		if (type == InsType::AVX2 && !juce::SystemStats::hasAVX2()) {
-			type = InsType::SSE3;
-		}
-		if (type == InsType::SSE3 && !juce::SystemStats::hasSSE3()) {
-			type = InsType::Normal;
+		while (type > InsType::Normal && !vMath::isInsTypeSupported(type)) {
+			type = (InsType)(type - 1);
 		}
 		vMath::type = type;
-
-		/** Set Functions */
-		constexpr std::array<decltype(vMath::copyData), InsType::MaxNum> copyDataList
-			= { vMath::copyDataNormal, vMath::copyDataSSE3, vMath::copyDataAVX2, vMath::copyDataAVX512 };
-		constexpr std::array<decltype(vMath::addData), InsType::MaxNum> addDataList
-			= { vMath::addDataNormal, vMath::addDataSSE3, vMath::addDataAVX2, vMath::addDataAVX512 };
-		constexpr std::array<decltype(vMath::fillData), InsType::MaxNum> fillDataList
-			= { vMath::fillDataNormal, vMath::fillDataSSE3, vMath::fillDataAVX2, vMath::fillDataAVX512 };
-		constexpr std::array<decltype(vMath::averageData), InsType::MaxNum> averageDataList
-			= { vMath::averageDataNormal, vMath::averageDataSSE3, vMath::averageDataAVX2, vMath::averageDataAVX512 };
-		
-		vMath::copyData = copyDataList[type];
-		vMath::addData = addDataList[type];
-		vMath::fillData = fillDataList[type];
-		vMath::averageData = averageDataList[type];
 	}
 
 	InsType getInsType() {
 		return vMath::type;
 	}
 
+	bool isInsTypeSupported(InsType type) {
+		switch (type) {
+		case InsType::Normal:
+			return true;
+		case InsType::SSE3:
+			return VMATH_X86 && juce::SystemStats::hasSSE3();
+		case InsType::AVX2:
+			return VMATH_X86 && juce::SystemStats::hasAVX2();
+		case InsType::AVX512:
+			return VMATH_X86 && juce::SystemStats::hasAVX512F();
+		default:
+			return false;
+		}
+	}
+
+	InsType getBestInsType() {
+		for (int i = InsType::MaxNum - 1; i > InsType::Normal; i--) {
+			if (vMath::isInsTypeSupported((InsType)i)) {
+				return (InsType)i;
+			}
+		}
+		return InsType::Normal;
+	}
+
+	int getAlignment() {
+		return vMath::alignmentList[vMath::type];
+	}
+
 	constexpr std::array<const char*, InsType::MaxNum> insTypeNameList{
 		"Normal", "SSE3", "AVX2", "AVX512" };
 
@@ -321,7 +1321,9 @@ namespace vMath {
 		auto rPtr = src.getReadPointer(srcChannel);
 		if (!wPtr || !rPtr) { return; }
 
-		copyData(&(wPtr[dstStartSample]), &(rPtr[srcStartSample]), length);
+		auto dstPtr = &(wPtr[dstStartSample]);
+		auto srcPtr = &(rPtr[srcStartSample]);
+		copyDataList[type][isAligned(type, dstPtr, srcPtr)](dstPtr, srcPtr, length);
 	}
 
 	void addAudioData(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
@@ -330,7 +1332,9 @@ namespace vMath {
 		auto rPtr = src.getReadPointer(srcChannel);
 		if (!wPtr || !rPtr) { return; }
 
-		addData(&(wPtr[dstStartSample]), &(rPtr[srcStartSample]), length);
+		auto dstPtr = &(wPtr[dstStartSample]);
+		auto srcPtr = &(rPtr[srcStartSample]);
+		addDataList[type][isAligned(type, dstPtr, srcPtr)](dstPtr, srcPtr, length);
 	}
 
 	void fillAudioData(juce::AudioSampleBuffer& dst, float data,
@@ -338,7 +1342,538 @@ namespace vMath {
 		auto wPtr = dst.getWritePointer(dstChannel);
 		if (!wPtr) { return; }
 
-		fillData(&(wPtr[dstStartSample]), data, length);
+		auto dstPtr = &(wPtr[dstStartSample]);
+		fillDataList[type][isAligned(type, dstPtr)](dstPtr, data, length);
+	}
+
+	float dotProductData(const float* src0, const float* src1, int length) {
+		return dotProductList[type][isAligned(type, src0, src1)](src0, src1, length);
+	}
+
+	void gainAndLevelAudioData(juce::AudioSampleBuffer& dst, float startGain, float endGain,
+		int dstStartSample, int dstChannel, int length, float& peak, float& rms) {
+		peak = rms = 0;
+		auto wPtr = dst.getWritePointer(dstChannel);
+		if (!wPtr || length <= 0) { return; }
+
+		float sumSquare = 0;
+		auto dstPtr = &(wPtr[dstStartSample]);
+		gainAndLevelList[type][isAligned(type, dstPtr)](dstPtr, startGain,
+			(endGain - startGain) / length, length, peak, sumSquare);
+		rms = std::sqrt(sumSquare / length);
+	}
+
+	void levelAudioData(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length, float& peak, float& rms) {
+		peak = rms = 0;
+		auto rPtr = src.getReadPointer(srcChannel);
+		if (!rPtr || length <= 0) { return; }
+
+		float sumSquare = 0;
+		auto srcPtr = &(rPtr[srcStartSample]);
+		levelList[type][isAligned(type, srcPtr)](srcPtr, length, peak, sumSquare);
+		rms = std::sqrt(sumSquare / length);
+	}
+
+	void gainAudioData(juce::AudioSampleBuffer& dst, float startGain, float endGain,
+		int dstStartSample, int dstChannel, int length) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		if (!wPtr || length <= 0) { return; }
+
+		auto dstPtr = &(wPtr[dstStartSample]);
+		gainList[type][isAligned(type, dstPtr)](dstPtr, startGain,
+			(endGain - startGain) / length, length);
+	}
+
+	void addAudioDataWithGain(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
+		float startGain, float endGain,
+		int dstStartSample, int srcStartSample, int dstChannel, int srcChannel, int length) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		auto rPtr = src.getReadPointer(srcChannel);
+		if (!wPtr || !rPtr || length <= 0) { return; }
+
+		auto dstPtr = &(wPtr[dstStartSample]);
+		auto srcPtr = &(rPtr[srcStartSample]);
+		addWithGainList[type][isAligned(type, dstPtr, srcPtr)](dstPtr, srcPtr,
+			startGain, (endGain - startGain) / length, length);
+	}
+
+	void clampAudioData(juce::AudioSampleBuffer& dst, float minValue, float maxValue,
+		int dstStartSample, int dstChannel, int length) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		if (!wPtr) { return; }
+
+		auto dstPtr = &(wPtr[dstStartSample]);
+		clampList[type][isAligned(type, dstPtr)](dstPtr, minValue, maxValue, length);
+	}
+
+	void flushDenormalAudioData(juce::AudioSampleBuffer& dst,
+		int dstStartSample, int dstChannel, int length) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		if (!wPtr) { return; }
+
+		auto dstPtr = &(wPtr[dstStartSample]);
+		flushDenormalList[type][isAligned(type, dstPtr)](dstPtr, length);
+	}
+
+	/** Full Scale Of The Bit Depth, Kept Below 2^31 So The Largest Value Still Fits In int32 */
+	static float getIntScale(int bitDepth) {
+		bitDepth = std::clamp(bitDepth, 2, 32);
+		return std::min((float)((1LL << (bitDepth - 1)) - 1), 2147483520.f);
+	}
+
+	void floatToIntData(int32_t* dst, const float* src, int bitDepth, int length) {
+		if (!dst || !src) { return; }
+		floatToIntList[type][isAligned(type, dst, src)](
+			dst, src, vMath::getIntScale(bitDepth), length);
+	}
+
+	void intToFloatData(float* dst, const int32_t* src, int bitDepth, int length) {
+		if (!dst || !src) { return; }
+		intToFloatList[type][isAligned(type, dst, src)](
+			dst, src, vMath::getIntScale(bitDepth), length);
+	}
+
+	void floatToDoubleData(double* dst, const float* src, int length) {
+		if (!dst || !src) { return; }
+		floatToDoubleList[type][isAligned(type, dst, src)](dst, src, length);
+	}
+
+	void doubleToFloatData(float* dst, const double* src, int length) {
+		if (!dst || !src) { return; }
+		doubleToFloatList[type][isAligned(type, dst, src)](dst, src, length);
+	}
+
+	void interleaveAudioData(float* dst, const juce::AudioSampleBuffer& src,
+		int srcStartSample, int length) {
+		int channels = src.getNumChannels();
+		if (!dst || channels <= 0) { return; }
+
+		/** Stereo */
+		if (channels == 2) {
+			auto srcPtr0 = src.getReadPointer(0, srcStartSample);
+			auto srcPtr1 = src.getReadPointer(1, srcStartSample);
+			interleaveList[type][isAligned(type, dst, srcPtr0, srcPtr1)](
+				dst, srcPtr0, srcPtr1, length);
+			return;
+		}
+
+		/** Mono */
+		if (channels == 1) {
+			auto srcPtr = src.getReadPointer(0, srcStartSample);
+			copyDataList[type][isAligned(type, dst, srcPtr)](dst, srcPtr, length);
+			return;
+		}
+
+		/** Others */
+		for (int i = 0; i < channels; i++) {
+			auto srcPtr = src.getReadPointer(i, srcStartSample);
+			for (int j = 0; j < length; j++) {
+				dst[j * channels + i] = srcPtr[j];
+			}
+		}
+	}
+
+	void deinterleaveAudioData(juce::AudioSampleBuffer& dst, const float* src,
+		int dstStartSample, int length) {
+		int channels = dst.getNumChannels();
+		if (!src || channels <= 0) { return; }
+
+		/** Stereo */
+		if (channels == 2) {
+			auto dstPtr0 = dst.getWritePointer(0, dstStartSample);
+			auto dstPtr1 = dst.getWritePointer(1, dstStartSample);
+			deinterleaveList[type][isAligned(type, dstPtr0, dstPtr1, src)](
+				dstPtr0, dstPtr1, src, length);
+			return;
+		}
+
+		/** Mono */
+		if (channels == 1) {
+			auto dstPtr = dst.getWritePointer(0, dstStartSample);
+			copyDataList[type][isAligned(type, dstPtr, src)](dstPtr, src, length);
+			return;
+		}
+
+		/** Others */
+		for (int i = 0; i < channels; i++) {
+			auto dstPtr = dst.getWritePointer(i, dstStartSample);
+			for (int j = 0; j < length; j++) {
+				dstPtr[j] = src[j * channels + i];
+			}
+		}
+	}
+
+	double benchmarkGainAndLevel(InsType type,
+		int channels, int blockSize, int blockNum) {
+		if (type < InsType::Normal || type >= InsType::MaxNum) { return 0; }
+		if (channels <= 0 || blockSize <= 0 || blockNum <= 0) { return 0; }
+		if (!vMath::isInsTypeSupported(type)) { return 0; }
+
+		/** Test Data */
+		juce::AudioSampleBuffer buffer(channels, blockSize);
+		juce::Random random;
+		for (int i = 0; i < channels; i++) {
+			auto ptr = buffer.getWritePointer(i);
+			for (int j = 0; j < blockSize; j++) {
+				ptr[j] = random.nextFloat() * 2.f - 1.f;
+			}
+		}
+
+		/** Run Track Passes: Gain And Pan Before Plugins, Then Fader, Mute And Meter */
+		float result = 0;
+		auto startTicks = juce::Time::getHighResolutionTicks();
+		for (int i = 0; i < blockNum; i++) {
+			for (int j = 0; j < channels; j++) {
+				float peak = 0, sumSquare = 0;
+				auto ptr = buffer.getWritePointer(j);
+				auto gainAndLevelFunc = gainAndLevelList[type][isAligned(type, ptr)];
+				gainAndLevelFunc(ptr, 1.001f, -0.000001f, blockSize, peak, sumSquare);
+				gainAndLevelFunc(ptr, 0.999f, 0.000001f, blockSize, peak, sumSquare);
+				result += peak + sumSquare;
+			}
+		}
+		auto endTicks = juce::Time::getHighResolutionTicks();
+
+		/** Keep Result */
+		static std::atomic<float> resultSink = 0;
+		resultSink = result;
+
+		return juce::Time::highResolutionTicksToSeconds(endTicks - startTicks) / blockNum;
+	}
+
+	/** Buffer Aligned For Every Instruction Set, Offset By A Sample For The Unaligned Kernels */
+	template <typename T>
+	class AlignedBuffer final {
+	public:
+		AlignedBuffer(int length)
+			: data(length + 64 / sizeof(T) + 1) {}
+
+		T* get(bool aligned) {
+			auto ptr = reinterpret_cast<T*>(
+				(reinterpret_cast<uintptr_t>(this->data.data()) + 63) & ~(uintptr_t)63);
+			return aligned ? ptr : (ptr + 1);
+		}
+
+	private:
+		std::vector<T> data;
+	};
+
+	static bool checkData(const float* ref, const float* data, int length, float tolerance) {
+		for (int i = 0; i < length; i++) {
+			if (std::abs(ref[i] - data[i]) > tolerance * (1.f + std::abs(ref[i]))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool checkData(const int32_t* ref, const int32_t* data, int length) {
+		for (int i = 0; i < length; i++) {
+			if (std::abs((int64_t)ref[i] - (int64_t)data[i]) > 1) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	const juce::StringArray checkKernels(InsType type) {
+		juce::StringArray result;
+		if (type <= InsType::Normal || type >= InsType::MaxNum) { return result; }
+		if (!vMath::isInsTypeSupported(type)) { return result; }
+
+		/** Odd Length To Run Through Tails */
+		constexpr int length = 1021;
+		constexpr float tolerance = 1e-5f, sumTolerance = 1e-3f;
+
+		/** Test Data With Some Out Of Range And Denormal Samples */
+		juce::Random random{ 1 };
+		std::vector<float> src0(length), src1(length), srcInterleaved(length * 2);
+		std::vector<int32_t> srcInt(length);
+		for (int i = 0; i < length; i++) {
+			src0[i] = random.nextFloat() * 2.4f - 1.2f;
+			src1[i] = random.nextFloat() * 2.4f - 1.2f;
+			if (i % 7 == 0) { src0[i] = (i % 2 ? -1e-40f : 1e-40f); }
+			srcInt[i] = random.nextInt() >> 8;
+		}
+		for (int i = 0; i < length * 2; i++) {
+			srcInterleaved[i] = random.nextFloat() * 2.f - 1.f;
+		}
+
+		/** Reference Results */
+		std::vector<float> ref0(length), ref1(length), refInterleaved(length * 2);
+		std::vector<int32_t> refInt(length);
+
+		AlignedBuffer<float> buffer0(length), buffer1(length), bufferInterleaved(length * 2);
+		AlignedBuffer<int32_t> bufferInt(length);
+		AlignedBuffer<double> bufferDouble(length);
+		std::vector<double> refDouble(length);
+
+		auto addResult = [&result](const char* name, bool aligned) {
+			result.addIfNotAlreadyThere(juce::String{ name } + (aligned ? " (Aligned)" : ""));
+		};
+
+		for (int i = 0; i < 2; i++) {
+			bool aligned = (i == 1);
+			auto dst0 = buffer0.get(aligned);
+			auto dst1 = buffer1.get(aligned);
+			auto dstInterleaved = bufferInterleaved.get(aligned);
+			auto dstInt = bufferInt.get(aligned);
+			auto dstDouble = bufferDouble.get(aligned);
+			auto resetData = [&] {
+				std::copy(src0.begin(), src0.end(), dst0);
+				std::copy(src1.begin(), src1.end(), dst1);
+				std::copy(srcInterleaved.begin(), srcInterleaved.end(), dstInterleaved);
+				std::copy(srcInt.begin(), srcInt.end(), dstInt);
+				ref0 = src0;
+				ref1 = src1;
+				refInterleaved = srcInterleaved;
+				refInt = srcInt;
+			};
+
+			/** Copy */
+			resetData();
+			copyDataNormal(ref0.data(), ref1.data(), length);
+			copyDataList[type][aligned](dst0, dst1, length);
+			if (!checkData(ref0.data(), dst0, length, 0)) { addResult("Copy", aligned); }
+
+			/** Add */
+			resetData();
+			addDataNormal(ref0.data(), ref1.data(), length);
+			addDataList[type][aligned](dst0, dst1, length);
+			if (!checkData(ref0.data(), dst0, length, tolerance)) { addResult("Add", aligned); }
+
+			/** Fill */
+			resetData();
+			fillDataNormal(ref0.data(), 0.25f, length);
+			fillDataList[type][aligned](dst0, 0.25f, length);
+			if (!checkData(ref0.data(), dst0, length, 0)) { addResult("Fill", aligned); }
+
+			/** Average */
+			resetData();
+			averageDataNormal(ref0.data(), ref1.data(), length);
+			averageDataList[type][aligned](dst0, dst1, length);
+			if (!checkData(ref0.data(), dst0, length, tolerance)) { addResult("Average", aligned); }
+
+			/** Dot Product */
+			resetData();
+			{
+				float refSum = dotProductNormal(ref0.data(), ref1.data(), length);
+				float sum = dotProductList[type][aligned](dst0, dst1, length);
+				if (!checkData(&refSum, &sum, 1, sumTolerance)) { addResult("DotProduct", aligned); }
+			}
+
+			/** Gain And Level */
+			resetData();
+			{
+				float refPeak = 0, refSum = 0, peak = 0, sum = 0;
+				gainAndLevelNormal(ref0.data(), 0.5f, 0.001f, length, refPeak, refSum);
+				gainAndLevelList[type][aligned](dst0, 0.5f, 0.001f, length, peak, sum);
+				if (!checkData(ref0.data(), dst0, length, tolerance)
+					|| !checkData(&refPeak, &peak, 1, tolerance)
+					|| !checkData(&refSum, &sum, 1, sumTolerance)) {
+					addResult("GainAndLevel", aligned);
+				}
+			}
+
+			/** Level */
+			resetData();
+			{
+				float refPeak = 0, refSum = 0, peak = 0, sum = 0;
+				levelNormal(ref0.data(), length, refPeak, refSum);
+				levelList[type][aligned](dst0, length, peak, sum);
+				if (!checkData(&refPeak, &peak, 1, tolerance)
+					|| !checkData(&refSum, &sum, 1, sumTolerance)) {
+					addResult("Level", aligned);
+				}
+			}
+
+			/** Gain */
+			resetData();
+			gainNormal(ref0.data(), 1.5f, -0.001f, length);
+			gainList[type][aligned](dst0, 1.5f, -0.001f, length);
+			if (!checkData(ref0.data(), dst0, length, tolerance)) { addResult("Gain", aligned); }
+
+			/** Add With Gain */
+			resetData();
+			addWithGainNormal(ref0.data(), ref1.data(), 0.5f, 0.001f, length);
+			addWithGainList[type][aligned](dst0, dst1, 0.5f, 0.001f, length);
+			if (!checkData(ref0.data(), dst0, length, tolerance)) { addResult("AddWithGain", aligned); }
+
+			/** Clamp */
+			resetData();
+			clampNormal(ref0.data(), -1.f, 1.f, length);
+			clampList[type][aligned](dst0, -1.f, 1.f, length);
+			if (!checkData(ref0.data(), dst0, length, 0)) { addResult("Clamp", aligned); }
+
+			/** Flush Denormal */
+			resetData();
+			flushDenormalNormal(ref0.data(), length);
+			flushDenormalList[type][aligned](dst0, length);
+			if (!checkData(ref0.data(), dst0, length, 0)) { addResult("FlushDenormal", aligned); }
+
+			/** Float To Int */
+			resetData();
+			floatToIntNormal(refInt.data(), ref0.data(), vMath::getIntScale(24), length);
+			floatToIntList[type][aligned](dstInt, dst0, vMath::getIntScale(24), length);
+			if (!checkData(refInt.data(), dstInt, length)) { addResult("FloatToInt", aligned); }
+
+			/** Int To Float */
+			resetData();
+			intToFloatNormal(ref0.data(), refInt.data(), vMath::getIntScale(24), length);
+			intToFloatList[type][aligned](dst0, dstInt, vMath::getIntScale(24), length);
+			if (!checkData(ref0.data(), dst0, length, tolerance)) { addResult("IntToFloat", aligned); }
+
+			/** Float To Double */
+			resetData();
+			floatToDoubleNormal(refDouble.data(), ref0.data(), length);
+			floatToDoubleList[type][aligned](dstDouble, dst0, length);
+			if (!std::equal(refDouble.begin(), refDouble.end(), dstDouble)) { addResult("FloatToDouble", aligned); }
+
+			/** Double To Float */
+			resetData();
+			doubleToFloatNormal(ref0.data(), refDouble.data(), length);
+			doubleToFloatList[type][aligned](dst0, dstDouble, length);
+			if (!checkData(ref0.data(), dst0, length, 0)) { addResult("DoubleToFloat", aligned); }
+
+			/** Interleave */
+			resetData();
+			interleaveNormal(refInterleaved.data(), ref0.data(), ref1.data(), length);
+			interleaveList[type][aligned](dstInterleaved, dst0, dst1, length);
+			if (!checkData(refInterleaved.data(), dstInterleaved, length * 2, 0)) { addResult("Interleave", aligned); }
+
+			/** Deinterleave */
+			resetData();
+			deinterleaveNormal(ref0.data(), ref1.data(), refInterleaved.data(), length);
+			deinterleaveList[type][aligned](dst0, dst1, dstInterleaved, length);
+			if (!checkData(ref0.data(), dst0, length, 0)
+				|| !checkData(ref1.data(), dst1, length, 0)) {
+				addResult("Deinterleave", aligned);
+			}
+		}
+
+		return result;
+	}
+
+	struct KernelBenchmark final {
+		const char* name;
+		int bytesPerSample;
+		/** Type, Aligned, Dst, Src, Int Buffer, Interleaved Buffer, Length */
+		float (*run)(InsType, bool, float*, float*, int32_t*, float*, int);
+	};
+
+	/** Bytes Per Sample Counts What Is Read And Written In Each Channel */
+	const std::array<KernelBenchmark, 15> kernelBenchmarkList{ {
+		{ "Copy", 8, [](InsType t, bool a, float* dst, float* src, int32_t*, float*, int length) {
+			copyDataList[t][a](dst, src, length); return dst[0]; } },
+		{ "Add", 12, [](InsType t, bool a, float* dst, float* src, int32_t*, float*, int length) {
+			addDataList[t][a](dst, src, length); return dst[0]; } },
+		{ "Fill", 4, [](InsType t, bool a, float* dst, float*, int32_t*, float*, int length) {
+			fillDataList[t][a](dst, 0.5f, length); return dst[0]; } },
+		{ "Average", 12, [](InsType t, bool a, float* dst, float* src, int32_t*, float*, int length) {
+			averageDataList[t][a](dst, src, length); return dst[0]; } },
+		{ "DotProduct", 8, [](InsType t, bool a, float* dst, float* src, int32_t*, float*, int length) {
+			return dotProductList[t][a](dst, src, length); } },
+		{ "GainAndLevel", 8, [](InsType t, bool a, float* dst, float*, int32_t*, float*, int length) {
+			float peak = 0, sumSquare = 0;
+			gainAndLevelList[t][a](dst, 1.f, 0.f, length, peak, sumSquare); return peak + sumSquare; } },
+		{ "Level", 4, [](InsType t, bool a, float*, float* src, int32_t*, float*, int length) {
+			float peak = 0, sumSquare = 0;
+			levelList[t][a](src, length, peak, sumSquare); return peak + sumSquare; } },
+		{ "Gain", 8, [](InsType t, bool a, float* dst, float*, int32_t*, float*, int length) {
+			gainList[t][a](dst, 1.f, 0.f, length); return dst[0]; } },
+		{ "AddWithGain", 12, [](InsType t, bool a, float* dst, float* src, int32_t*, float*, int length) {
+			addWithGainList[t][a](dst, src, 0.5f, 0.f, length); return dst[0]; } },
+		{ "Clamp", 8, [](InsType t, bool a, float* dst, float*, int32_t*, float*, int length) {
+			clampList[t][a](dst, -0.5f, 0.5f, length); return dst[0]; } },
+		{ "FlushDenormal", 8, [](InsType t, bool a, float* dst, float*, int32_t*, float*, int length) {
+			flushDenormalList[t][a](dst, length); return dst[0]; } },
+		{ "FloatToInt", 8, [](InsType t, bool a, float*, float* src, int32_t* dstInt, float*, int length) {
+			floatToIntList[t][a](dstInt, src, vMath::getIntScale(24), length); return (float)dstInt[0]; } },
+		{ "IntToFloat", 8, [](InsType t, bool a, float* dst, float*, int32_t* srcInt, float*, int length) {
+			intToFloatList[t][a](dst, srcInt, vMath::getIntScale(24), length); return dst[0]; } },
+		{ "Interleave", 8, [](InsType t, bool a, float* dst, float* src, int32_t*, float* dstInterleaved, int length) {
+			interleaveList[t][a](dstInterleaved, src, dst, length); return dstInterleaved[0]; } },
+		{ "Deinterleave", 8, [](InsType t, bool a, float* dst, float* src, int32_t*, float* srcInterleaved, int length) {
+			deinterleaveList[t][a](dst, src, srcInterleaved, length); return dst[0]; } }
+	} };
+
+	const juce::StringArray getAllKernelName() {
+		juce::StringArray result;
+		for (auto& i : kernelBenchmarkList) {
+			result.add(juce::String{ i.name });
+		}
+		return result;
+	}
+
+	int getKernelBytesPerSample(const juce::String& kernel) {
+		for (auto& i : kernelBenchmarkList) {
+			if (kernel == i.name) {
+				return i.bytesPerSample;
+			}
+		}
+		return 0;
+	}
+
+	double benchmarkKernel(const juce::String& kernel, InsType type, bool aligned,
+		int channels, int blockSize, int blockNum) {
+		if (type < InsType::Normal || type >= InsType::MaxNum) { return 0; }
+		if (channels <= 0 || blockSize <= 0 || blockNum <= 0) { return 0; }
+		if (!vMath::isInsTypeSupported(type)) { return 0; }
+
+		/** Find Kernel */
+		auto it = std::find_if(kernelBenchmarkList.begin(), kernelBenchmarkList.end(),
+			[&kernel](const KernelBenchmark& item) { return kernel == item.name; });
+		if (it == kernelBenchmarkList.end()) { return 0; }
+		auto runFunc = it->run;
+
+		/** Test Data */
+		std::vector<std::unique_ptr<AlignedBuffer<float>>> dstList, srcList, interleavedList;
+		std::vector<std::unique_ptr<AlignedBuffer<int32_t>>> intList;
+		juce::Random random{ 1 };
+		for (int i = 0; i < channels; i++) {
+			dstList.push_back(std::make_unique<AlignedBuffer<float>>(blockSize));
+			srcList.push_back(std::make_unique<AlignedBuffer<float>>(blockSize));
+			interleavedList.push_back(std::make_unique<AlignedBuffer<float>>(blockSize * 2));
+			intList.push_back(std::make_unique<AlignedBuffer<int32_t>>(blockSize));
+
+			auto dst = dstList.back()->get(aligned);
+			auto src = srcList.back()->get(aligned);
+			auto interleaved = interleavedList.back()->get(aligned);
+			auto dstInt = intList.back()->get(aligned);
+			for (int j = 0; j < blockSize; j++) {
+				dst[j] = random.nextFloat() * 2.f - 1.f;
+				src[j] = random.nextFloat() * 2.f - 1.f;
+				interleaved[j * 2] = random.nextFloat() * 2.f - 1.f;
+				interleaved[j * 2 + 1] = random.nextFloat() * 2.f - 1.f;
+				dstInt[j] = random.nextInt() >> 8;
+			}
+		}
+
+		/** Run Blocks */
+		float result = 0;
+		auto runBlocks = [&](int num) {
+			for (int i = 0; i < num; i++) {
+				for (int j = 0; j < channels; j++) {
+					result += runFunc(type, aligned,
+						dstList[j]->get(aligned), srcList[j]->get(aligned),
+						intList[j]->get(aligned), interleavedList[j]->get(aligned), blockSize);
+				}
+			}
+		};
+
+		/** Warm Up Caches And Clock Before Timing */
+		runBlocks(std::max(1, blockNum / 8));
+
+		auto startTicks = juce::Time::getHighResolutionTicks();
+		runBlocks(blockNum);
+		auto endTicks = juce::Time::getHighResolutionTicks();
+
+		/** Keep Result */
+		static std::atomic<float> resultSink = 0;
+		resultSink = result;
+
+		return juce::Time::highResolutionTicksToSeconds(endTicks - startTicks) / blockNum;
 	}
 
 	void zeroAudioData(juce::AudioSampleBuffer& dst,
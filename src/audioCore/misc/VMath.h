@@ -8,8 +8,18 @@ namespace vMath {
 		MaxNum
 	};
 
+	/**
+	 * @brief	Select the kernels of an instruction set, falling back to the best one the CPU supports.
+	 */
 	void setInsType(InsType type);
 	InsType getInsType();
+	bool isInsTypeSupported(InsType type);
+	InsType getBestInsType();
+	/**
+	 * @brief	Vector width in bytes of the current instruction set.
+	 *			Buffers aligned to it take the aligned kernels.
+	 */
+	int getAlignment();
 	const juce::String getInsTypeName();
 	const juce::StringArray getAllInsTypeName();
 
@@ -25,4 +35,73 @@ namespace vMath {
 		int dstStartSample, int length);
 	void zeroAllAudioDataOnChannel(juce::AudioSampleBuffer& dst, int dstChannel);
 	void zeroAllAudioData(juce::AudioSampleBuffer& dst);
+
+	float dotProductData(const float* src0, const float* src1, int length);
+
+	/**
+	 * @brief	Multiply the data by a gain which moves linearly from startGain to endGain
+	 *			and measure the peak and RMS level of the result in the same pass.
+	 */
+	void gainAndLevelAudioData(juce::AudioSampleBuffer& dst, float startGain, float endGain,
+		int dstStartSample, int dstChannel, int length, float& peak, float& rms);
+	void levelAudioData(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length, float& peak, float& rms);
+
+	/**
+	 * @brief	Multiply the data by a gain which moves linearly from startGain to endGain.
+	 */
+	void gainAudioData(juce::AudioSampleBuffer& dst, float startGain, float endGain,
+		int dstStartSample, int dstChannel, int length);
+	/**
+	 * @brief	Add the source multiplied by a gain which moves linearly from startGain to endGain.
+	 */
+	void addAudioDataWithGain(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
+		float startGain, float endGain,
+		int dstStartSample, int srcStartSample, int dstChannel, int srcChannel, int length);
+	void clampAudioData(juce::AudioSampleBuffer& dst, float minValue, float maxValue,
+		int dstStartSample, int dstChannel, int length);
+	/**
+	 * @brief	Set denormal samples to zero.
+	 */
+	void flushDenormalAudioData(juce::AudioSampleBuffer& dst,
+		int dstStartSample, int dstChannel, int length);
+
+	/**
+	 * @brief	Convert between float samples in [-1, 1] and integer samples of the bit depth.
+	 *			Float samples out of range are clamped.
+	 */
+	void floatToIntData(int32_t* dst, const float* src, int bitDepth, int length);
+	void intToFloatData(float* dst, const int32_t* src, int bitDepth, int length);
+	void floatToDoubleData(double* dst, const float* src, int length);
+	void doubleToFloatData(float* dst, const double* src, int length);
+	void interleaveAudioData(float* dst, const juce::AudioSampleBuffer& src,
+		int srcStartSample, int length);
+	void deinterleaveAudioData(juce::AudioSampleBuffer& dst, const float* src,
+		int dstStartSample, int length);
+
+	/**
+	 * @brief	Time the track gain and meter passes with the given instruction set.
+	 * @return	Seconds per block.
+	 */
+	double benchmarkGainAndLevel(InsType type,
+		int channels, int blockSize, int blockNum);
+
+	const juce::StringArray getAllKernelName();
+	/**
+	 * @brief	Bytes read and written by a kernel for each sample of each channel.
+	 */
+	int getKernelBytesPerSample(const juce::String& kernel);
+	/**
+	 * @brief	Time a kernel with the given instruction set.
+	 * @return	Seconds per block, or 0 if the kernel or the instruction set is unavailable.
+	 */
+	double benchmarkKernel(const juce::String& kernel, InsType type, bool aligned,
+		int channels, int blockSize, int blockNum);
+
+	/**
+	 * @brief	Run every kernel of the instruction set against the scalar kernels
+	 *			on aligned and unaligned buffers.
+	 * @return	Names of the kernels which give different results.
+	 */
+	const juce::StringArray checkKernels(InsType type);
 }
@@ -0,0 +1,244 @@
+﻿#include "PluginLoadPool.h"
+#include "../uiCallback/UICallback.h"
+#include "../AudioConfig.h"
+
+#define PLUGIN_LOAD_ON_MESSAGE_THREAD 0
+
+PluginLoadPool::PluginLoadPool() {
+	this->pluginFormatManager.addDefaultFormats();
+}
+
+PluginLoadPool::~PluginLoadPool() {
+	for (auto i : this->workers) {
+		i->signalThreadShouldExit();
+	}
+	this->workers.clear();
+}
+
+void PluginLoadPool::load(const juce::PluginDescription& pluginInfo, bool addARA,
+	DstPointer ptr, const Callback& callback, double sampleRate, int blockSize) {
+	Task task{ 0, pluginInfo, addARA, ptr, callback,
+		sampleRate, blockSize, this->getPolicy(pluginInfo) };
+
+	{
+		juce::GenericScopedLock locker(this->lock);
+
+		/** Start New Stats When Idle */
+		if (this->nextDelivery == this->nextOrder) {
+			this->startTicks = juce::Time::getHighResolutionTicks();
+			this->currentStats = Stats{};
+		}
+
+		/** Add Task */
+		task.order = this->nextOrder++;
+		if (task.policy == Policy::MainThread) {
+			this->mainThreadList.push_back(task);
+		}
+		else {
+			this->list.push_back(task);
+		}
+
+		/** Add Workers Up To Config */
+		int threadNum = AudioConfig::getPluginLoadThreadNum();
+		for (int i = this->workers.size(); i < threadNum; i++) {
+			this->workers.add(std::make_unique<Worker>(this, i));
+		}
+		this->currentStats.threadNum = threadNum;
+	}
+
+	/** Start */
+	if (task.policy == Policy::MainThread) {
+		this->postMessage(new juce::Message);
+	}
+	else {
+		/** Restart Workers Which Already Found No Task */
+		for (auto i : this->workers) {
+			bool stopped = false;
+			{
+				juce::GenericScopedLock locker(this->lock);
+				stopped = i->stopped;
+				i->stopped = false;
+			}
+			if (stopped) {
+				i->waitForThreadToExit(-1);
+			}
+			i->startThread();
+		}
+	}
+}
+
+bool PluginLoadPool::isRunning() const {
+	juce::GenericScopedLock locker(this->lock);
+	return this->nextDelivery != this->nextOrder;
+}
+
+PluginLoadPool::Policy PluginLoadPool::getPolicy(
+	const juce::PluginDescription& pluginInfo) const {
+#if PLUGIN_LOAD_ON_MESSAGE_THREAD
+	return Policy::MainThread;
+#endif // PLUGIN_LOAD_ON_MESSAGE_THREAD
+
+	/** Formats Created On The Message Thread, Such As AUv3 */
+	for (auto i : this->pluginFormatManager.getFormats()) {
+		if (i->getName() == pluginInfo.pluginFormatName) {
+			if (i->requiresUnblockedMessageThreadDuringCreation(pluginInfo)) {
+				return Policy::MainThread;
+			}
+			break;
+		}
+	}
+
+	/** Many VST3 And AU Factories Are Not Safe To Use From Several Threads */
+	if (pluginInfo.pluginFormatName == "VST3"
+		|| pluginInfo.pluginFormatName == "AudioUnit") {
+		return Policy::Serial;
+	}
+
+	return Policy::Parallel;
+}
+
+const PluginLoadPool::Stats PluginLoadPool::getLastStats() const {
+	juce::GenericScopedLock locker(this->lock);
+	return this->lastStats;
+}
+
+bool PluginLoadPool::getNextTask(Task& task, Worker& worker) {
+	juce::GenericScopedLock locker(this->lock);
+
+	/** Skip Serial Tasks While Another One Is Running */
+	for (auto it = this->list.begin(); it != this->list.end(); it++) {
+		if (it->policy == Policy::Serial) {
+			if (this->serialBusy) { continue; }
+			this->serialBusy = true;
+		}
+
+		task = *it;
+		this->list.erase(it);
+		return true;
+	}
+
+	/** The Worker Running The Serial Task Will Take The Rest */
+	worker.stopped = true;
+	return false;
+}
+
+void PluginLoadPool::finishTask(const Task& task, Result result) {
+	{
+		juce::GenericScopedLock locker(this->lock);
+		if (task.policy == Policy::Serial) {
+			this->serialBusy = false;
+		}
+		this->finished.emplace(task.order, std::make_tuple(task, std::move(result)));
+	}
+
+	/** Deliver On Message Thread */
+	this->postMessage(new juce::Message);
+}
+
+void PluginLoadPool::handleMessage(const juce::Message& /*message*/) {
+	this->startMainThreadTasks();
+	this->deliverResults();
+}
+
+void PluginLoadPool::startMainThreadTasks() {
+	std::deque<Task> tasks;
+	{
+		juce::GenericScopedLock locker(this->lock);
+		tasks.swap(this->mainThreadList);
+	}
+
+	for (auto& task : tasks) {
+		int64_t startTicks = juce::Time::getHighResolutionTicks();
+		this->pluginFormatManager.createPluginInstanceAsync(
+			task.pluginInfo, task.sampleRate, task.blockSize,
+			[this, task, startTicks](std::unique_ptr<juce::AudioPluginInstance> instance, const juce::String& errorMessage) {
+				Result result;
+				result.instance = std::move(instance);
+				result.errorMessage = errorMessage;
+				result.seconds = juce::Time::highResolutionTicksToSeconds(
+					juce::Time::getHighResolutionTicks() - startTicks);
+				this->finishTask(task, std::move(result));
+			});
+	}
+}
+
+void PluginLoadPool::deliverResults() {
+	while (true) {
+		/** Get Next Result In Request Order */
+		Task task;
+		Result result;
+		{
+			juce::GenericScopedLock locker(this->lock);
+
+			auto it = this->finished.find(this->nextDelivery);
+			if (it == this->finished.end()) { break; }
+
+			task = std::get<0>(it->second);
+			result = std::move(std::get<1>(it->second));
+			this->finished.erase(it);
+			this->nextDelivery++;
+
+			/** Stats */
+			this->currentStats.plugins.add({ task.pluginInfo.name, task.pluginInfo.pluginFormatName,
+				result.seconds, result.instance != nullptr });
+			if (this->nextDelivery == this->nextOrder) {
+				this->currentStats.seconds = juce::Time::highResolutionTicksToSeconds(
+					juce::Time::getHighResolutionTicks() - this->startTicks);
+				this->currentStats.id = this->lastStats.id + 1;
+				this->lastStats = this->currentStats;
+			}
+		}
+
+		/** Set Plugin */
+		if (result.instance) {
+			auto identifier = task.pluginInfo.createIdentifierString();
+
+			if (auto plugin = task.ptr.getPlugin()) {
+				plugin->setPlugin(std::move(result.instance), identifier, task.callback,
+					task.addARA && task.pluginInfo.hasARAExtension);
+			}
+
+			continue;
+		}
+
+		/** Handle Error */
+		UICallbackAPI<const juce::String&, const juce::String&>::invoke(
+			UICallbackType::ErrorAlert, "Load Plugin",
+			"Can't load plugin with error message: " + result.errorMessage);
+		jassertfalse;
+	}
+}
+
+PluginLoadPool::Result PluginLoadPool::createInstance(
+	juce::AudioPluginFormatManager& manager, const Task& task) {
+	int64_t startTicks = juce::Time::getHighResolutionTicks();
+
+	Result result;
+	result.instance = manager.createPluginInstance(
+		task.pluginInfo, task.sampleRate, task.blockSize, result.errorMessage);
+	result.seconds = juce::Time::highResolutionTicksToSeconds(
+		juce::Time::getHighResolutionTicks() - startTicks);
+
+	return result;
+}
+
+PluginLoadPool::Worker::Worker(PluginLoadPool* parent, int index)
+	: Thread("Plugin Load " + juce::String{ index }), parent(parent) {
+	this->pluginFormatManager.addDefaultFormats();
+}
+
+PluginLoadPool::Worker::~Worker() {
+	this->stopThread(30000);
+}
+
+void PluginLoadPool::Worker::run() {
+	while (!this->threadShouldExit()) {
+		/** Get Next Task */
+		Task task;
+		if (!this->parent->getNextTask(task, *this)) { break; }
+
+		/** Create Instance */
+		this->parent->finishTask(task,
+			PluginLoadPool::createInstance(this->pluginFormatManager, task));
+	}
+}
@@ -0,0 +1,99 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "../graph/PluginDecorator.h"
+
+/**
+ * @brief	Instantiates plugins on a pool of worker threads.
+ *			Plugins of formats which are not safe to create in parallel are created one at a time,
+ *			and plugins which need the message thread are created there.
+ *			Loaded plugins are handed to their decorators in the order they were requested.
+ */
+class PluginLoadPool final : private juce::MessageListener {
+public:
+	PluginLoadPool();
+	~PluginLoadPool() override;
+
+	using Callback = std::function<void()>;
+	using DstPointer = PluginDecorator::SafePointer;
+	void load(const juce::PluginDescription& pluginInfo, bool addARA,
+		DstPointer ptr, const Callback& callback, double sampleRate, int blockSize);
+
+	bool isRunning() const;
+
+	enum class Policy {
+		Parallel, Serial, MainThread
+	};
+	Policy getPolicy(const juce::PluginDescription& pluginInfo) const;
+
+	/** Instantiation Time Of The Last Finished Load */
+	struct Stats final {
+		uint64_t id = 0;
+		double seconds = 0;
+		int threadNum = 0;
+		/** Name, Format, Seconds, Loaded */
+		juce::Array<std::tuple<juce::String, juce::String, double, bool>> plugins;
+	};
+	const Stats getLastStats() const;
+
+private:
+	class Worker final : public juce::Thread {
+	public:
+		Worker() = delete;
+		Worker(PluginLoadPool* parent, int index);
+		~Worker() override;
+
+	protected:
+		void run() override;
+
+	private:
+		friend class PluginLoadPool;
+		PluginLoadPool* const parent;
+		juce::AudioPluginFormatManager pluginFormatManager;
+		/** Found No Task And Is Exiting, Guarded By The Pool Lock */
+		bool stopped = true;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+	};
+	juce::OwnedArray<Worker> workers;
+
+	struct Task final {
+		uint64_t order = 0;
+		juce::PluginDescription pluginInfo;
+		bool addARA = false;
+		DstPointer ptr;
+		Callback callback;
+		double sampleRate = 0;
+		int blockSize = 0;
+		Policy policy = Policy::Parallel;
+	};
+	struct Result final {
+		std::unique_ptr<juce::AudioPluginInstance> instance = nullptr;
+		juce::String errorMessage;
+		double seconds = 0;
+	};
+
+	mutable juce::CriticalSection lock;
+	std::deque<Task> list, mainThreadList;
+	/** Order, Finished Tasks Waiting For Earlier Ones */
+	std::map<uint64_t, std::tuple<Task, Result>> finished;
+	uint64_t nextOrder = 0, nextDelivery = 0;
+	bool serialBusy = false;
+
+	int64_t startTicks = 0;
+	Stats currentStats, lastStats;
+
+	/** Used On The Message Thread */
+	juce::AudioPluginFormatManager pluginFormatManager;
+
+	bool getNextTask(Task& task, Worker& worker);
+	void finishTask(const Task& task, Result result);
+	void handleMessage(const juce::Message& message) override;
+	void startMainThreadTasks();
+	void deliverResults();
+
+	static Result createInstance(
+		juce::AudioPluginFormatManager& manager, const Task& task);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginLoadPool)
+};
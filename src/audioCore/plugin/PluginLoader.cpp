@@ -3,7 +3,7 @@
 #include "../Utils.h"
 
 PluginLoader::PluginLoader() {
-	this->loadThread = std::make_unique<PluginLoadThread>();
+	this->loadPool = std::make_unique<PluginLoadPool>();
 }
 
 void PluginLoader::loadPlugin(
@@ -19,11 +19,15 @@ void PluginLoader::loadPlugin(
 	int bufferSize = mainGraph->getBlockSize();
 
 	/** Create Task */
-	this->loadThread->load(pluginInfo, addARA, ptr, callback, sampleRate, bufferSize);
+	this->loadPool->load(pluginInfo, addARA, ptr, callback, sampleRate, bufferSize);
 }
 
 bool PluginLoader::isRunning() const {
-	return this->loadThread->isThreadRunning();
+	return this->loadPool->isRunning();
+}
+
+const PluginLoadPool::Stats PluginLoader::getLastStats() const {
+	return this->loadPool->getLastStats();
 }
 
 PluginLoader* PluginLoader::getInstance() {
@@ -1,22 +1,23 @@
 ﻿#pragma once
 
 #include <JuceHeader.h>
-#include "PluginLoadThread.h"
+#include "PluginLoadPool.h"
 
 class PluginLoader final : private juce::DeletedAtShutdown {
 public:
 	PluginLoader();
 	~PluginLoader() override = default;
 
-	using Callback = PluginLoadThread::Callback;
+	using Callback = PluginLoadPool::Callback;
 	void loadPlugin(const juce::PluginDescription& pluginInfo,
 		bool addARA, PluginDecorator::SafePointer ptr,
 		const Callback& callback = [] {});
 
 	bool isRunning() const;
+	const PluginLoadPool::Stats getLastStats() const;
 
 private:
-	std::unique_ptr<PluginLoadThread> loadThread = nullptr;
+	std::unique_ptr<PluginLoadPool> loadPool = nullptr;
 
 public:
 	static PluginLoader* getInstance();
@@ -0,0 +1,98 @@
+﻿#include "ProjectSaveThread.h"
+#include "../Utils.h"
+
+ProjectSaveThread::ProjectSaveThread()
+	: Thread("Project Save") {}
+
+ProjectSaveThread::~ProjectSaveThread() {
+	if (this->isThreadRunning()) {
+		this->signalThreadShouldExit();
+		this->notify();
+		this->stopThread(30000);
+	}
+}
+
+void ProjectSaveThread::addTask(const juce::File& file,
+	std::unique_ptr<google::protobuf::Message> data, const Callback& callback) {
+	if (!data) { return; }
+
+	{
+		/** Lock */
+		juce::GenericScopedLock locker(this->lock);
+
+		/** Push To Task List */
+		this->list.push({ file, std::shared_ptr<google::protobuf::Message>(data.release()), callback });
+		this->pendingNum++;
+	}
+
+	/** Wake The Thread, Which Waits For Tasks Until Shutdown */
+	this->startThread();
+	this->notify();
+}
+
+bool ProjectSaveThread::hasPendingTask() const {
+	return this->pendingNum > 0;
+}
+
+void ProjectSaveThread::run() {
+	/** Drain The Queue Before Exiting, Or The Last Save Before Shutdown Is Lost */
+	while (true) {
+		/** Get Next Task */
+		Task task;
+		{
+			juce::GenericScopedLock locker(this->lock);
+
+			/** Wait For Task */
+			if (this->list.empty()) {
+				if (this->threadShouldExit()) { break; }
+
+				juce::GenericScopedUnlock unlocker(this->lock);
+				this->wait(1000);
+				continue;
+			}
+
+			/** Dequeue Task */
+			task = this->list.front();
+			this->list.pop();
+		}
+
+		/** Write Project */
+		auto& [file, data, callback] = task;
+		bool result = ProjectSaveThread::writeToFile(file, *data);
+
+		/** Release Data Before Callback */
+		data = nullptr;
+		this->pendingNum--;
+
+		/** Callback */
+		juce::MessageManager::callAsync(
+			[file, result, callback] {
+				if (callback) { callback(file, result); }
+			}
+		);
+	}
+}
+
+bool ProjectSaveThread::writeToFile(const juce::File& file, const google::protobuf::Message& data) {
+	/** Encode */
+	juce::MemoryBlock block;
+	block.setSize(data.ByteSizeLong());
+	if (!data.SerializeToArray(block.getData(), block.getSize())) { return false; }
+
+	/** Write */
+	return utils::writeBlockToFile(file.getFullPathName(), block);
+}
+
+ProjectSaveThread* ProjectSaveThread::getInstance() {
+	return ProjectSaveThread::instance
+		? ProjectSaveThread::instance : (ProjectSaveThread::instance = new ProjectSaveThread);
+}
+
+void ProjectSaveThread::releaseInstance() {
+	if (ProjectSaveThread::instance) {
+		delete ProjectSaveThread::instance;
+		ProjectSaveThread::instance = nullptr;
+	}
+}
+
+ProjectSaveThread* ProjectSaveThread::instance = nullptr;
@@ -0,0 +1,46 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include <google/protobuf/message.h>
+
+/**
+ * @brief	Encodes and writes project files in the background.
+ *			The file is written beside the target and renamed over it, so a failed save never breaks the old project.
+ */
+class ProjectSaveThread final : public juce::Thread,
+	private juce::DeletedAtShutdown {
+public:
+	ProjectSaveThread();
+	~ProjectSaveThread() override;
+
+	/** File, Result */
+	using Callback = std::function<void(const juce::File&, bool)>;
+	void addTask(const juce::File& file,
+		std::unique_ptr<google::protobuf::Message> data, const Callback& callback);
+
+	/**
+	 * @brief	Whether a project write is queued or still running.
+	 */
+	bool hasPendingTask() const;
+
+protected:
+	void run() override;
+
+private:
+	/** File, Data, Callback */
+	using Task = std::tuple<juce::File, std::shared_ptr<google::protobuf::Message>, Callback>;
+	std::queue<Task> list;
+	juce::CriticalSection lock;
+	std::atomic_int pendingNum = 0;
+
+	static bool writeToFile(const juce::File& file, const google::protobuf::Message& data);
+
+public:
+	static ProjectSaveThread* getInstance();
+	static void releaseInstance();
+
+private:
+	static ProjectSaveThread* instance;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProjectSaveThread)
+};
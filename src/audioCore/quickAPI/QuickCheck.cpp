@@ -2,6 +2,7 @@
 #include "../misc/Renderer.h"
 #include "../misc/PlayPosition.h"
 #include "../source/SourceIO.h"
+#include "../project/ProjectSaveThread.h"
 #include "../source/SourceManager.h"
 #include "../plugin/PluginLoader.h"
 #include "../plugin/Plugin.h"
@@ -14,7 +15,8 @@ namespace quickAPI {
 	}
 
 	bool checkSourceIORunning() {
-		return SourceIO::getInstance()->isThreadRunning();
+		return SourceIO::getInstance()->isRunning()
+			|| ProjectSaveThread::getInstance()->hasPendingTask();
 	}
 
 	bool checkPluginLoading() {
@@ -26,7 +28,9 @@ namespace quickAPI {
 	}
 
 	bool checkProjectSaved() {
-		return ProjectInfoData::getInstance()->checkSaved();
+		/** The Project Isn't Saved Until Its File Is Written */
+		return ProjectInfoData::getInstance()->checkSaved()
+			&& !ProjectSaveThread::getInstance()->hasPendingTask();
 	}
 
 	bool checkSourcesSaved() {
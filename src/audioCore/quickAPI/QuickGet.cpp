@@ -4,7 +4,10 @@
 #include "../misc/Device.h"
 #include "../misc/PlayPosition.h"
 #include "../misc/VMath.h"
+#include "../misc/DSPProfiler.h"
 #include "../source/SourceManager.h"
+#include "../source/SourceIO.h"
+#include "../source/AudioStreamCache.h"
 
 namespace quickAPI {
 	juce::Component* getAudioDebugger() {
@@ -23,6 +26,32 @@ namespace quickAPI {
 		return Device::getInstance()->getCPUUsage();
 	}
 
+	uint64_t getAudioMutedBlockNum() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			return graph->getMutedBlockNum();
+		}
+		return 0;
+	}
+
+	uint64_t getAudioEventOverflowNum() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			return graph->getAudioEventOverflowNum();
+		}
+		return 0;
+	}
+
+	uint64_t getAudioStreamCacheHitNum() {
+		return AudioStreamCache::getInstance()->getHitNum();
+	}
+
+	uint64_t getAudioStreamCacheMissNum() {
+		return AudioStreamCache::getInstance()->getMissNum();
+	}
+
+	int64_t getAudioStreamCacheUsage() {
+		return AudioStreamCache::getInstance()->getMemoryUsage();
+	}
+
 	bool getReturnToStartOnStop() {
 		return AudioCore::getInstance()->getReturnToPlayStartPosition();
 	}
@@ -55,13 +84,24 @@ namespace quickAPI {
 		return PlayPosition::getInstance()->getLoopingTimeSec();
 	}
 
-	const juce::Array<float> getAudioOutputLevel() {
+	LevelMeterPointer getAudioOutputMeter() {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
-			return graph->getOutputLevels();
+			return graph->getOutputMeter();
+		}
+		return nullptr;
+	}
+
+	const DSPLoad getAudioCallbackDSPLoad() {
+		if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+			return profiler->getCallbackLoad();
 		}
 		return {};
 	}
 
+	const juce::Array<SourceLoadProgress> getSourceLoadProgress() {
+		return SourceIO::getInstance()->getProgress();
+	}
+
 	bool isPlaying() {
 		auto pos = PlayPosition::getInstance()->getPosition();
 		return pos->getIsPlaying();
@@ -383,6 +423,17 @@ namespace quickAPI {
 		return false;
 	}
 
+	const DSPLoad getInstrDSPLoad(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getSourceProcessor(index)) {
+				if (auto instr = track->getInstrProcessor()) {
+					return instr->getDSPLoad();
+				}
+			}
+		}
+		return {};
+	}
+
 	EditorPointer getInstrEditor(int index) {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			if (auto track = graph->getSourceProcessor(index)) {
@@ -482,6 +533,19 @@ namespace quickAPI {
 		return false;
 	}
 
+	const DSPLoad getEffectDSPLoad(int trackIndex, int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getTrackProcessor(trackIndex)) {
+				if (auto pluginDock = track->getPluginDock()) {
+					if (auto plugin = pluginDock->getPluginProcessor(index)) {
+						return plugin->getDSPLoad();
+					}
+				}
+			}
+		}
+		return {};
+	}
+
 	const juce::String getEffectName(PluginHolder pointer) {
 		return getPluginName(pointer);
 	}
@@ -643,10 +707,19 @@ namespace quickAPI {
 		return false;
 	}
 
-	const juce::Array<float> getSeqTrackOutputLevel(int index) {
+	LevelMeterPointer getSeqTrackOutputMeter(int index) {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			if (auto track = graph->getSourceProcessor(index)) {
-				return track->getOutputLevels();
+				return track->getOutputMeter();
+			}
+		}
+		return nullptr;
+	}
+
+	const DSPLoad getSeqTrackDSPLoad(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getSourceProcessor(index)) {
+				return track->getDSPLoad();
 			}
 		}
 		return {};
@@ -715,6 +788,16 @@ namespace quickAPI {
 		return {};
 	}
 
+	const AudioPeak getSeqTrackAudioPeak(int index, double startSec, double endSec, int pointNum) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getSourceProcessor(index)) {
+				auto ref = track->getAudioRef();
+				return SourceManager::getInstance()->getAudioPeak(ref, startSec, endSec, pointNum);
+			}
+		}
+		return { true, {} };
+	}
+
 	/*const juce::MidiMessageSequence getSeqTrackMIDIData(int index) {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			if (auto track = graph->getSourceProcessor(index)) {
@@ -933,10 +1016,19 @@ namespace quickAPI {
 		return getMixerTrackChannelSet(index).size() == 2;
 	}
 
-	const juce::Array<float> getMixerTrackOutputLevel(int index) {
+	LevelMeterPointer getMixerTrackOutputMeter(int index) {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			if (auto track = graph->getTrackProcessor(index)) {
-				return track->getOutputLevels();
+				return track->getOutputMeter();
+			}
+		}
+		return nullptr;
+	}
+
+	const DSPLoad getMixerTrackDSPLoad(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getTrackProcessor(index)) {
+				return track->getDSPLoad();
 			}
 		}
 		return {};
@@ -1076,4 +1168,16 @@ namespace quickAPI {
 		return SourceManager::getInstance()->getMIDINoteList(
 			ref, track);
 	}
+
+	const NoteList getMIDISourceNotesInArea(uint64_t ref, int track,
+		double startSec, double endSec, uint8_t minPitch, uint8_t maxPitch) {
+		if (ref == 0) { return {}; }
+		return SourceManager::getInstance()->getMIDINoteListInArea(
+			ref, track, startSec, endSec, minPitch, maxPitch);
+	}
+
+	const std::tuple<uint8_t, uint8_t> getMIDISourceNotePitchRange(uint64_t ref, int track) {
+		if (ref == 0) { return { 0, 0 }; }
+		return SourceManager::getInstance()->getMIDINotePitchRange(ref, track);
+	}
 }
\ No newline at end of file
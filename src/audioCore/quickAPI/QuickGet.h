@@ -3,6 +3,7 @@
 #include <JuceHeader.h>
 #include "../graph/PluginDecorator.h"
 #include "../source/SourceMIDITemp.h"
+#include "../misc/LevelMeter.h"
 #include "../Utils.h"
 
 namespace quickAPI {
@@ -12,6 +13,11 @@ namespace quickAPI {
 	const juce::File getProjectDir();
 
 	double getCPUUsage();
+	uint64_t getAudioMutedBlockNum();
+	uint64_t getAudioEventOverflowNum();
+	uint64_t getAudioStreamCacheHitNum();
+	uint64_t getAudioStreamCacheMissNum();
+	int64_t getAudioStreamCacheUsage();
 	bool getReturnToStartOnStop();
 	bool getAnonymousMode();
 	std::unique_ptr<juce::Component> createAudioDeviceSelector();
@@ -19,7 +25,15 @@ namespace quickAPI {
 	std::tuple<int64_t, double> getTimeInBeat();
 	double getTimeInSecond();
 	std::tuple<double, double> getLoopTimeSec();
-	const juce::Array<float> getAudioOutputLevel();
+	using LevelMeterPointer = std::shared_ptr<const LevelMeter>;
+	using Level = LevelMeter::Level;
+	using Loudness = LevelMeter::Loudness;
+	LevelMeterPointer getAudioOutputMeter();
+	using DSPLoad = DSPProfiler::Load;
+	const DSPLoad getAudioCallbackDSPLoad();
+	/** Path, Progress */
+	using SourceLoadProgress = std::tuple<juce::String, double>;
+	const juce::Array<SourceLoadProgress> getSourceLoadProgress();
 	bool isPlaying();
 	bool isRecording();
 	double getTotalLength();
@@ -87,6 +101,7 @@ namespace quickAPI {
 	const juce::String getInstrName(int index);
 	bool getInstrBypass(int index);
 	bool getInstrOffline(int index);
+	const DSPLoad getInstrDSPLoad(int index);
 	EditorPointer getInstrEditor(int index);
 	const juce::String getInstrName(PluginHolder pointer);
 	bool getInstrBypass(PluginHolder pointer);
@@ -103,6 +118,7 @@ namespace quickAPI {
 	PluginHolder getEffectPointer(int trackIndex, int index);
 	const juce::String getEffectName(int trackIndex, int index);
 	bool getEffectBypass(int trackIndex, int index);
+	const DSPLoad getEffectDSPLoad(int trackIndex, int index);
 	const juce::String getEffectName(PluginHolder pointer);
 	bool getEffectBypass(PluginHolder pointer);
 	EditorPointer getEffectEditor(PluginHolder pointer);
@@ -127,13 +143,17 @@ namespace quickAPI {
 	const juce::Array<AudioLink> getSeqTrackAudioOutputToMixer(int index);
 	bool getSeqTrackMute(int index);
 	bool getSeqTrackRecording(int index);
-	const juce::Array<float> getSeqTrackOutputLevel(int index);
+	LevelMeterPointer getSeqTrackOutputMeter(int index);
+	const DSPLoad getSeqTrackDSPLoad(int index);
 	const juce::String getSeqTrackType(int index);
 	bool isSeqTrackHasAudioData(int index);
 	bool isSeqTrackHasMIDIData(int index);
 	const juce::String getSeqTrackDataRefAudio(int index);
 	const juce::String getSeqTrackDataRefMIDI(int index);
 	const std::tuple<double, juce::AudioSampleBuffer> getSeqTrackAudioData(int index);
+	/** Whether complete, min, max and RMS of each point */
+	using AudioPeak = std::tuple<bool, juce::Array<juce::MemoryBlock>>;
+	const AudioPeak getSeqTrackAudioPeak(int index, double startSec, double endSec, int pointNum);
 	//const juce::MidiMessageSequence getSeqTrackMIDIData(int index);
 	int getSeqTrackMIDITrackNum(int index);
 	int getSeqTrackCurrentMIDITrack(int index);
@@ -163,7 +183,8 @@ namespace quickAPI {
 	float getMixerTrackFader(int index);
 	bool getMixerTrackMute(int index);
 	bool isMixerTrackPanValid(int index);
-	const juce::Array<float> getMixerTrackOutputLevel(int index);
+	LevelMeterPointer getMixerTrackOutputMeter(int index);
+	const DSPLoad getMixerTrackDSPLoad(int index);
 	const juce::String getMixerTrackType(int index);
 
 	int getLabelNum();
@@ -197,4 +218,7 @@ namespace quickAPI {
 	bool isAudioSourceValid(uint64_t ref);
 	bool isMIDISourceValid(uint64_t ref);
 	const NoteList getMIDISourceNotes(uint64_t ref, int track);
+	const NoteList getMIDISourceNotesInArea(uint64_t ref, int track,
+		double startSec, double endSec, uint8_t minPitch = 0, uint8_t maxPitch = 127);
+	const std::tuple<uint8_t, uint8_t> getMIDISourceNotePitchRange(uint64_t ref, int track);
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "../plugin/Plugin.h"
 #include "../misc/AudioLock.h"
 #include "../misc/VMath.h"
+#include "../misc/DSPProfiler.h"
+#include "../source/AudioStreamCache.h"
 
 namespace quickAPI {
 	void setPluginSearchPathListFilePath(const juce::String& path) {
@@ -18,6 +20,10 @@ namespace quickAPI {
 		AudioConfig::setDeadPluginListPath(path);
 	}
 
+	void setSourceCachePath(const juce::String& path) {
+		AudioConfig::setSourceCachePath(path);
+	}
+
 	void setPluginBlackListFilePath(const juce::String& path) {
 		AudioConfig::setPluginBlackListFilePath(path);
 	}
@@ -30,6 +36,42 @@ namespace quickAPI {
 		AudioConfig::setAnonymous(value);
 	}
 
+	void setAudioSourceStreaming(bool value) {
+		AudioConfig::setSourceStreaming(value);
+	}
+
+	void setAudioStreamCacheSize(int megabytes) {
+		if (megabytes <= 0) { return; }
+		AudioStreamCache::getInstance()->setMemoryBudget((int64_t)megabytes * 1024 * 1024);
+	}
+
+	void setAudioResampleQuality(int value) {
+		AudioConfig::setResampleQuality(value);
+	}
+
+	void setAudioSourceConvertMode(int value) {
+		AudioConfig::setSourceConvertMode(value);
+	}
+
+	void setRenderBlockSize(int value) {
+		AudioConfig::setRenderBlockSize(value);
+	}
+
+	void setRenderThreadNum(int value) {
+		AudioConfig::setRenderThreadNum(value);
+	}
+
+	void setAudioThreadNum(int value) {
+		AudioConfig::setAudioThreadNum(value);
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			graph->updateParallelEngine();
+		}
+	}
+
+	void setPluginLoadThreadNum(int value) {
+		AudioConfig::setPluginLoadThreadNum(value);
+	}
+
 	void setFormatBitsPerSample(const juce::String& extension, int value) {
 		AudioSaveConfig::getInstance()->setBitsPerSample(extension, value);
 	}
@@ -71,7 +113,7 @@ namespace quickAPI {
 		if (level >= (int)(vMath::InsType::MaxNum)) { level = (int)(vMath::InsType::MaxNum) - 1; }
 		if (level < 0) { level = 0; }
 
-		juce::ScopedWriteLock locker(audioLock::getAudioLock());
+		audioLock::ScopedAudioWriteLock locker(audioLock::getAudioLock());
 		vMath::setInsType((vMath::InsType)(level));
 	}
 
@@ -146,4 +188,10 @@ namespace quickAPI {
 			}
 		}
 	}
+
+	void resetDSPLoad() {
+		if (auto profiler = DSPProfiler::getInstanceWithoutCreate()) {
+			profiler->reset();
+		}
+	}
 }
\ No newline at end of file
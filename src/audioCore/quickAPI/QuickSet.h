@@ -9,9 +9,18 @@ namespace quickAPI {
 	void setPluginListTemporaryFilePath(const juce::String& path);
 	void setPluginBlackListFilePath(const juce::String& path);
 	void setDeadPluginListPath(const juce::String& path);
+	void setSourceCachePath(const juce::String& path);
 
 	void setReturnToStartOnStop(bool value);
 	void setAnonymousMode(bool value);
+	void setAudioSourceStreaming(bool value);
+	void setAudioStreamCacheSize(int megabytes);
+	void setAudioResampleQuality(int value);
+	void setAudioSourceConvertMode(int value);
+	void setRenderBlockSize(int value);
+	void setRenderThreadNum(int value);
+	void setAudioThreadNum(int value);
+	void setPluginLoadThreadNum(int value);
 
 	void setFormatBitsPerSample(const juce::String& extension, int value);
 	void setFormatMetaData(const juce::String& extension,
@@ -42,4 +51,6 @@ namespace quickAPI {
 
 	void sendDirectNoteOn(int trackIndex, int noteNum, uint8_t vel);
 	void sendDirectNoteOff(int trackIndex, int noteNum);
+
+	void resetDSPLoad();
 }
\ No newline at end of file
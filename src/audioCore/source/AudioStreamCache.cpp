@@ -0,0 +1,112 @@
+﻿#include "AudioStreamCache.h"
+#include "../Utils.h"
+
+/** Hold the shared state before the buffering reader, so it is released after the reader */
+struct StreamReaderStateHolder {
+	std::shared_ptr<void> holder;
+};
+
+class AudioStreamCache::StreamReader final : private StreamReaderStateHolder,
+	public juce::BufferingAudioReader {
+public:
+	StreamReader(std::unique_ptr<juce::AudioFormatReader> source,
+		const std::shared_ptr<SharedState>& state, int samplesToBuffer, int64_t bytes)
+		: StreamReaderStateHolder{ state },
+		juce::BufferingAudioReader(source.release(), state->thread, samplesToBuffer),
+		state(state.get()), bytes(bytes) {
+		/** Never Block The Audio Thread */
+		this->setReadTimeout(0);
+		this->state->memoryUsage += bytes;
+	};
+	~StreamReader() override {
+		this->state->memoryUsage -= this->bytes;
+	};
+
+	bool readSamples(int* const* destChannels, int numDestChannels,
+		int startOffsetInDestBuffer, juce::int64 startSampleInFile,
+		int numSamples) override {
+		bool hit = this->juce::BufferingAudioReader::readSamples(
+			destChannels, numDestChannels, startOffsetInDestBuffer,
+			startSampleInFile, numSamples);
+		(hit ? this->state->hitNum : this->state->missNum)++;
+		return hit;
+	};
+
+private:
+	SharedState* const state;
+	const int64_t bytes;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StreamReader)
+};
+
+AudioStreamCache::SharedState::SharedState() {
+	this->thread.startThread();
+}
+
+AudioStreamCache::SharedState::~SharedState() {
+	this->thread.stopThread(3000);
+}
+
+AudioStreamCache::AudioStreamCache()
+	: state(std::make_shared<SharedState>()) {}
+
+std::shared_ptr<juce::AudioFormatReader> AudioStreamCache::createReader(const juce::File& file) {
+	/** Create Audio Reader */
+	auto audioReader = utils::createAudioReader(file);
+	if (!audioReader) { return nullptr; }
+	if (audioReader->sampleRate <= 0 || audioReader->numChannels <= 0) { return nullptr; }
+
+	/** Window Size In Budget */
+	int64_t bytesPerSample = (int64_t)audioReader->numChannels * sizeof(float);
+	int64_t budgetLeft = this->memoryBudget - this->state->memoryUsage;
+	int64_t samplesToBuffer = std::min(
+		(int64_t)(AudioStreamCache::windowSeconds * audioReader->sampleRate),
+		budgetLeft / bytesPerSample);
+	samplesToBuffer = std::max(samplesToBuffer,
+		(int64_t)(AudioStreamCache::minWindowSeconds * audioReader->sampleRate));
+	samplesToBuffer = std::min(samplesToBuffer, (int64_t)audioReader->lengthInSamples);
+	samplesToBuffer = std::max(samplesToBuffer, (int64_t)1);
+
+	/** Create Streaming Reader */
+	return std::make_shared<StreamReader>(std::move(audioReader),
+		this->state, (int)samplesToBuffer, samplesToBuffer * bytesPerSample);
+}
+
+void AudioStreamCache::setMemoryBudget(int64_t bytes) {
+	this->memoryBudget = std::max(bytes, (int64_t)0);
+}
+
+int64_t AudioStreamCache::getMemoryBudget() const {
+	return this->memoryBudget;
+}
+
+int64_t AudioStreamCache::getMemoryUsage() const {
+	return this->state->memoryUsage;
+}
+
+uint64_t AudioStreamCache::getHitNum() const {
+	return this->state->hitNum;
+}
+
+uint64_t AudioStreamCache::getMissNum() const {
+	return this->state->missNum;
+}
+
+AudioStreamCache* AudioStreamCache::getInstance() {
+	return AudioStreamCache::instance
+		? AudioStreamCache::instance
+		: (AudioStreamCache::instance = new AudioStreamCache{});
+}
+
+AudioStreamCache* AudioStreamCache::getInstanceWithoutCreate() {
+	return AudioStreamCache::instance;
+}
+
+void AudioStreamCache::releaseInstance() {
+	if (AudioStreamCache::instance) {
+		delete AudioStreamCache::instance;
+		AudioStreamCache::instance = nullptr;
+	}
+}
+
+AudioStreamCache* AudioStreamCache::instance = nullptr;
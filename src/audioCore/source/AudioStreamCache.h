@@ -0,0 +1,52 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @brief	Creates disk-streaming readers for audio sources.
+ *			Each reader keeps a read-ahead window around its last read position,
+ *			filled by a shared background thread. Reading never blocks: samples which
+ *			are not cached yet are returned as silence and counted as a miss.
+ *			Window sizes shrink to fit the memory budget, down to a floor of one second.
+ */
+class AudioStreamCache final : private juce::DeletedAtShutdown {
+public:
+	AudioStreamCache();
+
+	std::shared_ptr<juce::AudioFormatReader> createReader(const juce::File& file);
+
+	void setMemoryBudget(int64_t bytes);
+	int64_t getMemoryBudget() const;
+	int64_t getMemoryUsage() const;
+
+	uint64_t getHitNum() const;
+	uint64_t getMissNum() const;
+
+private:
+	/** Shared with readers, so readers can outlive the cache */
+	struct SharedState final {
+		SharedState();
+		~SharedState();
+
+		juce::TimeSliceThread thread{ "Audio Stream Reader" };
+		std::atomic<int64_t> memoryUsage = 0;
+		std::atomic<uint64_t> hitNum = 0, missNum = 0;
+	};
+	class StreamReader;
+
+	std::shared_ptr<SharedState> state;
+	std::atomic<int64_t> memoryBudget = 512LL * 1024 * 1024;
+
+	static constexpr double windowSeconds = 10;
+	static constexpr double minWindowSeconds = 1;
+
+public:
+	static AudioStreamCache* getInstance();
+	static AudioStreamCache* getInstanceWithoutCreate();
+	static void releaseInstance();
+
+private:
+	static AudioStreamCache* instance;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioStreamCache)
+};
@@ -0,0 +1,297 @@
+﻿#include "SourceConvertCache.h"
+#include "SourceResampler.h"
+#include "AudioStreamCache.h"
+#include "SourceInternalPool.h"
+#include "../AudioConfig.h"
+#include "../Utils.h"
+
+SourceConvertCache::SourceConvertCache()
+	: Thread("Source Convert") {}
+
+SourceConvertCache::~SourceConvertCache() {
+	this->stopThread(30000);
+}
+
+void SourceConvertCache::addTask(const Task& task) {
+	if (!task.data || task.sampleRate <= 0) { return; }
+
+	juce::GenericScopedLock locker(this->lock);
+	this->list.push(task);
+	this->startThread();
+}
+
+uint64_t SourceConvertCache::getConvertedNum() const {
+	return this->convertedNum;
+}
+
+uint64_t SourceConvertCache::getCacheHitNum() const {
+	return this->cacheHitNum;
+}
+
+void SourceConvertCache::run() {
+	while (!this->threadShouldExit()) {
+		/** Get Next Task */
+		Task task;
+		{
+			juce::GenericScopedLock locker(this->lock);
+
+			/** Check Empty */
+			if (this->list.empty()) { break; }
+
+			/** Dequeue Task */
+			task = this->list.front();
+			this->list.pop();
+		}
+
+		/** Skip Source Which Is Only Kept By Pool And This Task */
+		Result result = nullptr;
+		if (task.data.use_count() > 2) {
+			result = this->convert(task);
+		}
+
+		/** Release Source */
+		auto name = task.data->getName();
+		task.data = nullptr;
+		SourceInternalPool::getInstance()->checkSourceReleased(name);
+
+		/** Callback */
+		if (!result || this->threadShouldExit()) { continue; }
+		juce::MessageManager::callAsync(
+			[callback = task.callback, version = task.version, result] {
+				if (callback) { callback(version, result); }
+			}
+		);
+	}
+}
+
+SourceConvertCache::Result SourceConvertCache::convert(const Task& task) {
+	/** Check Data */
+	auto& data = *(task.data);
+	if (!data.hasAudio() || data.getAudioSampleRate() <= 0) { return nullptr; }
+	if (data.getAudioSampleRate() == task.sampleRate) { return nullptr; }
+
+	/** Streamed Sources Are Only Converted To Sidecar Files To Keep Memory Usage Low */
+	auto mode = (CacheMode)AudioConfig::getSourceConvertMode();
+	if (mode == CacheMode::Disabled) { return nullptr; }
+	if (data.isAudioStreamed() && mode != CacheMode::Sidecar) { return nullptr; }
+
+	/** Content Key */
+	auto hash = SourceConvertCache::getContentHash(data);
+	if (hash.isEmpty()) { return nullptr; }
+	auto key = hash + "_" + juce::String{ (int)std::round(task.sampleRate) };
+
+	/** Shared With Other Sources */
+	if (auto result = this->findInMemory(key)) {
+		this->cacheHitNum++;
+		return result;
+	}
+
+	/** Convert */
+	auto result = (mode == CacheMode::Sidecar)
+		? this->convertToSidecar(data, task.sampleRate, key)
+		: this->convertToMemory(data, task.sampleRate, key);
+	if (!result) { return nullptr; }
+
+	/** Add To Memory Cache */
+	{
+		juce::GenericScopedLock locker(this->lock);
+		std::erase_if(this->memoryCache,
+			[](const auto& item) { return item.second.expired(); });
+		this->memoryCache[key] = result;
+	}
+
+	return result;
+}
+
+SourceConvertCache::Result SourceConvertCache::findInMemory(const juce::String& key) {
+	juce::GenericScopedLock locker(this->lock);
+
+	auto it = this->memoryCache.find(key);
+	if (it != this->memoryCache.end()) {
+		return it->second.lock();
+	}
+	return nullptr;
+}
+
+SourceConvertCache::Result SourceConvertCache::convertToMemory(
+	const SourceInternalContainer& data, double sampleRate, const juce::String& key) {
+	/** Prepare Converter */
+	double ratio = data.getAudioSampleRate() / sampleRate;
+	int channels = data.getAudioChannelNum();
+	int64_t length = (int64_t)std::ceil(data.getAudioLength() * sampleRate);
+	if (channels <= 0 || length <= 0 || length > INT_MAX) { return nullptr; }
+
+	auto kernel = SourceResampler::createKernel(ratio, SourceResampler::Quality::Offline);
+	SourceResampler resampler;
+	resampler.prepare(channels, SourceConvertCache::chunkSize);
+
+	/** Convert Each Chunk */
+	juce::AudioSampleBuffer buffer(channels, (int)length);
+	for (int64_t pos = 0; pos < length; pos += SourceConvertCache::chunkSize) {
+		if (this->threadShouldExit()) { return nullptr; }
+
+		int num = (int)std::min((int64_t)SourceConvertCache::chunkSize, length - pos);
+		resampler.read(data, *kernel, 0, buffer, (int)pos, pos, num);
+	}
+
+	/** Result */
+	auto result = std::make_shared<SourceInternalContainer>(
+		SourceInternalContainer::SourceType::Audio, key);
+	result->setAudio(sampleRate, buffer);
+	this->convertedNum++;
+	return result;
+}
+
+SourceConvertCache::Result SourceConvertCache::convertToSidecar(
+	const SourceInternalContainer& data, double sampleRate, const juce::String& key) {
+	/** Cache Dir */
+	auto dirPath = AudioConfig::getSourceCachePath();
+	if (dirPath.isEmpty()) { return nullptr; }
+	juce::File dir{ dirPath };
+	if (!dir.isDirectory() && !dir.createDirectory()) { return nullptr; }
+
+	/** Use Existing Sidecar */
+	juce::File file = dir.getChildFile(key + ".wav");
+	if (file.existsAsFile()) {
+		if (auto result = SourceConvertCache::loadSidecar(file, data.isAudioStreamed(), key)) {
+			this->cacheHitNum++;
+			return result;
+		}
+		file.deleteFile();
+	}
+
+	/** Read Streamed Source With Its Own Reader */
+	std::unique_ptr<SourceInternalContainer> streamCopy;
+	if (data.isAudioStreamed()) {
+		streamCopy = SourceConvertCache::openStreamCopy(data);
+		if (!streamCopy) { return nullptr; }
+	}
+	auto& source = streamCopy ? *streamCopy : data;
+
+	/** Prepare Converter */
+	double ratio = source.getAudioSampleRate() / sampleRate;
+	int channels = source.getAudioChannelNum();
+	int64_t length = (int64_t)std::ceil(source.getAudioLength() * sampleRate);
+	if (channels <= 0 || length <= 0) { return nullptr; }
+
+	auto kernel = SourceResampler::createKernel(ratio, SourceResampler::Quality::Offline);
+	SourceResampler resampler;
+	resampler.prepare(channels, SourceConvertCache::chunkSize);
+
+	/** Write To Temp File */
+	juce::File tempFile = dir.getChildFile(key + ".tmp.wav");
+	{
+		auto channelSet = juce::AudioChannelSet::canonicalChannelSet(channels);
+		if (channelSet.size() != channels) {
+			channelSet = juce::AudioChannelSet::discreteChannels(channels);
+		}
+		auto writer = utils::createAudioWriter(
+			tempFile, sampleRate, channelSet, {}, 32, 0);
+		if (!writer) { return nullptr; }
+
+		juce::AudioSampleBuffer buffer(channels, SourceConvertCache::chunkSize);
+		for (int64_t pos = 0; pos < length; pos += SourceConvertCache::chunkSize) {
+			if (this->threadShouldExit()) {
+				writer = nullptr;
+				tempFile.deleteFile();
+				return nullptr;
+			}
+
+			int num = (int)std::min((int64_t)SourceConvertCache::chunkSize, length - pos);
+			resampler.read(source, *kernel, 0, buffer, 0, pos, num);
+			writer->writeFromAudioSampleBuffer(buffer, 0, num);
+		}
+	}
+
+	/** Replace Sidecar Atomically */
+	if (!tempFile.moveFileTo(file)) {
+		tempFile.deleteFile();
+		return nullptr;
+	}
+	this->convertedNum++;
+
+	return SourceConvertCache::loadSidecar(file, data.isAudioStreamed(), key);
+}
+
+const juce::String SourceConvertCache::getContentHash(const SourceInternalContainer& data) {
+	/** Streamed Data Is Hashed By File */
+	if (data.isAudioStreamed()) {
+		juce::FileInputStream stream(data.getAudioStreamFile());
+		if (!stream.openedOk()) { return {}; }
+		return juce::MD5{ stream }.toHexString();
+	}
+
+	/** Memory Data Is Hashed By Copied Chunks, Recording Can Replace The Buffer Meanwhile */
+	int channels = data.getAudioChannelNum();
+	int64_t length = data.getAudioSampleNum();
+	if (channels <= 0 || length <= 0) { return {}; }
+
+	juce::MemoryOutputStream digests;
+	juce::AudioSampleBuffer buffer(channels, SourceConvertCache::chunkSize);
+	for (int64_t pos = 0; pos < length; pos += SourceConvertCache::chunkSize) {
+		int num = (int)std::min((int64_t)SourceConvertCache::chunkSize, length - pos);
+		data.readAudio(buffer, 0, pos, num);
+
+		for (int i = 0; i < channels; i++) {
+			juce::MD5 chunkHash(buffer.getReadPointer(i), (size_t)num * sizeof(float));
+			digests.write(chunkHash.getChecksumDataArray(), 16);
+		}
+	}
+	digests.writeDouble(data.getAudioSampleRate());
+
+	return juce::MD5{ digests.getMemoryBlock() }.toHexString();
+}
+
+std::unique_ptr<SourceInternalContainer> SourceConvertCache::openStreamCopy(
+	const SourceInternalContainer& data) {
+	auto reader = utils::createAudioReader(data.getAudioStreamFile());
+	if (!reader) { return nullptr; }
+
+	auto result = std::make_unique<SourceInternalContainer>(
+		SourceInternalContainer::SourceType::Audio, juce::String{});
+	result->setAudioStream(data.getAudioStreamFile(),
+		std::shared_ptr<juce::AudioFormatReader>(reader.release()));
+	return result;
+}
+
+SourceConvertCache::Result SourceConvertCache::loadSidecar(const juce::File& file,
+	bool streamed, const juce::String& key) {
+	auto result = std::make_shared<SourceInternalContainer>(
+		SourceInternalContainer::SourceType::Audio, key);
+
+	/** Keep Streamed Sources Streamed */
+	if (streamed) {
+		auto reader = AudioStreamCache::getInstance()->createReader(file);
+		if (!reader) { return nullptr; }
+		result->setAudioStream(file, reader);
+		return result;
+	}
+
+	/** Load Into Memory */
+	auto reader = utils::createAudioReader(file);
+	if (!reader || reader->lengthInSamples > INT_MAX) { return nullptr; }
+
+	juce::AudioSampleBuffer buffer(
+		(int)reader->numChannels, (int)reader->lengthInSamples);
+	reader->read(&buffer, 0, (int)reader->lengthInSamples, 0, true, true);
+	result->setAudio(reader->sampleRate, buffer);
+	return result;
+}
+
+SourceConvertCache* SourceConvertCache::getInstance() {
+	return SourceConvertCache::instance ? SourceConvertCache::instance
+		: (SourceConvertCache::instance = new SourceConvertCache{});
+}
+
+SourceConvertCache* SourceConvertCache::getInstanceWithoutCreate() {
+	return SourceConvertCache::instance;
+}
+
+void SourceConvertCache::releaseInstance() {
+	if (SourceConvertCache::instance) {
+		delete SourceConvertCache::instance;
+		SourceConvertCache::instance = nullptr;
+	}
+}
+
+SourceConvertCache* SourceConvertCache::instance = nullptr;
@@ -0,0 +1,70 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "SourceInternalContainer.h"
+
+/**
+ * @brief	Converts audio sources whose sample rate differs from the device sample rate
+ *			in the background, so playback can copy samples without realtime resampling.
+ *			Results are keyed by the content hash of the source and the target sample rate.
+ *			They are shared in memory while used and can be kept in sidecar files between sessions.
+ */
+class SourceConvertCache final : public juce::Thread,
+	private juce::DeletedAtShutdown {
+public:
+	SourceConvertCache();
+	~SourceConvertCache() override;
+
+	enum class CacheMode {
+		Disabled, Memory, Sidecar,
+		MaxNum
+	};
+
+	using Result = std::shared_ptr<const SourceInternalContainer>;
+	/** Version, Result */
+	using Callback = std::function<void(uint64_t, Result)>;
+	struct Task final {
+		std::shared_ptr<const SourceInternalContainer> data;
+		uint64_t version = 0;
+		double sampleRate = 0;
+		Callback callback;
+	};
+	void addTask(const Task& task);
+
+	uint64_t getConvertedNum() const;
+	uint64_t getCacheHitNum() const;
+
+protected:
+	void run() override;
+
+private:
+	juce::CriticalSection lock;
+	std::queue<Task> list;
+	std::map<juce::String, std::weak_ptr<const SourceInternalContainer>> memoryCache;
+
+	std::atomic<uint64_t> convertedNum = 0, cacheHitNum = 0;
+
+	Result convert(const Task& task);
+	Result findInMemory(const juce::String& key);
+	Result convertToMemory(const SourceInternalContainer& data,
+		double sampleRate, const juce::String& key);
+	Result convertToSidecar(const SourceInternalContainer& data,
+		double sampleRate, const juce::String& key);
+
+	static constexpr int chunkSize = 65536;
+
+	static const juce::String getContentHash(const SourceInternalContainer& data);
+	static std::unique_ptr<SourceInternalContainer> openStreamCopy(const SourceInternalContainer& data);
+	static Result loadSidecar(const juce::File& file,
+		bool streamed, const juce::String& key);
+
+public:
+	static SourceConvertCache* getInstance();
+	static SourceConvertCache* getInstanceWithoutCreate();
+	static void releaseInstance();
+
+private:
+	static SourceConvertCache* instance;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourceConvertCache)
+};
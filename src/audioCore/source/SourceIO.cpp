@@ -1,200 +1,345 @@
 ﻿#include "SourceIO.h"
 #include "SourceManager.h"
 #include "SourceInternalPool.h"
+#include "AudioStreamCache.h"
 #include "../misc/PlayPosition.h"
 #include "../misc/AudioLock.h"
+#include "../uiCallback/UICallback.h"
 #include "../Utils.h"
 #include "../AudioConfig.h"
 
 #define TIME_TRACK_NAME "##VS_TIME"
 
 SourceIO::SourceIO()
-	: Thread("Source IO"),
-	audioFormatsIn(SourceIO::trimFormat(utils::getAudioFormatsSupported(false))),
+	: audioFormatsIn(SourceIO::trimFormat(utils::getAudioFormatsSupported(false))),
 	midiFormatsIn(SourceIO::trimFormat(utils::getMidiFormatsSupported(false))),
 	audioFormatsOut(SourceIO::trimFormat(utils::getAudioFormatsSupported(true))),
-	midiFormatsOut(SourceIO::trimFormat(utils::getMidiFormatsSupported(true))) {}
+	midiFormatsOut(SourceIO::trimFormat(utils::getMidiFormatsSupported(true))) {
+	/** Decoding Is Mostly CPU Bound, Keep One Core For Audio And UI */
+	int threadNum = std::clamp(juce::SystemStats::getNumCpus() - 1, 1, 8);
+	for (int i = 0; i < threadNum; i++) {
+		this->workers.add(std::make_unique<Worker>(this, i));
+	}
+}
 
 SourceIO::~SourceIO() {
-	this->stopThread(30000);
+	for (auto i : this->workers) {
+		i->signalThreadShouldExit();
+	}
+	this->workers.clear();
 }
 
-void SourceIO::addTask(const Task& task) {
+void SourceIO::addTask(const Task& task, double distance) {
 	juce::GenericScopedLock locker(this->lock);
-	this->list.push({ task, PlayPosition::getInstance()->getTempoSequence() });
-	this->startThread();
+	this->list.insert({ { std::max(distance, 0.0), this->taskOrder++ },
+		{ task, PlayPosition::getInstance()->getTempoSequence() } });
+
+	/** Progress */
+	auto& [type, ref, path, getTempo, callback] = task;
+	if (type == TaskType::Read) {
+		this->progress[path] = 0;
+	}
+
+	/** Start Workers */
+	for (auto i : this->workers) {
+		i->startThread();
+	}
 }
 
-void SourceIO::run() {
-	while (!this->threadShouldExit()) {
-		/** Get Next Task */
-		TaskStruct task;
-		{
-			juce::GenericScopedLock locker(this->lock);
+bool SourceIO::isRunning() const {
+	juce::GenericScopedLock locker(this->lock);
+	if (!this->list.empty()) { return true; }
+	for (auto i : this->workers) {
+		if (i->isThreadRunning()) { return true; }
+	}
+	return false;
+}
+
+const juce::Array<SourceIO::Progress> SourceIO::getProgress() const {
+	juce::GenericScopedLock locker(this->lock);
+
+	juce::Array<Progress> result;
+	for (auto& [path, value] : this->progress) {
+		result.add({ path, value });
+	}
+	return result;
+}
+
+bool SourceIO::getNextTask(TaskStruct& task) {
+	juce::GenericScopedLock locker(this->lock);
+
+	/** Tasks Are Sorted By Distance To Playhead, Skip Files Used By Other Workers */
+	for (auto it = this->list.begin(); it != this->list.end(); it++) {
+		auto& path = std::get<2>(std::get<0>(it->second));
+		if (this->busyPaths.contains(path)) { continue; }
+
+		this->busyPaths.insert(path);
+		task = it->second;
+		this->list.erase(it);
+		return true;
+	}
+
+	/** The Worker Using The Same File Will Take The Rest */
+	return false;
+}
+
+void SourceIO::finishTask(const juce::String& path) {
+	juce::GenericScopedLock locker(this->lock);
+	this->busyPaths.erase(path);
+
+	/** Clear Progress When All Tasks Done */
+	if (this->list.empty() && this->busyPaths.empty()) {
+		this->progress.clear();
+	}
+}
 
-			/** Check Empty */
-			if (this->list.empty()) { break; }
+void SourceIO::setProgress(const juce::String& path, double progress) {
+	{
+		juce::GenericScopedLock locker(this->lock);
+		auto it = this->progress.find(path);
+		if (it == this->progress.end()) { return; }
+		it->second = progress;
+	}
 
-			/** Dequque Task */
-			task = this->list.front();
-			this->list.pop();
+	juce::MessageManager::callAsync(
+		[path, progress] {
+			UICallbackAPI<const juce::String&, double>::invoke(
+				UICallbackType::SourceLoadProgress, path, progress);
 		}
+	);
+}
 
-		/** Process Task */
-		{
-			/** Check Source Type */
-			auto& [taskData, tempo] = task;
-			auto& [type, ref, path, getTempo, callback] = taskData;
-			if (!ref) { continue; }
-
-			juce::File file = utils::getProjectDir().getChildFile(path);
-			juce::String extension = file.getFileExtension();
-			juce::String name = file.getFileName();
-			
-			auto& audioTypes = ((type == TaskType::Read) ? this->audioFormatsIn : this->audioFormatsOut);
-			auto& midiTypes = ((type == TaskType::Read) ? this->midiFormatsIn : this->midiFormatsOut);
-
-			if (audioTypes.contains(extension)) {
-				if (type == TaskType::Read) {
-					/** Check Source Exists */
-					if (!SourceInternalPool::getInstance()->find(name)) {
-						/** Load Audio Data */
-						auto [sampleRate, buffer, metaData, bitDepth] = SourceIO::loadAudio(file);
-						if (sampleRate <= 0) { continue; }
-
-						/** Set Data */
-						juce::MessageManager::callAsync(
-							[sampleRate, buffer, name, ref, metaData, bitDepth, extension, callback] {
-								SourceManager::getInstance()->setAudio(
-									ref, sampleRate, buffer, name);
-								SourceManager::getInstance()->setAudioFormat(
-									ref, { extension, metaData, bitDepth,
-									SourceIO::getBestQualityForFormat(extension) });
-								SourceManager::getInstance()->saved(
-									ref, SourceManager::SourceType::Audio);
-
-								if (callback) { callback(ref); }
-							}
-						);
-					}
-					else {
-						/** Set Reference */
-						juce::MessageManager::callAsync(
-							[ref, name, callback] {
-								SourceManager::getInstance()->setAudio(
-									ref, name);
-								if (callback) { callback(ref); }
-							}
-						);
-					}
-				}
-				else if (type == TaskType::Write) {
-					/** Get Data */
-					double sampleRate = 0;
-					juce::AudioSampleBuffer buffer;
-					{
-						juce::ScopedReadLock locker(audioLock::getSourceLock());
-						std::tie(sampleRate, buffer) = SourceManager::getInstance()->getAudio(ref);
-					}
-					if (sampleRate <= 0) { continue; }
+SourceIO::Worker::Worker(SourceIO* parent, int index)
+	: Thread("Source IO " + juce::String{ index }), parent(parent) {}
 
-					/** Audio Format */
-					auto [format, metaData, bitDepth, quality] = SourceManager::getInstance()->getAudioFormat(ref);
-					if (format != extension) {
-						metaData = SourceIO::getMetaDataForFormat(extension);
-						bitDepth = SourceIO::getBitDepthForFormat(extension);
-						quality = SourceIO::getQualityForFormat(extension);
+SourceIO::Worker::~Worker() {
+	this->stopThread(30000);
+}
 
-						juce::ScopedReadLock locker(audioLock::getSourceLock());
-						SourceManager::getInstance()->setAudioFormat(ref, { extension, metaData, bitDepth, quality });
-					}
+void SourceIO::Worker::run() {
+	while (!this->threadShouldExit()) {
+		/** Get Next Task */
+		TaskStruct task;
+		if (!this->parent->getNextTask(task)) { break; }
 
-					/** Save Audio Data */
-					if (SourceIO::saveAudio(file, sampleRate, buffer, metaData, bitDepth, quality)) {
-						juce::ScopedReadLock locker(audioLock::getSourceLock());
+		/** Process Task */
+		auto path = std::get<2>(std::get<0>(task));
+		this->parent->processTask(task, *this);
+		this->parent->setProgress(path, 1);
+		this->parent->finishTask(path);
+	}
+}
+
+void SourceIO::processTask(const TaskStruct& task, const Worker& worker) {
+	/** Check Source Type */
+	auto& [taskData, tempo] = task;
+	auto& [type, ref, path, getTempo, callback] = taskData;
+	if (!ref) { return; }
+
+	juce::File file = utils::getProjectDir().getChildFile(path);
+	juce::String extension = file.getFileExtension();
+	juce::String name = file.getFileName();
+	
+	auto& audioTypes = ((type == TaskType::Read) ? this->audioFormatsIn : this->audioFormatsOut);
+	auto& midiTypes = ((type == TaskType::Read) ? this->midiFormatsIn : this->midiFormatsOut);
+
+	if (audioTypes.contains(extension)) {
+		if (type == TaskType::Read) {
+			/** Check Source Exists */
+			if (!SourceInternalPool::getInstance()->find(name)
+				&& AudioConfig::getSourceStreaming()) {
+				/** Open Audio Stream */
+				auto reader = AudioStreamCache::getInstance()->createReader(file);
+				if (!reader) { return; }
+
+				/** Set Stream */
+				juce::MessageManager::callAsync(
+					[file, reader, name, ref, extension, callback] {
+						SourceManager::getInstance()->setAudioStream(
+							ref, file, reader, name, false);
+						SourceManager::getInstance()->setAudioFormat(
+							ref, { extension, reader->metadataValues, (int)reader->bitsPerSample,
+							SourceIO::getBestQualityForFormat(extension) });
 						SourceManager::getInstance()->saved(
 							ref, SourceManager::SourceType::Audio);
-					}
 
-					/** Callback */
+						if (callback) { callback(ref); }
+					}
+				);
+			}
+			else if (!SourceInternalPool::getInstance()->find(name)) {
+				/** Play From Stream While Decoding */
+				bool previewed = false;
+				if (auto reader = AudioStreamCache::getInstance()->createReader(file)) {
 					juce::MessageManager::callAsync(
-						[callback, ref] {
-							if (callback) { callback(ref); }
+						[file, reader, name, ref, extension] {
+							SourceManager::getInstance()->setAudioStream(
+								ref, file, reader, name, true);
+							SourceManager::getInstance()->setAudioFormat(
+								ref, { extension, reader->metadataValues, (int)reader->bitsPerSample,
+								SourceIO::getBestQualityForFormat(extension) });
+							SourceManager::getInstance()->saved(
+								ref, SourceManager::SourceType::Audio);
 						}
 					);
+					previewed = true;
 				}
-			}
-			else if (midiTypes.contains(extension)) {
-				if (type == TaskType::Read) {
-					/** Check Source Exists */
-					if (!SourceInternalPool::getInstance()->find(name)) {
-						/** Load MIDI Data */
-						auto [valid, data] = SourceIO::loadMIDI(file);
-						if (!valid) { continue; }
-
-						/** Split Data */
-						auto [tempo, buffer] = SourceIO::splitMIDI(data);
-
-						/** Set Tempo */
-						if (getTempo) {
-							juce::MessageManager::callAsync(
-								[tempo] {
-									PlayPosition::getInstance()->insertTempoSequence(tempo);
-								}
-							);
+
+				/** Load Audio Data */
+				auto [sampleRate, buffer, metaData, bitDepth] = SourceIO::loadAudio(file,
+					[this, &path, &worker](double progress) {
+						this->setProgress(path, progress);
+						return !worker.threadShouldExit();
+					});
+				if (sampleRate <= 0) { return; }
+
+				/** Set Data */
+				juce::MessageManager::callAsync(
+					[sampleRate, buffer, file, name, ref, metaData, bitDepth, extension, previewed, callback] {
+						/** Source Changed During Decoding */
+						if (previewed && SourceManager::getInstance()->getAudioStreamFile(ref) != file) {
+							if (callback) { callback(ref); }
+							return;
 						}
 
-						/** Set Data */
-						juce::MessageManager::callAsync(
-							[buffer, name, ref, callback] {
-								SourceManager::getInstance()->setMIDI(
-									ref, buffer, name);
-								SourceManager::getInstance()->saved(
-									ref, SourceManager::SourceType::MIDI);
-
-								if (callback) { callback(ref); }
-							}
-						);
+						SourceManager::getInstance()->setAudio(
+							ref, sampleRate, buffer, name);
+						SourceManager::getInstance()->setAudioFormat(
+							ref, { extension, metaData, bitDepth,
+							SourceIO::getBestQualityForFormat(extension) });
+						SourceManager::getInstance()->saved(
+							ref, SourceManager::SourceType::Audio);
+
+						if (callback) { callback(ref); }
 					}
-					else {
-						/** Set Reference */
-						juce::MessageManager::callAsync(
-							[ref, name, callback] {
-								SourceManager::getInstance()->setMIDI(
-									ref, name);
-								if (callback) { callback(ref); }
-							}
-						);
+				);
+			}
+			else {
+				/** Set Reference */
+				juce::MessageManager::callAsync(
+					[ref, name, callback] {
+						SourceManager::getInstance()->setAudio(
+							ref, name);
+						if (callback) { callback(ref); }
 					}
-				}
-				else if (type == TaskType::Write) {
-					/** Get Data */
-					juce::MidiFile buffer;
-					{
-						juce::ScopedReadLock locker(audioLock::getSourceLock());
-						buffer = SourceManager::getInstance()->makeMIDIFile(ref);
+				);
+			}
+		}
+		else if (type == TaskType::Write) {
+			/** Streamed Source Is Already In The File */
+			if (SourceManager::getInstance()->getAudioStreamFile(ref) == file) {
+				juce::MessageManager::callAsync(
+					[callback, ref] {
+						if (callback) { callback(ref); }
 					}
-					if (buffer.getNumTracks() <= 0) { continue; }
+				);
+				return;
+			}
+
+			/** Get Data */
+			double sampleRate = 0;
+			juce::AudioSampleBuffer buffer;
+			{
+				juce::ScopedReadLock locker(audioLock::getSourceLock());
+				std::tie(sampleRate, buffer) = SourceManager::getInstance()->getAudio(ref);
+			}
+			if (sampleRate <= 0) { return; }
 
-					/** Merge Data */
-					auto data = SourceIO::mergeMIDI(buffer, tempo);
+			/** Audio Format */
+			auto [format, metaData, bitDepth, quality] = SourceManager::getInstance()->getAudioFormat(ref);
+			if (format != extension) {
+				metaData = SourceIO::getMetaDataForFormat(extension);
+				bitDepth = SourceIO::getBitDepthForFormat(extension);
+				quality = SourceIO::getQualityForFormat(extension);
 
-					/** Save MIDI Data */
-					if (SourceIO::saveMIDI(file, data)) {
-						juce::ScopedReadLock locker(audioLock::getSourceLock());
-						SourceManager::getInstance()->saved(
-							ref, SourceManager::SourceType::MIDI);
-					}
+				juce::ScopedReadLock locker(audioLock::getSourceLock());
+				SourceManager::getInstance()->setAudioFormat(ref, { extension, metaData, bitDepth, quality });
+			}
 
-					/** Callback */
+			/** Save Audio Data */
+			if (SourceIO::saveAudio(file, sampleRate, buffer, metaData, bitDepth, quality)) {
+				juce::ScopedReadLock locker(audioLock::getSourceLock());
+				SourceManager::getInstance()->saved(
+					ref, SourceManager::SourceType::Audio);
+			}
+
+			/** Callback */
+			juce::MessageManager::callAsync(
+				[callback, ref] {
+					if (callback) { callback(ref); }
+				}
+			);
+		}
+	}
+	else if (midiTypes.contains(extension)) {
+		if (type == TaskType::Read) {
+			/** Check Source Exists */
+			if (!SourceInternalPool::getInstance()->find(name)) {
+				/** Load MIDI Data */
+				auto [valid, data] = SourceIO::loadMIDI(file);
+				if (!valid) { return; }
+
+				/** Split Data */
+				auto [tempo, buffer] = SourceIO::splitMIDI(data);
+
+				/** Set Tempo */
+				if (getTempo) {
 					juce::MessageManager::callAsync(
-						[callback, ref] {
-							if (callback) { callback(ref); }
+						[tempo] {
+							PlayPosition::getInstance()->insertTempoSequence(tempo);
 						}
 					);
 				}
+
+				/** Set Data */
+				juce::MessageManager::callAsync(
+					[buffer, name, ref, callback] {
+						SourceManager::getInstance()->setMIDI(
+							ref, buffer, name);
+						SourceManager::getInstance()->saved(
+							ref, SourceManager::SourceType::MIDI);
+
+						if (callback) { callback(ref); }
+					}
+				);
+			}
+			else {
+				/** Set Reference */
+				juce::MessageManager::callAsync(
+					[ref, name, callback] {
+						SourceManager::getInstance()->setMIDI(
+							ref, name);
+						if (callback) { callback(ref); }
+					}
+				);
 			}
 		}
+		else if (type == TaskType::Write) {
+			/** Get Data */
+			juce::MidiFile buffer;
+			{
+				juce::ScopedReadLock locker(audioLock::getSourceLock());
+				buffer = SourceManager::getInstance()->makeMIDIFile(ref);
+			}
+			if (buffer.getNumTracks() <= 0) { return; }
+
+			/** Merge Data */
+			auto data = SourceIO::mergeMIDI(buffer, tempo);
+
+			/** Save MIDI Data */
+			if (SourceIO::saveMIDI(file, data)) {
+				juce::ScopedReadLock locker(audioLock::getSourceLock());
+				SourceManager::getInstance()->saved(
+					ref, SourceManager::SourceType::MIDI);
+			}
+
+			/** Callback */
+			juce::MessageManager::callAsync(
+				[callback, ref] {
+					if (callback) { callback(ref); }
+				}
+			);
+		}
 	}
 }
 
@@ -222,15 +367,24 @@ int SourceIO::getBestQualityForFormat(const juce::String& format) {
 	return utils::getBestQualityOptionIndexForExtension(format);
 }
 
-const std::tuple<double, juce::AudioSampleBuffer, juce::StringPairArray, int> SourceIO::loadAudio(const juce::File& file) {
+const std::tuple<double, juce::AudioSampleBuffer, juce::StringPairArray, int> SourceIO::loadAudio(
+	const juce::File& file, const ProgressFunc& progress) {
 	/** Create Audio Reader */
 	auto audioReader = utils::createAudioReader(file);
 	if (!audioReader) { return { 0, juce::AudioSampleBuffer{}, juce::StringPairArray{}, 0 }; }
 
-	/** Read Data */
-	juce::AudioSampleBuffer buffer(
-		(int)audioReader->numChannels, (int)audioReader->lengthInSamples);
-	audioReader->read(&buffer, 0, audioReader->lengthInSamples, 0, true, true);
+	/** Read Data In Chunks To Report Progress */
+	int length = (int)audioReader->lengthInSamples;
+	juce::AudioSampleBuffer buffer((int)audioReader->numChannels, length);
+	constexpr int chunkSize = 1 << 20;
+	for (int start = 0; start < length; start += chunkSize) {
+		int size = std::min(chunkSize, length - start);
+		audioReader->read(&buffer, start, size, start, true, true);
+
+		if (progress && !progress((start + size) / (double)length)) {
+			return { 0, juce::AudioSampleBuffer{}, juce::StringPairArray{}, 0 };
+		}
+	}
 
 	return { audioReader->sampleRate, buffer, 
 		audioReader->metadataValues, audioReader->bitsPerSample };
@@ -2,8 +2,11 @@
 
 #include <JuceHeader.h>
 
-class SourceIO final : public juce::Thread,
-	private juce::DeletedAtShutdown {
+/**
+ * @brief	Reads and writes source files on a pool of worker threads.
+ *			Tasks with smaller distance to the playhead run first, and tasks of the same file never run at the same time.
+ */
+class SourceIO final : private juce::DeletedAtShutdown {
 public:
 	SourceIO();
 	~SourceIO();
@@ -14,18 +17,49 @@ public:
 	/** Type, SeqPtr, Path, GetTempo */
 	using SourceIOCallback = std::function<void(uint64_t)>;
 	using Task = std::tuple<TaskType, uint64_t, juce::String, bool, SourceIOCallback>;
-	void addTask(const Task& task);
+	/**
+	 * @param distance	Seconds between the playhead and the first use of the source.
+	 */
+	void addTask(const Task& task, double distance = 0);
 
-protected:
-	void run() override;
+	bool isRunning() const;
+
+	/** Path, Progress */
+	using Progress = std::tuple<juce::String, double>;
+	const juce::Array<Progress> getProgress() const;
 
 private:
 	const juce::StringArray audioFormatsIn, midiFormatsIn;
 	const juce::StringArray audioFormatsOut, midiFormatsOut;
 
-	juce::CriticalSection lock;
+	class Worker final : public juce::Thread {
+	public:
+		Worker() = delete;
+		Worker(SourceIO* parent, int index);
+		~Worker() override;
+
+	protected:
+		void run() override;
+
+	private:
+		SourceIO* const parent;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+	};
+	juce::OwnedArray<Worker> workers;
+
+	mutable juce::CriticalSection lock;
 	using TaskStruct = std::tuple<Task, juce::MidiMessageSequence>;
-	std::queue<TaskStruct> list;
+	/** Distance, Order */
+	std::map<std::tuple<double, uint64_t>, TaskStruct> list;
+	uint64_t taskOrder = 0;
+	std::set<juce::String> busyPaths;
+	std::map<juce::String, double> progress;
+
+	bool getNextTask(TaskStruct& task);
+	void finishTask(const juce::String& path);
+	void setProgress(const juce::String& path, double progress);
+	void processTask(const TaskStruct& task, const Worker& worker);
 
 	static const juce::StringArray trimFormat(const juce::StringArray& list);
 	static const juce::StringPairArray getMetaDataForFormat(const juce::String& format);
@@ -33,7 +67,9 @@ private:
 	static int getBitDepthForFormat(const juce::String& format);
 	static int getBestQualityForFormat(const juce::String& format);
 
-	static const std::tuple<double, juce::AudioSampleBuffer, juce::StringPairArray, int> loadAudio(const juce::File& file);
+	using ProgressFunc = std::function<bool(double)>;
+	static const std::tuple<double, juce::AudioSampleBuffer, juce::StringPairArray, int> loadAudio(
+		const juce::File& file, const ProgressFunc& progress);
 	static const std::tuple<bool, juce::MidiFile> loadMIDI(const juce::File& file);
 	static bool saveAudio(const juce::File& file,
 		double sampleRate, const juce::AudioSampleBuffer& buffer,
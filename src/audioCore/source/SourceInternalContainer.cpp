@@ -1,5 +1,7 @@
 ﻿#include "SourceInternalContainer.h"
 #include "../misc/VMath.h"
+#include "../misc/AudioLock.h"
+#include "../Utils.h"
 
 SourceInternalContainer::SourceInternalContainer(
 	const SourceType type, const juce::String& name)
@@ -10,11 +12,15 @@ SourceInternalContainer::SourceInternalContainer(
 	: type(other.type), name(SourceInternalContainer::getForkName(other.name)), forked(true) {
 	if (&other != this) {
 		if (other.midiData) {
-			this->midiData = std::make_unique<SourceMIDITemp>();
-			this->midiData->setData(other.midiData->makeMIDIFile());
+			this->midiData = std::make_unique<SourceMIDITemp>(*(other.midiData));
+		}
+		audioLock::ScopedReader reader;
+		if (auto otherData = other.audioData.load()) {
+			this->audioData = new juce::AudioSampleBuffer{ *otherData };
 		}
-		if (other.audioData) {
-			this->audioData = std::make_unique<juce::AudioSampleBuffer>(*(other.audioData));
+		else if (other.audioStreamReader) {
+			/** Forked Sources Are Edited In Memory */
+			this->audioData = new juce::AudioSampleBuffer{ other.readAudioStreamData() };
 		}
 
 		this->audioSampleRate = other.audioSampleRate;
@@ -27,6 +33,12 @@ SourceInternalContainer::SourceInternalContainer(
 	}
 }
 
+SourceInternalContainer::~SourceInternalContainer() {
+	delete this->audioData.exchange(nullptr);
+	delete this->grownAudioData.exchange(nullptr);
+	delete this->retiredAudioData.exchange(nullptr);
+}
+
 SourceInternalContainer::SourceType SourceInternalContainer::getType() const {
 	return this->type;
 }
@@ -57,13 +69,99 @@ double SourceInternalContainer::getMIDILength() const {
 }
 
 juce::AudioSampleBuffer* SourceInternalContainer::getAudioData() const {
-	return this->audioData.get();
+	return this->audioData.load();
 }
 
 double SourceInternalContainer::getAudioSampleRate() const {
 	return this->audioSampleRate;
 }
 
+bool SourceInternalContainer::hasAudio() const {
+	return this->audioData.load() || this->audioStreamReader;
+}
+
+double SourceInternalContainer::getAudioLength() const {
+	if (this->audioSampleRate <= 0) { return 0; }
+	return this->getAudioSampleNum() / this->audioSampleRate;
+}
+
+int64_t SourceInternalContainer::getAudioSampleNum() const {
+	audioLock::ScopedReader reader;
+	if (auto data = this->audioData.load()) {
+		return data->getNumSamples();
+	}
+	if (this->audioStreamReader) {
+		return this->audioStreamReader->lengthInSamples;
+	}
+	return 0;
+}
+
+int SourceInternalContainer::getAudioChannelNum() const {
+	audioLock::ScopedReader reader;
+	if (auto data = this->audioData.load()) {
+		return data->getNumChannels();
+	}
+	if (this->audioStreamReader) {
+		return (int)this->audioStreamReader->numChannels;
+	}
+	return 0;
+}
+
+bool SourceInternalContainer::isAudioStreamed() const {
+	return !this->audioData.load() && this->audioStreamReader;
+}
+
+juce::AudioFormatReader* SourceInternalContainer::getAudioStreamReader() const {
+	return this->audioStreamReader.get();
+}
+
+const juce::File SourceInternalContainer::getAudioStreamFile() const {
+	return this->isAudioStreamed() ? this->audioStreamFile : juce::File{};
+}
+
+const juce::AudioSampleBuffer SourceInternalContainer::readAudioStreamData() const {
+	/** Use Another Reader To Keep The Streaming Window */
+	auto audioReader = utils::createAudioReader(this->audioStreamFile);
+	if (!audioReader) { return {}; }
+
+	juce::AudioSampleBuffer buffer(
+		(int)audioReader->numChannels, (int)audioReader->lengthInSamples);
+	audioReader->read(&buffer, 0, audioReader->lengthInSamples, 0, true, true);
+	return buffer;
+}
+
+void SourceInternalContainer::readAudio(juce::AudioSampleBuffer& dst, int dstStart,
+	int64_t srcStart, int length) const {
+	this->readAudio(dst, dstStart, srcStart, length, this->audioStreamReader.get());
+}
+
+void SourceInternalContainer::readAudio(juce::AudioSampleBuffer& dst, int dstStart,
+	int64_t srcStart, int length, juce::AudioFormatReader* streamReader) const {
+	/** Clear Destination */
+	vMath::zeroAllAudioChannels(dst, dstStart, length);
+
+	/** Memory Data, Recording Frees Replaced Buffers After Readers Left */
+	audioLock::ScopedReader reader;
+	if (auto data = this->audioData.load()) {
+		int64_t validStart = std::max(srcStart, (int64_t)0);
+		int64_t validEnd = std::min(srcStart + length, (int64_t)data->getNumSamples());
+		if (validEnd <= validStart) { return; }
+
+		int channels = std::min(dst.getNumChannels(), data->getNumChannels());
+		for (int i = 0; i < channels; i++) {
+			vMath::copyAudioData(dst, *data,
+				dstStart + (int)(validStart - srcStart), (int)validStart,
+				i, i, (int)(validEnd - validStart));
+		}
+		return;
+	}
+
+	/** Streamed Data */
+	if (this->audioStreamReader && streamReader) {
+		streamReader->read(&dst, dstStart, length, srcStart, true, true);
+	}
+}
+
 void SourceInternalContainer::changed() {
 	this->savedFlag = false;
 }
@@ -107,10 +205,12 @@ void SourceInternalContainer::initMidiData() {
 void SourceInternalContainer::initAudioData(
 	int channelNum, double sampleRate, double length) {
 	if (this->type == SourceType::Audio) {
-		this->audioData = std::make_unique<juce::AudioSampleBuffer>(
+		auto data = std::make_unique<juce::AudioSampleBuffer>(
 			channelNum, (int)std::ceil(length * sampleRate));
-		vMath::zeroAllAudioData(*(this->audioData.get()));
+		vMath::zeroAllAudioData(*data);
+		this->replaceAudioData(std::move(data));
 		this->audioSampleRate = sampleRate;
+		this->audioStreamReader = nullptr;
 
 		this->initAudioFormat();
 
@@ -132,8 +232,21 @@ void SourceInternalContainer::setMIDI(const juce::MidiFile& data) {
 void SourceInternalContainer::setAudio(
 	double sampleRate, const juce::AudioSampleBuffer& data) {
 	if (this->type == SourceType::Audio) {
-		this->audioData = std::make_unique<juce::AudioSampleBuffer>(data);
+		this->replaceAudioData(std::make_unique<juce::AudioSampleBuffer>(data));
 		this->audioSampleRate = sampleRate;
+		this->audioStreamReader = nullptr;
+
+		this->changed();
+	}
+}
+
+void SourceInternalContainer::setAudioStream(const juce::File& file,
+	std::shared_ptr<juce::AudioFormatReader> reader) {
+	if (this->type == SourceType::Audio && reader) {
+		this->replaceAudioData(nullptr);
+		this->audioSampleRate = reader->sampleRate;
+		this->audioStreamFile = file;
+		this->audioStreamReader = reader;
 
 		this->changed();
 	}
@@ -152,6 +265,82 @@ const SourceInternalContainer::AudioFormat SourceInternalContainer::getAudioForm
 	return {};
 }
 
+juce::AudioSampleBuffer* SourceInternalContainer::getRecordBuffer(int64_t endSample) {
+	auto current = this->audioData.load();
+	if (!current) { return nullptr; }
+
+	/** Ask For Growing */
+	if (endSample > this->recordRequestEnd.load()) {
+		this->recordRequestEnd = endSample;
+	}
+
+	/** Take Grown Buffer */
+	if (auto grown = this->grownAudioData.exchange(nullptr)) {
+		/** Copy Samples Written While It Was Copied */
+		int64_t start = std::max(this->growDirtyStart.exchange(INT64_MAX), (int64_t)0);
+		int64_t end = std::min(this->growDirtyEnd.exchange(INT64_MIN), (int64_t)current->getNumSamples());
+		if (end > start) {
+			int channels = std::min(grown->getNumChannels(), current->getNumChannels());
+			for (int i = 0; i < channels; i++) {
+				vMath::copyAudioData(*grown, *current,
+					(int)start, (int)start, i, i, (int)(end - start));
+			}
+		}
+
+		/** Swap And Hand The Old Buffer Back */
+		this->audioData = grown;
+		this->retiredEpoch = audioLock::retire();
+		this->retiredAudioData = current;
+		current = grown;
+	}
+
+	return current;
+}
+
+void SourceInternalContainer::recordWritten(int64_t startSample, int64_t endSample) {
+	auto currentStart = this->growDirtyStart.load();
+	while (startSample < currentStart
+		&& !this->growDirtyStart.compare_exchange_weak(currentStart, startSample)) {}
+	auto currentEnd = this->growDirtyEnd.load();
+	while (endSample > currentEnd
+		&& !this->growDirtyEnd.compare_exchange_weak(currentEnd, endSample)) {}
+}
+
+void SourceInternalContainer::growForRecord() {
+	/** Free Buffer Replaced By The Writer */
+	if (this->retiredAudioData.load()) {
+		if (!audioLock::isReleasable(this->retiredEpoch.load())) { return; }
+		delete this->retiredAudioData.exchange(nullptr);
+	}
+
+	/** Writer Hasn't Taken The Last One */
+	if (this->grownAudioData.load()) { return; }
+
+	/** Check Space Left */
+	audioLock::ScopedReader reader;
+	auto current = this->audioData.load();
+	if (!current || this->audioSampleRate <= 0) { return; }
+	int64_t size = current->getNumSamples();
+	int64_t requestEnd = this->recordRequestEnd.load();
+	int64_t aheadSize = (int64_t)std::ceil(SourceInternalContainer::recordGrowAhead * this->audioSampleRate);
+	if (requestEnd + aheadSize <= size) { return; }
+
+	int64_t newSize = std::max(requestEnd + aheadSize, size)
+		+ (int64_t)std::ceil(SourceInternalContainer::recordGrowLength * this->audioSampleRate);
+	if (newSize > INT_MAX) { return; }
+
+	/** Copy, Samples Written Meanwhile Are Marked Dirty */
+	this->growDirtyStart = INT64_MAX;
+	this->growDirtyEnd = INT64_MIN;
+	auto grown = std::make_unique<juce::AudioSampleBuffer>(current->getNumChannels(), (int)newSize);
+	for (int i = 0; i < grown->getNumChannels(); i++) {
+		vMath::copyAudioData(*grown, *current, 0, 0, i, i, (int)size);
+	}
+	vMath::zeroAllAudioChannels(*grown, (int)size, (int)(newSize - size));
+
+	this->grownAudioData = grown.release();
+}
+
 bool SourceInternalContainer::isForked() const {
 	return this->forked;
 }
@@ -226,12 +415,27 @@ const SourceMIDITemp::Misc SourceInternalContainer::getMIDIMisc(int track, int i
 	return this->midiData->getMisc(track, index);
 }
 
-void SourceInternalContainer::findMIDIMessages(
+void SourceInternalContainer::findMIDINotes(int track, double startSec, double endSec,
+	uint8_t minPitch, uint8_t maxPitch, std::vector<int>& result) const {
+	if (!this->midiData) {
+		result.clear();
+		return;
+	}
+	this->midiData->findNotes(track, startSec, endSec, minPitch, maxPitch, result);
+}
+
+const std::tuple<uint8_t, uint8_t> SourceInternalContainer::getMIDINotePitchRange(int track) const {
+	if (!this->midiData) { return { 0, 0 }; }
+	return this->midiData->getNotePitchRange(track);
+}
+
+void SourceInternalContainer::readMIDIMessages(
 	int track, double startSec, double endSec,
-	juce::MidiMessageSequence& list, int& indexTemp) const {
+	double baseSec, double sampleRate,
+	juce::MidiBuffer& buffer, SourceMIDITemp::Cursor& cursor) const {
 	if (!this->midiData) { return; }
-	this->midiData->findMIDIMessages(
-		track, startSec, endSec, list, indexTemp);
+	this->midiData->readMIDIMessages(
+		track, startSec, endSec, baseSec, sampleRate, buffer, cursor);
 }
 
 void SourceInternalContainer::addMIDIMessages(
@@ -248,6 +452,20 @@ void SourceInternalContainer::clearUnmatchedMIDINotes(int track) {
 	this->midiData->clearUnmatchedMIDINotes(track);
 }
 
+void SourceInternalContainer::replaceAudioData(std::unique_ptr<juce::AudioSampleBuffer> data) {
+	std::unique_ptr<juce::AudioSampleBuffer> old(this->audioData.exchange(data.release()));
+	std::unique_ptr<juce::AudioSampleBuffer> retired(this->retiredAudioData.exchange(nullptr));
+	this->recordRequestEnd = 0;
+
+	/** Readers Of Other Threads May Still Use The Old Buffers */
+	if (old || retired) {
+		audioLock::waitForReaders();
+	}
+
+	/** Grown From The Old Data */
+	delete this->grownAudioData.exchange(nullptr);
+}
+
 void SourceInternalContainer::initAudioFormat() {
 	this->format.clear();
 	this->metaData.clear();
@@ -11,6 +11,7 @@ public:
 
 	SourceInternalContainer(const SourceType type, const juce::String& name);
 	SourceInternalContainer(const SourceInternalContainer& other);
+	~SourceInternalContainer();
 
 	SourceType getType() const;
 	const juce::String getName() const;
@@ -18,8 +19,36 @@ public:
 	const juce::MidiFile makeMIDIFile() const;
 	const juce::MidiMessageSequence makeMIDITrack(int index) const;
 	double getMIDILength() const;
+	/**
+	 * @brief	Memory data. Recording may replace it, so only use it inside audioLock::ScopedReader.
+	 */
 	juce::AudioSampleBuffer* getAudioData() const;
 	double getAudioSampleRate() const;
+	bool hasAudio() const;
+	double getAudioLength() const;
+	int64_t getAudioSampleNum() const;
+	int getAudioChannelNum() const;
+
+	/**
+	 * @brief	Audio data is read from disk through a streaming reader instead of memory.
+	 */
+	bool isAudioStreamed() const;
+	juce::AudioFormatReader* getAudioStreamReader() const;
+	const juce::File getAudioStreamFile() const;
+	/**
+	 * @brief	Read the whole streamed file. Never call this on the audio thread.
+	 */
+	const juce::AudioSampleBuffer readAudioStreamData() const;
+	/**
+	 * @brief	Read source samples from srcStart. Samples out of the data range are zero.
+	 */
+	void readAudio(juce::AudioSampleBuffer& dst, int dstStart,
+		int64_t srcStart, int length) const;
+	/**
+	 * @brief	Read streamed data with the given reader instead of the shared one.
+	 */
+	void readAudio(juce::AudioSampleBuffer& dst, int dstStart,
+		int64_t srcStart, int length, juce::AudioFormatReader* streamReader) const;
 
 	void changed();
 	void saved();
@@ -35,6 +64,24 @@ public:
 
 	void setMIDI(const juce::MidiFile& data);
 	void setAudio(double sampleRate, const juce::AudioSampleBuffer& data);
+	void setAudioStream(const juce::File& file,
+		std::shared_ptr<juce::AudioFormatReader> reader);
+
+	/**
+	 * @brief	Get the memory buffer to record to and ask for it to grow to endSample.
+	 *			It never allocates, buffers are grown in the background by growForRecord().
+	 *			Call this on one writing thread inside audioLock::ScopedReader.
+	 */
+	juce::AudioSampleBuffer* getRecordBuffer(int64_t endSample);
+	/**
+	 * @brief	Mark [startSample, endSample) as written to the record buffer.
+	 */
+	void recordWritten(int64_t startSample, int64_t endSample);
+	/**
+	 * @brief	Allocate a larger buffer when recording gets close to the end and free replaced ones.
+	 *			Never call this on the audio thread.
+	 */
+	void growForRecord();
 
 	/** Format, MetaData, BitDepth, Quality */
 	using AudioFormat = std::tuple<juce::String, juce::StringPairArray, int, int>;
@@ -61,10 +108,15 @@ public:
 	const SourceMIDITemp::Controller getMIDIController(int track, uint8_t number, int index) const;
 	const SourceMIDITemp::Misc getMIDIMisc(int track, int index) const;
 
+	void findMIDINotes(int track, double startSec, double endSec,
+		uint8_t minPitch, uint8_t maxPitch, std::vector<int>& result) const;
+	const std::tuple<uint8_t, uint8_t> getMIDINotePitchRange(int track) const;
+
 public:
-	void findMIDIMessages(
+	void readMIDIMessages(
 		int track, double startSec, double endSec,
-		juce::MidiMessageSequence& list, int& indexTemp) const;
+		double baseSec, double sampleRate,
+		juce::MidiBuffer& buffer, SourceMIDITemp::Cursor& cursor) const;
 	void addMIDIMessages(
 		int track, const juce::MidiMessageSequence& list,
 		SourceMIDITemp::NoteOnTemp& noteOnTemp, int& indexTemp,
@@ -78,16 +130,29 @@ private:
 	const bool forked = false;
 
 	std::unique_ptr<SourceMIDITemp> midiData = nullptr;
-	std::unique_ptr<juce::AudioSampleBuffer> audioData = nullptr;
+	std::atomic<juce::AudioSampleBuffer*> audioData = nullptr;
 	double audioSampleRate = 0;
+	juce::File audioStreamFile;
+	std::shared_ptr<juce::AudioFormatReader> audioStreamReader = nullptr;
 	std::atomic_bool savedFlag = true;
 
+	/** Grown buffer waiting for the writer, and the buffer it replaced waiting to be freed */
+	std::atomic<juce::AudioSampleBuffer*> grownAudioData = nullptr, retiredAudioData = nullptr;
+	std::atomic<uint64_t> retiredEpoch = 0;
+	std::atomic<int64_t> recordRequestEnd = 0;
+	/** Written while the grown buffer was copied, copied again by the writer */
+	std::atomic<int64_t> growDirtyStart = INT64_MAX, growDirtyEnd = INT64_MIN;
+
+	static constexpr double recordGrowAhead = 10;
+	static constexpr double recordGrowLength = 30;
+
 	juce::String format;
 	juce::StringPairArray metaData;
 	int bitsPerSample = 0;
 	int quality = 0;
 
 	void initAudioFormat();
+	void replaceAudioData(std::unique_ptr<juce::AudioSampleBuffer> data);
 
 	static const juce::String getForkName(const juce::String& name);
 
@@ -1,6 +1,7 @@
 ﻿#include "SourceItem.h"
 #include "SourceInternalPool.h"
 #include "../misc/VMath.h"
+#include "../misc/AudioLock.h"
 #include "../AudioConfig.h"
 #include "../Utils.h"
 
@@ -11,6 +12,11 @@ SourceItem::SourceItem(SourceType type)
 		this->recordMIDINoteOnTemp,
 		this->recordMIDIIndexTemp,
 		this->recordMIDILyricsTemp);
+
+	/** Init MIDI Record Queue */
+	if (type == SourceType::MIDI) {
+		this->recordMIDIEvents.resize(SourceItem::recordMIDIFifoSize);
+	}
 }
 
 SourceItem::~SourceItem() {
@@ -23,10 +29,6 @@ void SourceItem::initAudio(
 	/** Check Type */
 	if (this->type != SourceType::Audio) { return; }
 
-	/** Clear Audio Source */
-	this->resampleSource = nullptr;
-	this->memSource = nullptr;
-
 	/** Remove Old Source */
 	this->releaseContainer();
 
@@ -36,8 +38,10 @@ void SourceItem::initAudio(
 		this->container->initAudioData(channelNum, sampleRate, length);
 	}
 
-	/** Update Resample Source */
-	this->updateAudioResampler();
+	/** Update Audio Version */
+	this->updateAudioVersion();
+	this->resetPeakData();
+	this->updateResampleKernel();
 
 	/** Callback */
 	this->invokeCallback();
@@ -65,10 +69,6 @@ void SourceItem::setAudio(
 	/** Check Type */
 	if (this->type != SourceType::Audio) { return; }
 
-	/** Clear Audio Source */
-	this->resampleSource = nullptr;
-	this->memSource = nullptr;
-
 	/** Remove Old Source */
 	this->releaseContainer();
 
@@ -78,8 +78,34 @@ void SourceItem::setAudio(
 		this->container->setAudio(sampleRate, data);
 	}
 
-	/** Update Resample Source */
-	this->updateAudioResampler();
+	/** Update Audio Version */
+	this->updateAudioVersion();
+	this->resetPeakData();
+	this->updateResampleKernel();
+
+	/** Callback */
+	this->invokeCallback();
+}
+
+void SourceItem::setAudioStream(const juce::File& file,
+	std::shared_ptr<juce::AudioFormatReader> reader, const juce::String& name, bool preview) {
+	/** Check Type */
+	if (this->type != SourceType::Audio) { return; }
+
+	/** Remove Old Source */
+	this->releaseContainer();
+
+	/** Create Audio Source */
+	this->container = SourceInternalPool::getInstance()->add(name, this->type);
+	if (this->container) {
+		this->container->setAudioStream(file, reader);
+	}
+	this->audioPreview = preview;
+
+	/** Update Audio Version */
+	this->updateAudioVersion();
+	this->resetPeakData();
+	this->updateResampleKernel();
 
 	/** Callback */
 	this->invokeCallback();
@@ -107,18 +133,16 @@ void SourceItem::setAudio(const juce::String& name) {
 	/** Check Type */
 	if (this->type != SourceType::Audio) { return; }
 
-	/** Clear Audio Source */
-	this->resampleSource = nullptr;
-	this->memSource = nullptr;
-
 	/** Remove Old Source */
 	this->releaseContainer();
 
 	/** Get Audio Source */
 	this->container = SourceInternalPool::getInstance()->add(name, this->type);
 
-	/** Update Resample Source */
-	this->updateAudioResampler();
+	/** Update Audio Version */
+	this->updateAudioVersion();
+	this->resetPeakData();
+	this->updateResampleKernel();
 
 	/** Callback */
 	this->invokeCallback();
@@ -144,7 +168,13 @@ const std::tuple<double, juce::AudioSampleBuffer> SourceItem::getAudio() const {
 		return { 0, juce::AudioSampleBuffer{} };
 	}
 
+	/** Read Streamed Data */
+	if (this->container->isAudioStreamed()) {
+		return { this->container->getAudioSampleRate(), this->container->readAudioStreamData() };
+	}
+
 	/** Copy Data */
+	audioLock::ScopedReader reader;
 	return { this->container->getAudioSampleRate(), *(this->container->getAudioData()) };
 }
 
@@ -190,11 +220,8 @@ void SourceItem::prepareAudioPlay() {
 		return;
 	}
 
-	/** Update Resample Source */
-	if (this->resampleSource) {
-		this->resampleSource->setResamplingRatio(this->container->getAudioSampleRate() / this->playSampleRate);
-		this->resampleSource->prepareToPlay(this->blockSize, this->playSampleRate);
-	}
+	/** Rebuild Kernel If Quality Changed */
+	this->updateResampleKernel();
 }
 
 void SourceItem::prepareMIDIPlay() {
@@ -213,12 +240,17 @@ void SourceItem::prepareAudioRecord(int channelNum) {
 	}
 
 	/** Init Audio */
-	if (!this->container || !this->container->getAudioData()) {
+	if (!this->container || !this->container->hasAudio()) {
 		this->prepareAudioData(this->recordInitLength, channelNum);
 	}
 
 	/** Check For Fork */
 	this->forkIfNeed();
+
+	/** Recorded Samples Aren't In The Converted Copy */
+	if (this->convertedData) {
+		this->updateAudioVersion();
+	}
 }
 
 void SourceItem::prepareMIDIRecord() {
@@ -237,10 +269,14 @@ void SourceItem::prepareMIDIRecord() {
 }
 
 void SourceItem::setSampleRate(int blockSize, double sampleRate) {
+	bool sampleRateChanged = (sampleRate != this->playSampleRate);
 	this->playSampleRate = sampleRate;
 	this->blockSize = blockSize;
 
-	this->updateAudioResampler();
+	if (sampleRateChanged) {
+		this->updateAudioVersion();
+		this->updateResampleKernel();
+	}
 }
 
 SourceItem::SourceType SourceItem::getType() const {
@@ -257,7 +293,7 @@ bool SourceItem::midiValid() const {
 }
 
 bool SourceItem::audioValid() const {
-	return !(this->type != SourceType::Audio || !this->container || !this->container->getAudioData());
+	return !(this->type != SourceType::Audio || !this->container || !this->container->hasAudio());
 }
 
 int SourceItem::getMIDITrackNum() const {
@@ -275,7 +311,7 @@ double SourceItem::getMIDILength() const {
 double SourceItem::getAudioLength() const {
 	if (!this->audioValid()) { return 0; }
 
-	return this->container->getAudioData()->getNumSamples() / this->container->getAudioSampleRate();
+	return this->container->getAudioLength();
 }
 
 void SourceItem::setCallback(const ChangedCallback& callback) {
@@ -303,14 +339,15 @@ double SourceItem::getAudioSampleRate() const {
 	return this->container->getAudioSampleRate();
 }
 
-void SourceItem::forkIfNeed() {
-	if (this->container && this->container.use_count() > 2) {
-		/** Clear Audio Source */
-		if (this->type == SourceType::Audio) {
-			this->resampleSource = nullptr;
-			this->memSource = nullptr;
-		}
+const juce::File SourceItem::getAudioStreamFile() const {
+	if (this->type != SourceType::Audio || !this->container) { return {}; }
+	return this->container->getAudioStreamFile();
+}
 
+void SourceItem::forkIfNeed() {
+	/** Streamed Sources Are Always Forked Into Memory Before Editing */
+	if (this->container && (this->container.use_count() > 2
+		|| this->container->isAudioStreamed())) {
 		/** Clear Write Temp */
 		SourceMIDITemp::clearWriteTemps(
 			this->recordMIDINoteOnTemp,
@@ -320,11 +357,12 @@ void SourceItem::forkIfNeed() {
 		/** Fork Source */
 		auto name = this->container->getName();
 		this->container = SourceInternalPool::getInstance()->fork(name);
+		this->audioPreview = false;
 		SourceInternalPool::getInstance()->checkSourceReleased(name);
 
-		/** Update Resample Source */
+		/** Update Audio Version */
 		if (this->type == SourceType::Audio) {
-			this->updateAudioResampler();
+			this->updateAudioVersion();
 		}
 
 		/** Callback */
@@ -332,47 +370,59 @@ void SourceItem::forkIfNeed() {
 	}
 }
 
-void SourceItem::readAudioData(
+bool SourceItem::prepareRequestedRecord() {
+	/** Audio */
+	if (int channelNum = this->recordAudioRequest.exchange(0)) {
+		this->prepareAudioRecord(channelNum);
+		return true;
+	}
+
+	/** MIDI */
+	bool midiPrepared = false;
+	if (this->recordMIDIRequest.exchange(false)) {
+		this->prepareMIDIRecord();
+		midiPrepared = true;
+	}
+	this->addRecordedMIDI();
+
+	return midiPrepared;
+}
+
+void SourceItem::readAudioData(SourceResampler& resampler,
 	juce::AudioBuffer<float>& buffer, int bufferOffset,
 	int dataOffset, int length) const {
 	/** Check Source */
 	if (!this->audioValid()) { return; }
-	if (!this->resampleSource) { return; }
 	if (buffer.getNumSamples() <= 0 || length <= 0) { return; }
 
-	/** Get Data */
-	if (this->resampleSource && this->memSource) {
-		this->memSource->setNextReadPosition(
-			(int64_t)(dataOffset * this->resampleSource->getResamplingRatio()));
-		int startSample = bufferOffset;
-		this->resampleSource->getNextAudioBlock(juce::AudioSourceChannelInfo{
-			&buffer, startSample,
-				std::min(buffer.getNumSamples() - startSample, length) });
+	/** Copy Converted Data */
+	if (this->convertedData) {
+		resampler.readDirect(*(this->convertedData), buffer, bufferOffset, dataOffset, length);
+		return;
 	}
+
+	/** Kernel Is Built Off The Audio Thread */
+	auto kernel = this->resampleKernel.get();
+	if (!kernel) { return; }
+
+	/** Get Data */
+	resampler.read(*(this->container), *kernel, this->audioVersion,
+		buffer, bufferOffset, dataOffset, length);
 }
 
-void SourceItem::readMIDIData(
+void SourceItem::readMIDIData(SourceMIDITemp::Cursor& cursor,
 	juce::MidiBuffer& buffer, double baseTime,
 	double startTime, double endTime, int trackIndex) const {
 	/** Check Source */
 	if (!this->midiValid()) { return; }
 
 	/** Get MIDI Data */
-	juce::MidiMessageSequence temp;
-	this->container->findMIDIMessages(
-		trackIndex, startTime, endTime, temp,
-		this->playbackMIDIIndexTemp);
-
-	/** Copy Data */
-	for (auto i : temp) {
-		auto& message = i->message;
-		double time = message.getTimeStamp();
-		buffer.addEvent(message,
-			std::floor((time - baseTime) * this->playSampleRate));
-	}
+	this->container->readMIDIMessages(
+		trackIndex, startTime, endTime,
+		baseTime, this->playSampleRate, buffer, cursor);
 }
 
-void SourceItem::writeAudioData(
+bool SourceItem::writeAudioData(
 	juce::AudioBuffer<float>& buffer, int offset,
 	int trackChannelNum) {
 	/** Get Time */
@@ -385,56 +435,127 @@ void SourceItem::writeAudioData(
 		srcStartSample = 0;
 	}*/
 
+	/** Sources Are Created, Forked And Unconverted Off The Audio Thread */
+	if (!this->audioValid() || this->container->isAudioStreamed() || this->convertedData) {
+		this->recordAudioRequest = trackChannelNum;
+		return false;
+	}
+
 	/** Prepare Resampling */
-	this->prepareAudioRecord(trackChannelNum);
-	if (!this->audioValid()) { return; }
-	auto audioData = this->container->getAudioData();
 	double audioSampleRate = this->container->getAudioSampleRate();
-
 	double resampleRatio = this->playSampleRate / audioSampleRate;
-	int channelNum = std::min(buffer.getNumChannels(), audioData->getNumChannels());
 
-	/** Increase Source Length */
+	/** Buffer Is Grown In Background, Samples Beyond It Are Dropped */
+	audioLock::ScopedReader reader;
 	int endLength = offset + buffer.getNumSamples();
 	int trueEndLength = std::ceil(endLength / resampleRatio);
-	if (trueEndLength > audioData->getNumSamples()) {
-		audioData->setSize(audioData->getNumChannels(),
-			audioData->getNumSamples() + this->recordInitLength * audioSampleRate,
-			true, true, true);
-		this->updateAudioResampler();
+	auto audioData = this->container->getRecordBuffer(trueEndLength);
+	if (!audioData) {
+		this->recordAudioRequest = trackChannelNum;
+		return false;
+	}
+	int channelNum = std::min(buffer.getNumChannels(), audioData->getNumChannels());
+
+	/** Copy Data Directly When Sample Rates Match */
+	if (resampleRatio == 1) {
+		int bufferStartSample = std::max(0, -srcStartSample);
+		int dstStartSample = std::max(0, srcStartSample);
+		int length = std::min(srcLength - bufferStartSample,
+			audioData->getNumSamples() - dstStartSample);
+		for (int i = 0; i < channelNum && length > 0; i++) {
+			vMath::copyAudioData(*(audioData), buffer,
+				dstStartSample, bufferStartSample, i, i, length);
+		}
 	}
 
 	/** Copy Data Resampled */
-	utils::bufferOutputResampledFixed(*(audioData), buffer,
-		this->recordBuffer, this->recordBufferTemp,
-		resampleRatio, channelNum, audioSampleRate,
-		0, srcStartSample, srcLength);
+	else {
+		utils::bufferOutputResampledFixed(*(audioData), buffer,
+			this->recordBuffer, this->recordBufferTemp,
+			resampleRatio, channelNum, audioSampleRate,
+			0, srcStartSample, srcLength);
+	}
+
+	/** Mark Peaks Dirty */
+	int64_t dirtyStart = std::floor(srcStartSample / resampleRatio);
+	int64_t dirtyEnd = trueEndLength;
+	this->container->recordWritten(dirtyStart, dirtyEnd);
+	auto currentStart = this->peakDirtyStart.load();
+	while (dirtyStart < currentStart
+		&& !this->peakDirtyStart.compare_exchange_weak(currentStart, dirtyStart)) {}
+	auto currentEnd = this->peakDirtyEnd.load();
+	while (dirtyEnd > currentEnd
+		&& !this->peakDirtyEnd.compare_exchange_weak(currentEnd, dirtyEnd)) {}
 
 	/** Set Flag */
 	this->container->changed();
+	return true;
 }
 
-void SourceItem::writeMIDIData(
+bool SourceItem::writeMIDIData(
 	const juce::MidiBuffer& buffer, int offset, int trackIndex) {
-	/** Prepare Write */
-	this->prepareMIDIRecord();
-	if (!this->midiValid()) { return; }
+	/** Check Type */
+	if (this->type != SourceType::MIDI) { return true; }
 
-	/** Create Temp */
-	juce::MidiMessageSequence temp;
+	/** Queue Messages, The Source Is Only Changed Off The Audio Thread */
+	bool queued = false;
 	for (const auto& m : buffer) {
 		double timeStamp = (m.samplePosition + offset) / this->playSampleRate;
-		if (timeStamp >= 0) {
-			auto mes = m.getMessage();
-			mes.setTimeStamp(timeStamp);
-			temp.addEvent(mes);
-		}
+		if (timeStamp < 0) { continue; }
+		if (m.numBytes > (int)RecordMIDIEvent{}.data.size()) { continue; }
+
+		auto scope = this->recordMIDIFifo.write(1);
+		if (scope.blockSize1 <= 0) { break; }
+
+		auto& event = this->recordMIDIEvents[scope.startIndex1];
+		event.timeStamp = timeStamp;
+		event.trackIndex = trackIndex;
+		event.size = m.numBytes;
+		std::memcpy(event.data.data(), m.data, m.numBytes);
+		queued = true;
 	}
 
-	/** Write To Internal Data */
-	this->container->addMIDIMessages(trackIndex, temp,
-		this->recordMIDINoteOnTemp, this->recordMIDIIndexTemp,
-		this->recordMIDILyricsTemp);
+	/** Sources Are Created Off The Audio Thread */
+	if (!this->midiValid()) {
+		this->recordMIDIRequest = true;
+		return false;
+	}
+
+	return !queued;
+}
+
+void SourceItem::addRecordedMIDI() {
+	/** Keep Queued Until The Source Is Prepared */
+	if (!this->midiValid()) { return; }
+
+	int num = this->recordMIDIFifo.getNumReady();
+	if (num <= 0) { return; }
+
+	/** Write To Internal Data By Track */
+	juce::MidiMessageSequence temp;
+	int tempTrack = -1;
+	auto writeTemp = [this, &temp, &tempTrack] {
+		if (temp.getNumEvents() > 0) {
+			this->container->addMIDIMessages(tempTrack, temp,
+				this->recordMIDINoteOnTemp, this->recordMIDIIndexTemp,
+				this->recordMIDILyricsTemp);
+			temp.clear();
+		}
+	};
+
+	{
+		auto scope = this->recordMIDIFifo.read(num);
+		scope.forEach([this, &temp, &tempTrack, &writeTemp](int index) {
+			auto& event = this->recordMIDIEvents[index];
+			if (event.trackIndex != tempTrack) {
+				writeTemp();
+				tempTrack = event.trackIndex;
+			}
+			temp.addEvent(juce::MidiMessage{
+				event.data.data(), event.size, event.timeStamp });
+		});
+	}
+	writeTemp();
 
 	/** Set Flag */
 	this->container->changed();
@@ -505,26 +626,124 @@ const SourceMIDITemp::Misc SourceItem::getMIDIMisc(int track, int index) const {
 	return this->container->getMIDIMisc(track, index);
 }
 
-void SourceItem::updateAudioResampler() {
-	/** Check Audio Data */
+void SourceItem::findMIDINotes(int track, double startSec, double endSec,
+	uint8_t minPitch, uint8_t maxPitch, std::vector<int>& result) const {
+	if (!this->container) {
+		result.clear();
+		return;
+	}
+	this->container->findMIDINotes(track, startSec, endSec, minPitch, maxPitch, result);
+}
+
+const std::tuple<uint8_t, uint8_t> SourceItem::getMIDINotePitchRange(int track) const {
+	if (!this->container) { return { 0, 0 }; }
+	return this->container->getMIDINotePitchRange(track);
+}
+
+void SourceItem::requestConvert(const SourceConvertCache::Callback& callback) const {
+	/** Check Data */
 	if (!this->audioValid()) { return; }
+	if (this->audioPreview) { return; }
+	if (AudioConfig::getSourceConvertMode() == (int)SourceConvertCache::CacheMode::Disabled) { return; }
+	if (this->playSampleRate <= 0) { return; }
+	if (this->container->getAudioSampleRate() == this->playSampleRate) { return; }
 
-	/** Remove Resample Source */
-	this->resampleSource = nullptr;
+	/** Add Task */
+	SourceConvertCache::getInstance()->addTask(
+		{ this->container, this->audioVersion, this->playSampleRate, callback });
+}
 
-	/** Create Audio Source */
-	auto audioData = this->container->getAudioData();
-	this->memSource = std::make_unique<juce::MemoryAudioSource>(
-		*(audioData), false, false);
-	auto resSource = std::make_unique<juce::ResamplingAudioSource>(
-		this->memSource.get(), false, audioData->getNumChannels());
+void SourceItem::setConvertedData(uint64_t version, SourceConvertCache::Result data) {
+	/** Drop Outdated Result */
+	if (version != this->audioVersion) { return; }
+	if (!data || data->getAudioSampleRate() != this->playSampleRate) { return; }
 
-	/** Set Sample Rate */
-	resSource->setResamplingRatio(this->container->getAudioSampleRate() / this->playSampleRate);
-	resSource->prepareToPlay(this->blockSize, this->playSampleRate);
+	this->convertedData = data;
+}
 
-	/** Set Resample Source */
-	this->resampleSource = std::move(resSource);
+void SourceItem::requestPeak(const SourcePeakCache::Callback& callback) const {
+	/** Check Data */
+	if (!this->audioValid()) { return; }
+	if (this->audioPreview) { return; }
+	if (this->peakData) { return; }
+	if (this->peakRequestedVersion == this->peakVersion) { return; }
+
+	/** Add Task */
+	this->peakRequestedVersion = this->peakVersion;
+	SourcePeakCache::getInstance()->addTask(
+		{ this->container, this->peakVersion, callback });
+}
+
+void SourceItem::setPeakData(uint64_t version, SourcePeakCache::Result data) {
+	/** Drop Outdated Result */
+	if (version != this->peakVersion) { return; }
+	if (!this->audioValid()) { return; }
+	if (!data || data->getChannelNum() != this->container->getAudioChannelNum()) { return; }
+
+	this->peakData = data;
+}
+
+const SourceItem::PeakSource SourceItem::getPeakSource() const {
+	/** Check Data */
+	if (!this->audioValid()) { return {}; }
+	if (!this->peakData) { return { this->container }; }
+
+	/** Take Recorded Range */
+	return { this->container, this->peakData,
+		this->peakDirtyStart.exchange(INT64_MAX), this->peakDirtyEnd.exchange(INT64_MIN) };
+}
+
+const std::tuple<bool, SourcePeakPyramid::Result> SourceItem::getAudioPeak(
+	const PeakSource& source, double startSec, double endSec, int pointNum) {
+	/** Check Data */
+	if (!source.data) { return { true, {} }; }
+	if (!source.peak) { return { false, {} }; }
+
+	/** Summarize Recorded Range */
+	bool dirty = source.dirtyEnd > source.dirtyStart;
+	if (dirty) {
+		source.peak->update(*(source.data), source.dirtyStart, source.dirtyEnd);
+	}
+
+	/** Get Peaks */
+	return { !dirty, source.peak->getPeaks(*(source.data), startSec, endSec, pointNum) };
+}
+
+std::shared_ptr<SourceInternalContainer> SourceItem::getAudioContainer() const {
+	if (this->type != SourceType::Audio) { return nullptr; }
+	return this->container;
+}
+
+void SourceItem::updateAudioVersion() {
+	static std::atomic<uint64_t> versionCounter = 0;
+	this->audioVersion = ++versionCounter;
+	this->convertedData = nullptr;
+}
+
+void SourceItem::resetPeakData() {
+	this->peakData = nullptr;
+	this->peakVersion = this->audioVersion;
+	this->peakDirtyStart = INT64_MAX;
+	this->peakDirtyEnd = INT64_MIN;
+}
+
+void SourceItem::updateResampleKernel() {
+	/** Check Sample Rate */
+	double sourceSampleRate = this->container ? this->container->getAudioSampleRate() : 0;
+	if (sourceSampleRate <= 0 || this->playSampleRate <= 0) {
+		this->resampleKernel = nullptr;
+		return;
+	}
+
+	/** Rebuild Only When Ratio Or Quality Changed */
+	double ratio = sourceSampleRate / this->playSampleRate;
+	auto quality = (SourceResampler::Quality)AudioConfig::getResampleQuality();
+	if (this->resampleKernel
+		&& this->resampleKernel->ratio == ratio
+		&& this->resampleKernel->quality == quality) {
+		return;
+	}
+	this->resampleKernel = SourceResampler::createKernel(ratio, quality);
 }
 
 void SourceItem::prepareAudioData(double length, int channelNum) {
@@ -552,6 +771,7 @@ void SourceItem::releaseContainer() {
 
 		auto name = this->container->getName();
 		this->container = nullptr;
+		this->audioPreview = false;
 		SourceInternalPool::getInstance()->checkSourceReleased(name);
 	}
 }
@@ -2,6 +2,9 @@
 
 #include <JuceHeader.h>
 #include "SourceInternalContainer.h"
+#include "SourceResampler.h"
+#include "SourceConvertCache.h"
+#include "SourcePeakCache.h"
 
 class SourceItem final {
 public:
@@ -18,6 +21,8 @@ public:
 	void setAudio(double sampleRate, const juce::AudioSampleBuffer& data, const juce::String& name);
 	void setMIDI(const juce::MidiFile& data, const juce::String& name);
 	void setAudio(const juce::String& name);
+	void setAudioStream(const juce::File& file,
+		std::shared_ptr<juce::AudioFormatReader> reader, const juce::String& name, bool preview);
 	void setMIDI(const juce::String& name);
 	const std::tuple<double, juce::AudioSampleBuffer> getAudio() const;
 	const juce::MidiMessageSequence makeMIDITrack(int trackIndex) const;
@@ -50,17 +55,65 @@ public:
 	void setAudioFormat(const AudioFormat& format);
 	const AudioFormat getAudioFormat() const;
 	double getAudioSampleRate() const;
+	const juce::File getAudioStreamFile() const;
 
 	void forkIfNeed();
 
+	/**
+	 * @brief	Prepare the recording the audio thread couldn't write and add the MIDI it recorded.
+	 *			Never call this on the audio thread.
+	 * @return	Whether the source was prepared.
+	 */
+	bool prepareRequestedRecord();
+
+	/**
+	 * @brief	Convert the source to the play sample rate in background if the sample rates differ.
+	 */
+	void requestConvert(const SourceConvertCache::Callback& callback) const;
+	void setConvertedData(uint64_t version, SourceConvertCache::Result data);
+
+	/**
+	 * @brief	Build the waveform peak pyramid in background if it is missing.
+	 */
+	void requestPeak(const SourcePeakCache::Callback& callback) const;
+	void setPeakData(uint64_t version, SourcePeakCache::Result data);
+
+	/** Data and peaks to summarize without holding the source lock */
+	struct PeakSource final {
+		std::shared_ptr<const SourceInternalContainer> data;
+		SourcePeakCache::Result peak;
+		int64_t dirtyStart = INT64_MAX, dirtyEnd = INT64_MIN;
+	};
+	/**
+	 * @brief	Take the peaks and the range recorded since the last call.
+	 */
+	const PeakSource getPeakSource() const;
+	/**
+	 * @brief	Get peaks of the source in [startSec, endSec). Never call this on the audio thread.
+	 * @return	Whether the peaks are complete, and min, max and RMS of each point.
+	 */
+	static const std::tuple<bool, SourcePeakPyramid::Result> getAudioPeak(
+		const PeakSource& source, double startSec, double endSec, int pointNum);
+
+	std::shared_ptr<SourceInternalContainer> getAudioContainer() const;
+
 public:
-	void readAudioData(juce::AudioBuffer<float>& buffer, int bufferOffset,
+	void readAudioData(SourceResampler& resampler,
+		juce::AudioBuffer<float>& buffer, int bufferOffset,
 		int dataOffset, int length) const;
-	void readMIDIData(juce::MidiBuffer& buffer, double baseTime,
+	void readMIDIData(SourceMIDITemp::Cursor& cursor,
+		juce::MidiBuffer& buffer, double baseTime,
 		double startTime, double endTime, int trackIndex) const;
-	void writeAudioData(juce::AudioBuffer<float>& buffer,
+	/**
+	 * @return	False if the source isn't ready for recording, prepareRequestedRecord() is needed.
+	 */
+	bool writeAudioData(juce::AudioBuffer<float>& buffer,
 		int offset, int trackChannelNum);
-	void writeMIDIData(const juce::MidiBuffer& buffer,
+	/**
+	 * @brief	Only queues the messages, they are added to the source by prepareRequestedRecord().
+	 * @return	False if prepareRequestedRecord() is needed.
+	 */
+	bool writeMIDIData(const juce::MidiBuffer& buffer,
 		int offset, int trackIndex);
 
 public:
@@ -79,30 +132,62 @@ public:
 	const SourceMIDITemp::Controller getMIDIController(int track, uint8_t number, int index) const;
 	const SourceMIDITemp::Misc getMIDIMisc(int track, int index) const;
 
+	void findMIDINotes(int track, double startSec, double endSec,
+		uint8_t minPitch, uint8_t maxPitch, std::vector<int>& result) const;
+	const std::tuple<uint8_t, uint8_t> getMIDINotePitchRange(int track) const;
+
 private:
 	const SourceType type;
 	std::shared_ptr<SourceInternalContainer> container = nullptr;
 
-	std::unique_ptr<juce::MemoryAudioSource> memSource = nullptr;
-	std::unique_ptr<juce::ResamplingAudioSource> resampleSource = nullptr;
+	/** Changes whenever the audio data is replaced, playback voices reset on change */
+	uint64_t audioVersion = 0;
+	/** Streamed only until the decoded data arrives, never converted or summarized */
+	bool audioPreview = false;
+	/** Filter table for the source and play sample rates, rebuilt off the audio thread */
+	SourceResampler::KernelPtr resampleKernel = nullptr;
+	/** Converted copy at the play sample rate, played without resampling */
+	SourceConvertCache::Result convertedData = nullptr;
+
+	/** Waveform summary shared by all viewers, updated incrementally while recording */
+	SourcePeakCache::Result peakData = nullptr;
+	uint64_t peakVersion = 0;
+	mutable uint64_t peakRequestedVersion = 0;
+	mutable std::atomic<int64_t> peakDirtyStart = INT64_MAX, peakDirtyEnd = INT64_MIN;
 
 	const double recordInitLength = 30;
+	/** Track channel num of the audio recording to prepare, 0 if none */
+	std::atomic<int> recordAudioRequest = 0;
+	std::atomic_bool recordMIDIRequest = false;
 	juce::AudioSampleBuffer recordBuffer, recordBufferTemp;
 
 	double playSampleRate = 0;
 	int blockSize = 0;
 
-	mutable int playbackMIDIIndexTemp = -1;
 	int recordMIDIIndexTemp = -1;
 	SourceMIDITemp::NoteOnTemp recordMIDINoteOnTemp;
 	SourceMIDITemp::LyricsItem recordMIDILyricsTemp;
 
+	/** MIDI recorded by the audio thread, longer system exclusive messages are dropped */
+	struct RecordMIDIEvent final {
+		double timeStamp = 0;
+		int trackIndex = 0;
+		int size = 0;
+		std::array<uint8_t, 16> data{};
+	};
+	static constexpr int recordMIDIFifoSize = 1024;
+	juce::AbstractFifo recordMIDIFifo{ recordMIDIFifoSize };
+	std::vector<RecordMIDIEvent> recordMIDIEvents;
+
 	ChangedCallback callback;
 
-	void updateAudioResampler();
+	void updateAudioVersion();
+	void resetPeakData();
+	void updateResampleKernel();
 
 	void prepareAudioData(double length, int channelNum);
 	void prepareMIDIData();
+	void addRecordedMIDI();
 
 	void releaseContainer();
 };
@@ -0,0 +1,152 @@
+﻿#include "SourceMIDINoteIndex.h"
+
+void SourceMIDINoteIndex::clear() {
+	for (auto& tree : this->pitches) {
+		tree = PitchTree{};
+	}
+	this->positions.clear();
+}
+
+void SourceMIDINoteIndex::reserve(int num) {
+	this->positions.reserve(num);
+}
+
+void SourceMIDINoteIndex::add(uint8_t pitch, double startSec, double endSec) {
+	pitch = std::min(pitch, (uint8_t)127);
+	auto& tree = this->pitches[pitch];
+	int note = (int)this->positions.size();
+
+	/** Position In Start Order, Usually The End */
+	int pos = tree.size();
+	if (pos > 0 && tree.startTime.back() > startSec) {
+		pos = (int)(std::upper_bound(tree.startTime.begin(), tree.startTime.end(), startSec)
+			- tree.startTime.begin());
+	}
+
+	/** Insert */
+	tree.insert(pos, note, startSec, endSec);
+	this->positions.push_back({ pitch, pos });
+
+	/** Update Positions Of Moved Notes */
+	for (int i = pos + 1; i < tree.size(); i++) {
+		std::get<1>(this->positions[tree.notes[i]]) = i;
+	}
+}
+
+void SourceMIDINoteIndex::setEnd(int note, double endSec) {
+	if (note < 0 || note >= (int)this->positions.size()) { return; }
+
+	auto [pitch, pos] = this->positions[note];
+	this->pitches[pitch].setEnd(pos, endSec);
+}
+
+void SourceMIDINoteIndex::find(double startSec, double endSec,
+	uint8_t minPitch, uint8_t maxPitch, std::vector<int>& result) const {
+	result.clear();
+	if (endSec < startSec) { return; }
+
+	/** Each Pitch In Range */
+	maxPitch = std::min(maxPitch, (uint8_t)127);
+	for (int i = minPitch; i <= maxPitch; i++) {
+		this->pitches[i].find(startSec, endSec, result);
+	}
+
+	/** Note List Order */
+	std::sort(result.begin(), result.end());
+}
+
+const std::tuple<uint8_t, uint8_t> SourceMIDINoteIndex::getPitchRange() const {
+	int minPitch = 127, maxPitch = 0;
+	for (int i = 0; i < (int)this->pitches.size(); i++) {
+		if (this->pitches[i].size() > 0) {
+			minPitch = std::min(minPitch, i);
+			maxPitch = std::max(maxPitch, i);
+		}
+	}
+
+	if (maxPitch < minPitch) { return { 0, 0 }; }
+	return { (uint8_t)minPitch, (uint8_t)maxPitch };
+}
+
+int SourceMIDINoteIndex::PitchTree::size() const {
+	return (int)this->notes.size();
+}
+
+void SourceMIDINoteIndex::PitchTree::insert(
+	int pos, int note, double startSec, double endSec) {
+	bool append = (pos == this->size());
+	this->notes.insert(this->notes.begin() + pos, note);
+	this->startTime.insert(this->startTime.begin() + pos, startSec);
+	this->endTime.insert(this->endTime.begin() + pos, endSec);
+
+	/** Grow Or Rebuild When Leaves Moved */
+	if (this->size() > this->capacity) {
+		this->rebuild(std::max(this->capacity * 2, 16));
+		return;
+	}
+	if (!append) {
+		this->rebuild(this->capacity);
+		return;
+	}
+
+	/** Append Only Updates One Path */
+	this->updatePath(pos);
+}
+
+void SourceMIDINoteIndex::PitchTree::setEnd(int pos, double endSec) {
+	if (pos < 0 || pos >= this->size()) { return; }
+
+	this->endTime[pos] = endSec;
+	this->updatePath(pos);
+}
+
+void SourceMIDINoteIndex::PitchTree::find(
+	double startSec, double endSec, std::vector<int>& result) const {
+	/** Notes Starting Before Area End */
+	int limit = (int)(std::upper_bound(this->startTime.begin(), this->startTime.end(), endSec)
+		- this->startTime.begin());
+	if (limit <= 0) { return; }
+
+	/** Notes Ending After Area Start */
+	this->findInternal(1, 0, this->capacity, limit, startSec, result);
+}
+
+void SourceMIDINoteIndex::PitchTree::rebuild(int capacity) {
+	this->capacity = capacity;
+	this->maxEnd.assign((size_t)capacity * 2, std::numeric_limits<double>::lowest());
+
+	/** Leaves */
+	for (int i = 0; i < this->size(); i++) {
+		this->maxEnd[capacity + i] = this->endTime[i];
+	}
+
+	/** Nodes */
+	for (int i = capacity - 1; i > 0; i--) {
+		this->maxEnd[i] = std::max(this->maxEnd[i * 2], this->maxEnd[i * 2 + 1]);
+	}
+}
+
+void SourceMIDINoteIndex::PitchTree::updatePath(int pos) {
+	int node = this->capacity + pos;
+	this->maxEnd[node] = this->endTime[pos];
+	for (node /= 2; node > 0; node /= 2) {
+		this->maxEnd[node] = std::max(this->maxEnd[node * 2], this->maxEnd[node * 2 + 1]);
+	}
+}
+
+void SourceMIDINoteIndex::PitchTree::findInternal(int node, int nodeStart, int nodeEnd, int limit,
+	double startSec, std::vector<int>& result) const {
+	/** Skip Nodes Starting After Area Or Ending Before Area */
+	if (nodeStart >= limit || this->maxEnd[node] < startSec) { return; }
+
+	/** Leaf */
+	if (node >= this->capacity) {
+		result.push_back(this->notes[nodeStart]);
+		return;
+	}
+
+	/** Children */
+	int nodeMid = nodeStart + (nodeEnd - nodeStart) / 2;
+	this->findInternal(node * 2, nodeStart, nodeMid, limit, startSec, result);
+	this->findInternal(node * 2 + 1, nodeMid, nodeEnd, limit, startSec, result);
+}
@@ -0,0 +1,63 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @brief	Time and pitch index of the notes of one MIDI track.
+ *			Each pitch keeps its notes in start order with a max tree of note ends over them,
+ *			so the notes overlapping an area are found in O(log n + k) without scanning the track.
+ */
+class SourceMIDINoteIndex final {
+public:
+	SourceMIDINoteIndex() = default;
+	SourceMIDINoteIndex(const SourceMIDINoteIndex& other) = default;
+
+	void clear();
+	void reserve(int num);
+
+	/**
+	 * @brief	Add the note with the next note list index. Appending in time order only updates one tree path.
+	 */
+	void add(uint8_t pitch, double startSec, double endSec);
+	/**
+	 * @brief	Change the end of an added note, e.g. when its note off arrives while recording.
+	 */
+	void setEnd(int note, double endSec);
+
+	/**
+	 * @brief	Note list indices of notes overlapping [startSec, endSec] with pitch in [minPitch, maxPitch], in index order.
+	 */
+	void find(double startSec, double endSec,
+		uint8_t minPitch, uint8_t maxPitch, std::vector<int>& result) const;
+	/**
+	 * @return	The lowest and highest pitch used. Both are 0 when there is no note.
+	 */
+	const std::tuple<uint8_t, uint8_t> getPitchRange() const;
+
+private:
+	struct PitchTree final {
+		/** Note list indices in start order */
+		std::vector<int> notes;
+		std::vector<double> startTime, endTime;
+		/** Max end of each node, leaf i at capacity + i */
+		std::vector<double> maxEnd;
+		int capacity = 0;
+
+		int size() const;
+		void insert(int pos, int note, double startSec, double endSec);
+		void setEnd(int pos, double endSec);
+		void find(double startSec, double endSec, std::vector<int>& result) const;
+
+	private:
+		void rebuild(int capacity);
+		void updatePath(int pos);
+		void findInternal(int node, int nodeStart, int nodeEnd, int limit,
+			double startSec, std::vector<int>& result) const;
+	};
+	std::array<PitchTree, 128> pitches;
+
+	/** Pitch, position in pitch tree of each note list index */
+	std::vector<std::tuple<uint8_t, int>> positions;
+
+	JUCE_LEAK_DETECTOR(SourceMIDINoteIndex)
+};
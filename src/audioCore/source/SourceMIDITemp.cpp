@@ -9,14 +9,8 @@ void SourceMIDITemp::setData(const juce::MidiFile& data) {
 	this->timeFormat = data.getTimeFormat();
 	
 	/** Clear Lists */
-	this->eventList.clear();
-
-	this->noteList.clear();
-	this->pitchWheelList.clear();
-	this->afterTouchList.clear();
-	this->channelPressureList.clear();
-	this->controllerList.clear();
-	this->miscList.clear();
+	this->tracks.clear();
+	this->tracks.reserve(data.getNumTracks());
 
 	/** For Each Track */
 	for (int i = 0; i < data.getNumTracks(); i++) {
@@ -28,41 +22,26 @@ void SourceMIDITemp::addTrack(const juce::MidiMessageSequence& track) {
 	/** Track Event Temp */
 	LyricsItem lastLyrics = MIDI_LYRICS_TEMP_INIT;
 	NoteOnTemp noteOnObjectTemp;
-
-	juce::OwnedArray<MIDIStruct> events;
-
-	juce::Array<int> noteTrack;
-	juce::Array<int> pitchWheel, channelPressure;
-	juce::Array<int> afterTouch;
-	std::unordered_map<uint8_t, juce::Array<int>> controllers;
-	juce::Array<int> miscs;
-
 	int indexTemp = 0;
 
 	/** Add Events */
-	this->addMIDIMessages(
-		events, noteTrack, pitchWheel, channelPressure, afterTouch, controllers, miscs,
-		track, noteOnObjectTemp, indexTemp, lastLyrics);
+	EventTrack events;
+	events.reserve(track.getNumEvents());
+	SourceMIDITemp::addMIDIMessages(
+		events, track, noteOnObjectTemp, indexTemp, lastLyrics);
 
 	/** Add Track to List */
-	this->eventList.add(std::move(events));
-
-	this->noteList.add(noteTrack);
-	this->pitchWheelList.add(pitchWheel);
-	this->afterTouchList.add(afterTouch);
-	this->channelPressureList.add(channelPressure);
-	this->controllerList.add(controllers);
-	this->miscList.add(miscs);
+	this->tracks.push_back(std::move(events));
 
 	/** Remove Unmatched Notes */
-	this->clearUnmatchedMIDINotes(this->eventList.size() - 1);
+	this->clearUnmatchedMIDINotes((int)this->tracks.size() - 1);
 }
 
 const juce::MidiFile SourceMIDITemp::makeMIDIFile() const {
 	juce::MidiFile file;
 	utils::setMIDITimeFormat(file, this->timeFormat);
 	
-	for (int i = 0; i < this->eventList.size(); i++) {
+	for (int i = 0; i < (int)this->tracks.size(); i++) {
 		auto track = this->makeMIDITrack(i);
 		file.addTrack(track);
 	}
@@ -72,7 +51,7 @@ const juce::MidiFile SourceMIDITemp::makeMIDIFile() const {
 
 const juce::MidiMessageSequence SourceMIDITemp::makeMIDITrack(int index) const {
 	/** Check Index */
-	if (index < 0 || index >= this->eventList.size()) { return juce::MidiMessageSequence{}; }
+	if (index < 0 || index >= (int)this->tracks.size()) { return juce::MidiMessageSequence{}; }
 
 	/** Temp */
 	juce::MidiMessageSequence track;
@@ -88,15 +67,15 @@ const juce::MidiMessageSequence SourceMIDITemp::makeMIDITrack(int index) const {
 }
 
 int SourceMIDITemp::getTrackNum() const {
-	return this->eventList.size();
+	return (int)this->tracks.size();
 }
 
 double SourceMIDITemp::getLength() const {
 	double result = 0;
 
-	for (auto& track : this->eventList) {
-		if (auto ptr = track.getLast()) {
-			result = std::max(result, ptr->timeSec);
+	for (auto& track : this->tracks) {
+		if (!track.time.empty()) {
+			result = std::max(result, track.time.back());
 		}
 	}
 
@@ -104,209 +83,174 @@ double SourceMIDITemp::getLength() const {
 }
 
 int SourceMIDITemp::getNoteNum(int track) const {
-	if (track < 0 || track >= this->noteList.size()) {
-		return 0;
+	if (auto ptr = this->getTrack(track)) {
+		return (int)ptr->noteList.size();
 	}
-	return this->noteList.getReference(track).size();
+	return 0;
 }
 
 int SourceMIDITemp::getPitchWheelNum(int track) const {
-	if (track < 0 || track >= this->pitchWheelList.size()) {
-		return 0;
+	if (auto ptr = this->getTrack(track)) {
+		return (int)ptr->pitchWheelList.size();
 	}
-	return this->pitchWheelList.getReference(track).size();
+	return 0;
 }
 
 int SourceMIDITemp::getAfterTouchNum(int track) const {
-	if (track < 0 || track >= this->afterTouchList.size()) {
-		return 0;
+	if (auto ptr = this->getTrack(track)) {
+		return (int)ptr->afterTouchList.size();
 	}
-	return this->afterTouchList.getReference(track).size();
+	return 0;
 }
 
 int SourceMIDITemp::getChannelPressureNum(int track) const {
-	if (track < 0 || track >= this->channelPressureList.size()) {
-		return 0;
+	if (auto ptr = this->getTrack(track)) {
+		return (int)ptr->channelPressureList.size();
 	}
-	return this->channelPressureList.getReference(track).size();
+	return 0;
 }
 
 const std::set<uint8_t> SourceMIDITemp::getControllerNumbers(int track) const {
-	if (track < 0 || track >= this->controllerList.size()) {
-		return {};
-	}
-
 	std::set<uint8_t> result;
-	auto& map = this->controllerList.getReference(track);
-	for (auto& i : map) {
-		result.insert(i.first);
+	if (auto ptr = this->getTrack(track)) {
+		for (auto& i : ptr->controllerList) {
+			result.insert(i.first);
+		}
 	}
-
 	return result;
 }
 
 int SourceMIDITemp::getControllerNum(int track, uint8_t number) const {
-	if (track < 0 || track >= this->controllerList.size()) {
-		return 0;
-	}
-
-	auto& map = this->controllerList.getReference(track);
-	auto it = map.find(number);
-	if (it == map.end()) {
-		return 0;
+	if (auto ptr = this->getTrack(track)) {
+		auto it = ptr->controllerList.find(number);
+		if (it != ptr->controllerList.end()) {
+			return (int)it->second.size();
+		}
 	}
-
-	return it->second.size();
+	return 0;
 }
 
 int SourceMIDITemp::getMiscNum(int track) const {
-	if (track < 0 || track >= this->miscList.size()) {
-		return 0;
+	if (auto ptr = this->getTrack(track)) {
+		return (int)ptr->miscList.size();
 	}
-	return this->miscList.getReference(track).size();
+	return 0;
 }
 
 const SourceMIDITemp::Note SourceMIDITemp::getNote(int track, int index) const {
-	if (track < 0 || track >= this->noteList.size()) {
-		return {};
-	}
-	if (track < 0 || track >= this->eventList.size()) {
+	auto ptr = this->getTrack(track);
+	if (!ptr || index < 0 || index >= (int)ptr->noteList.size()) {
 		return {};
 	}
 
-	auto& trackRef = this->noteList.getReference(track);
-	if (track < 0 || track >= trackRef.size()) {
-		return {};
-	}
+	int eventIndex = ptr->noteList[index];
+	Note result;
+	SourceMIDITemp::fillStruct(result, *ptr, eventIndex, index);
+	result.pitch = ptr->data1[eventIndex];
+	result.vel = (uint8_t)ptr->data2[eventIndex];
 
-	int structIndex = trackRef[index];
-	auto& eventTrackRef = this->eventList.getReference(track);
-	if (structIndex < 0 || structIndex >= eventTrackRef.size()) {
-		return {};
+	int offIndex = ptr->pair[eventIndex];
+	result.endSec = (offIndex >= 0) ? ptr->time[offIndex] : result.timeSec;
+	result.eventOffIndex = offIndex;
+
+	int lyricsIndex = ptr->extra[eventIndex];
+	if (lyricsIndex >= 0) {
+		result.lyrics = ptr->lyrics[lyricsIndex];
 	}
 
-	return *(dynamic_cast<SourceMIDITemp::Note*>(
-		eventTrackRef.getUnchecked(structIndex)));
+	return result;
 }
 
-const SourceMIDITemp::IntParam SourceMIDITemp::getPitchWheel(int track, int index) const {
-	if (track < 0 || track >= this->pitchWheelList.size()) {
-		return {};
-	}
-	if (track < 0 || track >= this->eventList.size()) {
-		return {};
+void SourceMIDITemp::findNotes(int track, double startSec, double endSec,
+	uint8_t minPitch, uint8_t maxPitch, std::vector<int>& result) const {
+	auto ptr = this->getTrack(track);
+	if (!ptr) {
+		result.clear();
+		return;
 	}
 
-	auto& trackRef = this->pitchWheelList.getReference(track);
-	if (track < 0 || track >= trackRef.size()) {
-		return {};
-	}
+	ptr->noteIndex.find(startSec, endSec, minPitch, maxPitch, result);
+}
 
-	int structIndex = trackRef[index];
-	auto& eventTrackRef = this->eventList.getReference(track);
-	if (structIndex < 0 || structIndex >= eventTrackRef.size()) {
-		return {};
-	}
+const std::tuple<uint8_t, uint8_t> SourceMIDITemp::getNotePitchRange(int track) const {
+	auto ptr = this->getTrack(track);
+	if (!ptr) { return { 0, 0 }; }
 
-	return *(dynamic_cast<SourceMIDITemp::IntParam*>(
-		eventTrackRef.getUnchecked(structIndex)));
+	return ptr->noteIndex.getPitchRange();
 }
 
-const SourceMIDITemp::AfterTouch SourceMIDITemp::getAfterTouch(int track, int index) const {
-	if (track < 0 || track >= this->afterTouchList.size()) {
-		return {};
-	}
-	if (track < 0 || track >= this->eventList.size()) {
+const SourceMIDITemp::IntParam SourceMIDITemp::getPitchWheel(int track, int index) const {
+	auto ptr = this->getTrack(track);
+	if (!ptr || index < 0 || index >= (int)ptr->pitchWheelList.size()) {
 		return {};
 	}
 
-	auto& trackRef = this->afterTouchList.getReference(track);
-	if (track < 0 || track >= trackRef.size()) {
-		return {};
-	}
+	int eventIndex = ptr->pitchWheelList[index];
+	IntParam result;
+	SourceMIDITemp::fillStruct(result, *ptr, eventIndex, index);
+	result.value = ptr->data2[eventIndex];
 
-	int structIndex = trackRef[index];
-	auto& eventTrackRef = this->eventList.getReference(track);
-	if (structIndex < 0 || structIndex >= eventTrackRef.size()) {
+	return result;
+}
+
+const SourceMIDITemp::AfterTouch SourceMIDITemp::getAfterTouch(int track, int index) const {
+	auto ptr = this->getTrack(track);
+	if (!ptr || index < 0 || index >= (int)ptr->afterTouchList.size()) {
 		return {};
 	}
 
-	return *(dynamic_cast<SourceMIDITemp::AfterTouch*>(
-		eventTrackRef.getUnchecked(structIndex)));
+	int eventIndex = ptr->afterTouchList[index];
+	AfterTouch result;
+	SourceMIDITemp::fillStruct(result, *ptr, eventIndex, index);
+	result.notePitch = ptr->data1[eventIndex];
+	result.value = (uint8_t)ptr->data2[eventIndex];
+
+	return result;
 }
 
 const SourceMIDITemp::IntParam SourceMIDITemp::getChannelPressure(int track, int index) const {
-	if (track < 0 || track >= this->channelPressureList.size()) {
-		return {};
-	}
-	if (track < 0 || track >= this->eventList.size()) {
+	auto ptr = this->getTrack(track);
+	if (!ptr || index < 0 || index >= (int)ptr->channelPressureList.size()) {
 		return {};
 	}
 
-	auto& trackRef = this->channelPressureList.getReference(track);
-	if (track < 0 || track >= trackRef.size()) {
-		return {};
-	}
+	int eventIndex = ptr->channelPressureList[index];
+	IntParam result;
+	SourceMIDITemp::fillStruct(result, *ptr, eventIndex, index);
+	result.value = ptr->data2[eventIndex];
 
-	int structIndex = trackRef[index];
-	auto& eventTrackRef = this->eventList.getReference(track);
-	if (structIndex < 0 || structIndex >= eventTrackRef.size()) {
-		return {};
-	}
-
-	return *(dynamic_cast<SourceMIDITemp::IntParam*>(
-		eventTrackRef.getUnchecked(structIndex)));
+	return result;
 }
 
 const SourceMIDITemp::Controller SourceMIDITemp::getController(int track, uint8_t number, int index) const {
-	if (track < 0 || track >= this->controllerList.size()) {
-		return {};
-	}
-	if (track < 0 || track >= this->eventList.size()) {
-		return {};
-	}
+	auto ptr = this->getTrack(track);
+	if (!ptr) { return {}; }
 
-	auto& trackRef = this->controllerList.getReference(track);
-	auto it = trackRef.find(number);
-	if (it == trackRef.end()) {
-		return {};
-	}
+	auto it = ptr->controllerList.find(number);
+	if (it == ptr->controllerList.end()) { return {}; }
+	if (index < 0 || index >= (int)it->second.size()) { return {}; }
 
-	if (track < 0 || track >= it->second.size()) {
-		return {};
-	}
+	int eventIndex = it->second[index];
+	Controller result;
+	SourceMIDITemp::fillStruct(result, *ptr, eventIndex, index);
+	result.number = ptr->data1[eventIndex];
+	result.value = (uint8_t)ptr->data2[eventIndex];
 
-	int structIndex = it->second[index];
-	auto& eventTrackRef = this->eventList.getReference(track);
-	if (structIndex < 0 || structIndex >= eventTrackRef.size()) {
-		return {};
-	}
-
-	return *(dynamic_cast<SourceMIDITemp::Controller*>(
-		eventTrackRef.getUnchecked(structIndex)));
+	return result;
 }
 
 const SourceMIDITemp::Misc SourceMIDITemp::getMisc(int track, int index) const {
-	if (track < 0 || track >= this->miscList.size()) {
-		return {};
-	}
-	if (track < 0 || track >= this->eventList.size()) {
+	auto ptr = this->getTrack(track);
+	if (!ptr || index < 0 || index >= (int)ptr->miscList.size()) {
 		return {};
 	}
 
-	auto& trackRef = this->miscList.getReference(track);
-	if (track < 0 || track >= trackRef.size()) {
-		return {};
-	}
-
-	int structIndex = trackRef[index];
-	auto& eventTrackRef = this->eventList.getReference(track);
-	if (structIndex < 0 || structIndex >= eventTrackRef.size()) {
-		return {};
-	}
+	int eventIndex = ptr->miscList[index];
+	Misc result;
+	SourceMIDITemp::fillStruct(result, *ptr, eventIndex, index);
+	result.message = ptr->miscMessages[ptr->extra[eventIndex]];
 
-	return *(dynamic_cast<SourceMIDITemp::Misc*>(
-		eventTrackRef.getUnchecked(structIndex)));
+	return result;
 }
 
 uint16_t SourceMIDITemp::makeNoteNumberWithChannel(uint8_t channel, uint8_t number) {
@@ -317,107 +261,186 @@ void SourceMIDITemp::findMIDIMessages(
 	int track, double startSec, double endSec,
 	juce::MidiMessageSequence& list, int& indexTemp) const {
 	/** Check Track */
-	if (track < 0 || track >= this->eventList.size()) { return; }
-	auto& trackSeq = this->eventList.getReference(track);
+	auto ptr = this->getTrack(track);
+	if (!ptr) { return; }
+	auto& trackSeq = *ptr;
+	int size = trackSeq.size();
 
-	/** Check Start Index */
-	if (indexTemp < 0 || indexTemp >= trackSeq.size()) {
-		indexTemp = this->binarySearchStart(track, 0, trackSeq.size() - 1, startSec);
-	}
-	else {
-		auto current = trackSeq.getUnchecked(indexTemp);
-		if (current->timeSec >= startSec) {
-			if (auto last = trackSeq[indexTemp - 1]) {
-				if (last->timeSec >= startSec) {
-					indexTemp = this->binarySearchStart(track, 0, indexTemp, startSec);
-				}
-			}
-		}
-		else {
-			indexTemp = this->binarySearchStart(track, indexTemp, trackSeq.size() - 1, startSec);
-		}
+	/** Keep Start Index When Playing Continuously */
+	if (!SourceMIDITemp::isStartValid(trackSeq, indexTemp, startSec)) {
+		indexTemp = SourceMIDITemp::searchStart(trackSeq, startSec);
 	}
-	if (indexTemp < 0) { return; }
 
 	/** Events */
-	for (; indexTemp < trackSeq.size(); indexTemp++) {
-		auto eventPtr = trackSeq.getUnchecked(indexTemp);
+	for (; indexTemp < size; indexTemp++) {
+		int i = indexTemp;
+		double time = trackSeq.time[i];
 
 		/** End */
-		if (eventPtr->timeSec >= endSec) { break; }
+		if (time >= endSec) { break; }
 
-		/** Note On */
-		if (auto note = dynamic_cast<Note*>(eventPtr)) {
+		switch (trackSeq.type[i]) {
+		case EventType::NoteOn: {
 			/** Lyrics */
-			if (note->lyrics.isNotEmpty()) {
-				auto lyricsEvent = juce::MidiMessage::textMetaEvent(
-					MIDI_LYRICS_TYPE, note->lyrics);
-				lyricsEvent.setTimeStamp(note->timeSec);
+			int lyricsIndex = trackSeq.extra[i];
+			if (lyricsIndex >= 0) {
+				auto lyricsEvent = trackSeq.lyricsMessages[lyricsIndex];
+				lyricsEvent.setTimeStamp(time);
 
 				list.addEvent(lyricsEvent);
 			}
 
 			/** Event */
 			auto onEvent = juce::MidiMessage::noteOn(
-				note->channel, note->pitch, note->vel);
-			onEvent.setTimeStamp(note->timeSec);
+				trackSeq.channel[i], trackSeq.data1[i], (uint8_t)trackSeq.data2[i]);
+			onEvent.setTimeStamp(time);
 
 			list.addEvent(onEvent);
+			break;
 		}
-		/** Note Off */
-		else if (auto noteOff = dynamic_cast<NoteOffMarker*>(eventPtr)) {
-			if (auto note = dynamic_cast<Note*>(trackSeq[noteOff->eventOnIndex])) {
+		case EventType::NoteOff: {
+			int onIndex = trackSeq.pair[i];
+			if (onIndex >= 0) {
 				/** Event */
 				auto offEvent = juce::MidiMessage::noteOff(
-					note->channel, note->pitch, note->vel);
-				offEvent.setTimeStamp(noteOff->timeSec);
+					trackSeq.channel[onIndex], trackSeq.data1[onIndex], (uint8_t)trackSeq.data2[onIndex]);
+				offEvent.setTimeStamp(time);
 
 				list.addEvent(offEvent);
 			}
+			break;
 		}
-		/** Pitch Wheel */
-		else if (auto pitch = dynamic_cast<IntParam*>(eventPtr)) {
-			/** Event */
+		case EventType::PitchWheel: {
 			auto event = juce::MidiMessage::pitchWheel(
-				pitch->channel, pitch->value);
-			event.setTimeStamp(pitch->timeSec);
+				trackSeq.channel[i], trackSeq.data2[i]);
+			event.setTimeStamp(time);
 
 			list.addEvent(event);
+			break;
 		}
-		/** After Touch */
-		else if (auto afterTouch = dynamic_cast<AfterTouch*>(eventPtr)) {
-			/** Event */
+		case EventType::AfterTouch: {
 			auto event = juce::MidiMessage::aftertouchChange(
-				afterTouch->channel, afterTouch->notePitch, afterTouch->value);
-			event.setTimeStamp(afterTouch->timeSec);
+				trackSeq.channel[i], trackSeq.data1[i], trackSeq.data2[i]);
+			event.setTimeStamp(time);
 
 			list.addEvent(event);
+			break;
 		}
-		/** Channel Pressure */
-		else if (auto channelPressure = dynamic_cast<IntParam*>(eventPtr)) {
-			/** Event */
+		case EventType::ChannelPressure: {
 			auto event = juce::MidiMessage::channelPressureChange(
-				channelPressure->channel, channelPressure->value);
-			event.setTimeStamp(channelPressure->timeSec);
+				trackSeq.channel[i], trackSeq.data2[i]);
+			event.setTimeStamp(time);
 
 			list.addEvent(event);
+			break;
 		}
-		/** Controller */
-		else if (auto controller = dynamic_cast<Controller*>(eventPtr)) {
-			/** Event */
+		case EventType::Controller: {
 			auto event = juce::MidiMessage::controllerEvent(
-				controller->channel, controller->number, controller->value);
-			event.setTimeStamp(controller->timeSec);
+				trackSeq.channel[i], trackSeq.data1[i], trackSeq.data2[i]);
+			event.setTimeStamp(time);
 
 			list.addEvent(event);
+			break;
 		}
-		/** Misc */
-		else if (auto misc = dynamic_cast<Misc*>(eventPtr)) {
-			/** Event */
-			auto event = misc->message;
-			event.setTimeStamp(misc->timeSec);
+		case EventType::Misc: {
+			auto event = trackSeq.miscMessages[trackSeq.extra[i]];
+			event.setTimeStamp(time);
 
 			list.addEvent(event);
+			break;
+		}
+		}
+	}
+}
+
+void SourceMIDITemp::readMIDIMessages(
+	int track, double startSec, double endSec,
+	double baseSec, double sampleRate,
+	juce::MidiBuffer& buffer, Cursor& cursor) const {
+	/** Check Track */
+	auto ptr = this->getTrack(track);
+	if (!ptr) { return; }
+	auto& trackSeq = *ptr;
+	int size = trackSeq.size();
+
+	/** Rebind Cursor On Seek, Loop Or Track Change */
+	if (cursor.track != track || cursor.endSec != startSec
+		|| !SourceMIDITemp::isStartValid(trackSeq, cursor.index, startSec)) {
+		cursor.track = track;
+		cursor.index = SourceMIDITemp::searchStart(trackSeq, startSec);
+	}
+	cursor.endSec = endSec;
+
+	/** Events */
+	std::array<uint8_t, 3> data{};
+	for (; cursor.index < size; cursor.index++) {
+		int i = cursor.index;
+		double time = trackSeq.time[i];
+
+		/** End */
+		if (time >= endSec) { break; }
+
+		int samplePos = (int)std::floor((time - baseSec) * sampleRate);
+		uint8_t channel = (uint8_t)((trackSeq.channel[i] - 1) & 0x0F);
+
+		switch (trackSeq.type[i]) {
+		case EventType::NoteOn: {
+			/** Lyrics */
+			int lyricsIndex = trackSeq.extra[i];
+			if (lyricsIndex >= 0) {
+				auto& message = trackSeq.lyricsMessages[lyricsIndex];
+				buffer.addEvent(message.getRawData(), message.getRawDataSize(), samplePos);
+			}
+
+			/** Event */
+			data[0] = (uint8_t)(0x90 | channel);
+			data[1] = trackSeq.data1[i];
+			data[2] = (uint8_t)trackSeq.data2[i];
+			buffer.addEvent(data.data(), 3, samplePos);
+			break;
+		}
+		case EventType::NoteOff: {
+			int onIndex = trackSeq.pair[i];
+			if (onIndex >= 0) {
+				data[0] = (uint8_t)(0x80 | ((trackSeq.channel[onIndex] - 1) & 0x0F));
+				data[1] = trackSeq.data1[onIndex];
+				data[2] = (uint8_t)trackSeq.data2[onIndex];
+				buffer.addEvent(data.data(), 3, samplePos);
+			}
+			break;
+		}
+		case EventType::PitchWheel: {
+			data[0] = (uint8_t)(0xE0 | channel);
+			data[1] = (uint8_t)(trackSeq.data2[i] & 0x7F);
+			data[2] = (uint8_t)((trackSeq.data2[i] >> 7) & 0x7F);
+			buffer.addEvent(data.data(), 3, samplePos);
+			break;
+		}
+		case EventType::AfterTouch: {
+			data[0] = (uint8_t)(0xA0 | channel);
+			data[1] = trackSeq.data1[i];
+			data[2] = (uint8_t)trackSeq.data2[i];
+			buffer.addEvent(data.data(), 3, samplePos);
+			break;
+		}
+		case EventType::ChannelPressure: {
+			data[0] = (uint8_t)(0xD0 | channel);
+			data[1] = (uint8_t)trackSeq.data2[i];
+			buffer.addEvent(data.data(), 2, samplePos);
+			break;
+		}
+		case EventType::Controller: {
+			data[0] = (uint8_t)(0xB0 | channel);
+			data[1] = trackSeq.data1[i];
+			data[2] = (uint8_t)trackSeq.data2[i];
+			buffer.addEvent(data.data(), 3, samplePos);
+			break;
+		}
+		case EventType::Misc: {
+			auto& message = trackSeq.miscMessages[trackSeq.extra[i]];
+			buffer.addEvent(message.getRawData(), message.getRawDataSize(), samplePos);
+			break;
+		}
 		}
 	}
 }
@@ -426,20 +449,10 @@ void SourceMIDITemp::addMIDIMessages(
 	int track, const juce::MidiMessageSequence& list,
 	NoteOnTemp& noteOnTemp, int& indexTemp, LyricsItem& lyricsTemp) {
 	/** Check Track */
-	if (track < 0 || track >= this->eventList.size()) { return; }
-	auto& trackSeq = this->eventList.getReference(track);
-
-	/** Index Lists */
-	auto& noteSeq = this->noteList.getReference(track);
-	auto& pitchWheelSeq = this->pitchWheelList.getReference(track);
-	auto& channelPressureSeq = this->channelPressureList.getReference(track);
-	auto& afterTouchSeq = this->afterTouchList.getReference(track);
-	auto& controllerSeq = this->controllerList.getReference(track);
-	auto& miscSeq = this->miscList.getReference(track);
+	if (track < 0 || track >= (int)this->tracks.size()) { return; }
 
 	SourceMIDITemp::addMIDIMessages(
-		trackSeq, noteSeq, pitchWheelSeq, channelPressureSeq, afterTouchSeq, controllerSeq, miscSeq,
-		list, noteOnTemp, indexTemp, lyricsTemp);
+		this->tracks[track], list, noteOnTemp, indexTemp, lyricsTemp);
 }
 
 void SourceMIDITemp::clearUnmatchedMIDINotes(int track) {
@@ -453,218 +466,171 @@ void SourceMIDITemp::clearWriteTemps(
 	lyricsTemp = MIDI_LYRICS_TEMP_INIT;
 }
 
-int SourceMIDITemp::binarySearchStart(
-	int track, int low, int high, double time) const {
-	auto& trackSeq = this->eventList.getReference(track);
+int SourceMIDITemp::EventTrack::size() const {
+	return (int)this->time.size();
+}
 
-	while (low <= high) {
-		int mid = low + (high - low) / 2;
+void SourceMIDITemp::EventTrack::reserve(int num) {
+	this->time.reserve(num);
+	this->type.reserve(num);
+	this->channel.reserve(num);
+	this->data1.reserve(num);
+	this->data2.reserve(num);
+	this->pair.reserve(num);
+	this->extra.reserve(num);
+}
 
-		auto current = trackSeq[mid];
-		auto next = trackSeq[mid + 1];
-		if (!current) { return -1; }
+int SourceMIDITemp::EventTrack::add(EventType type, double time, uint8_t channel,
+	uint8_t data1, uint16_t data2, int extra) {
+	int index = this->size();
 
-		if (mid == low) {
-			if (time <= current->timeSec) {
-				return mid;
-			}
-		}
-		if (mid == high) {
-			if (time > current->timeSec) {
-				if (next && time <= next->timeSec) {
-					return mid;
-				}
-				return -1;
-			}
-		}
+	this->time.push_back(time);
+	this->type.push_back(type);
+	this->channel.push_back(channel);
+	this->data1.push_back(data1);
+	this->data2.push_back(data2);
+	this->pair.push_back(-1);
+	this->extra.push_back(extra);
 
-		if (time > current->timeSec && next && time <= next->timeSec) {
-			return mid + 1;
-		}
-		else if (time <= current->timeSec) {
-			high = mid - 1;
-			continue;
-		}
-		else {
-			low = mid + 1;
-			continue;
-		}
+	return index;
+}
+
+const SourceMIDITemp::EventTrack* SourceMIDITemp::getTrack(int track) const {
+	if (track < 0 || track >= (int)this->tracks.size()) {
+		return nullptr;
 	}
+	return &(this->tracks[track]);
+}
 
-	return -1;
+void SourceMIDITemp::fillStruct(MIDIStruct& dst,
+	const EventTrack& track, int eventIndex, int listIndex) {
+	dst.channel = track.channel[eventIndex];
+	dst.timeSec = track.time[eventIndex];
+	dst.eventIndex = eventIndex;
+	dst.eventInListIndex = listIndex;
 }
 
-void SourceMIDITemp::addMIDIMessages(
-	juce::OwnedArray<MIDIStruct>& eventsList,
-	juce::Array<int>& noteTrackIndexList,
-	juce::Array<int>& pitchWheelIndexList,
-	juce::Array<int>& channelPressureIndexList,
-	juce::Array<int>& afterTouchIndexList,
-	std::unordered_map<uint8_t, juce::Array<int>>& controllersIndexList,
-	juce::Array<int>& miscsIndexList,
+int SourceMIDITemp::searchStart(const EventTrack& track, double time) {
+	/** First Event At Or After Time */
+	auto it = std::lower_bound(track.time.begin(), track.time.end(), time);
+	return (int)(it - track.time.begin());
+}
+
+bool SourceMIDITemp::isStartValid(const EventTrack& track, int index, double time) {
+	int size = track.size();
+	return index >= 0 && index <= size
+		&& (index == size || track.time[index] >= time)
+		&& (index == 0 || track.time[index - 1] < time);
+}
+
+void SourceMIDITemp::addMIDIMessages(EventTrack& track,
 	const juce::MidiMessageSequence& list,
 	NoteOnTemp& noteOnTemp, int& indexTemp, LyricsItem& lyricsTemp) {
 	for (auto event : list) {
-		SourceMIDITemp::addMIDIMessage(eventsList, noteTrackIndexList, pitchWheelIndexList,
-			channelPressureIndexList, afterTouchIndexList, controllersIndexList, miscsIndexList,
+		SourceMIDITemp::addMIDIMessage(track,
 			event->message, noteOnTemp, indexTemp, lyricsTemp);
 	}
 }
 
-void SourceMIDITemp::addMIDIMessage(
-	juce::OwnedArray<MIDIStruct>& eventsList,
-	juce::Array<int>& noteTrackIndexList,
-	juce::Array<int>& pitchWheelIndexList,
-	juce::Array<int>& channelPressureIndexList,
-	juce::Array<int>& afterTouchIndexList,
-	std::unordered_map<uint8_t, juce::Array<int>>& controllersIndexList,
-	juce::Array<int>& miscsIndexList,
+void SourceMIDITemp::addMIDIMessage(EventTrack& track,
 	const juce::MidiMessage& message,
 	NoteOnTemp& noteOnTemp, int& indexTemp, LyricsItem& lyricsTemp) {
 	/** TODO Select Insert Index And Update Index Temp */
-	int index = eventsList.size();
-	int listIndex = -1;
+	double time = message.getTimeStamp();
 
 	/** Get Notes */
 	if (message.isNoteOn(!utils::regardVel0NoteAsNoteOff())) {
-		auto note = std::make_unique<Note>();
-		note->channel = (uint8_t)message.getChannel();
-		note->timeSec = message.getTimeStamp();
-		note->endSec = note->timeSec;
-		note->pitch = (uint8_t)message.getNoteNumber();
-		note->vel = message.getVelocity();
-
-		if (juce::approximatelyEqual(std::get<0>(lyricsTemp), note->timeSec)) {
-			note->lyrics = std::get<1>(lyricsTemp);
+		auto channel = (uint8_t)message.getChannel();
+		auto pitch = (uint8_t)message.getNoteNumber();
+
+		/** Lyrics */
+		int lyricsIndex = -1;
+		if (juce::approximatelyEqual(std::get<0>(lyricsTemp), time)) {
+			lyricsIndex = (int)track.lyrics.size();
+			track.lyrics.push_back(std::get<1>(lyricsTemp));
+			track.lyricsMessages.push_back(juce::MidiMessage::textMetaEvent(
+				MIDI_LYRICS_TYPE, std::get<1>(lyricsTemp)));
 			lyricsTemp = MIDI_LYRICS_TEMP_INIT;
 		}
 
-		note->eventOffIndex = -1;
-		noteOnTemp[SourceMIDITemp::makeNoteNumberWithChannel(note->channel, note->pitch)] = index;
-
-		note->eventIndex = index;
-		note->eventInListIndex = listIndex;
-
-		eventsList.insert(index, std::move(note));
-		noteTrackIndexList.insert(listIndex, index);
+		int index = track.add(EventType::NoteOn, time,
+			channel, pitch, message.getVelocity(), lyricsIndex);
+		noteOnTemp[SourceMIDITemp::makeNoteNumberWithChannel(channel, pitch)] = index;
+		track.noteList.push_back(index);
+		track.noteIndex.add(pitch, time, time);
 
 		return;
 	}
 	/** Get Lyrics */
 	if (message.isMetaEvent() && message.getMetaEventType() == MIDI_LYRICS_TYPE) {
-		lyricsTemp = { message.getTimeStamp(), message.getTextFromTextMetaEvent() };
+		lyricsTemp = { time, message.getTextFromTextMetaEvent() };
 		return;
 	}
 	/** Note Off Marker */
 	if (message.isNoteOff(utils::regardVel0NoteAsNoteOff())) {
-		auto noteOff = std::make_unique<NoteOffMarker>();
-		noteOff->channel = (uint8_t)message.getChannel();
-		noteOff->timeSec = message.getTimeStamp();
-
-		noteOff->eventOnIndex = -1;
-		{
-			auto tempIt = noteOnTemp.find(SourceMIDITemp::makeNoteNumberWithChannel(
-				(uint8_t)message.getChannel(), (uint8_t)message.getNoteNumber()));
-			if (tempIt != noteOnTemp.end()) {
-				int noteIndex = tempIt->second;
-				if (noteIndex >= 0 && noteIndex < index) {
-					if (auto note = dynamic_cast<Note*>(eventsList[noteIndex])) {
-						note->endSec = noteOff->timeSec;
-						note->eventOffIndex = index;
-
-						noteOff->eventOnIndex = noteIndex;
-					}
+		int index = track.add(EventType::NoteOff, time,
+			(uint8_t)message.getChannel(), (uint8_t)message.getNoteNumber(), 0, -1);
+
+		auto tempIt = noteOnTemp.find(SourceMIDITemp::makeNoteNumberWithChannel(
+			(uint8_t)message.getChannel(), (uint8_t)message.getNoteNumber()));
+		if (tempIt != noteOnTemp.end()) {
+			int noteIndex = tempIt->second;
+			if (noteIndex >= 0 && noteIndex < index
+				&& track.type[noteIndex] == EventType::NoteOn) {
+				track.pair[noteIndex] = index;
+				track.pair[index] = noteIndex;
+
+				/** Note Ends Here */
+				auto noteIt = std::lower_bound(
+					track.noteList.begin(), track.noteList.end(), noteIndex);
+				if (noteIt != track.noteList.end() && *noteIt == noteIndex) {
+					track.noteIndex.setEnd((int)(noteIt - track.noteList.begin()), time);
 				}
-
-				noteOnTemp.erase(tempIt);
 			}
-		}
 
-		noteOff->eventIndex = index;
-		noteOff->eventInListIndex = listIndex;
-
-		eventsList.insert(index, std::move(noteOff));
+			noteOnTemp.erase(tempIt);
+		}
 
 		return;
 	}
 	/** Pitch Wheel */
 	if (message.isPitchWheel()) {
-		auto param = std::make_unique<IntParam>();
-		param->channel = (uint8_t)message.getChannel();
-		param->timeSec = message.getTimeStamp();
-		param->value = message.getPitchWheelValue();
-
-		param->eventIndex = index;
-		param->eventInListIndex = listIndex;
-
-		eventsList.insert(index, std::move(param));
-		pitchWheelIndexList.insert(listIndex, index);
-
+		int index = track.add(EventType::PitchWheel, time,
+			(uint8_t)message.getChannel(), 0, (uint16_t)message.getPitchWheelValue(), -1);
+		track.pitchWheelList.push_back(index);
 		return;
 	}
 	/** After Touch */
 	if (message.isAftertouch()) {
-		auto param = std::make_unique<AfterTouch>();
-		param->channel = (uint8_t)message.getChannel();
-		param->timeSec = message.getTimeStamp();
-		param->notePitch = (uint8_t)message.getNoteNumber();
-		param->value = (uint8_t)message.getAfterTouchValue();
-
-		param->eventIndex = index;
-		param->eventInListIndex = listIndex;
-
-		eventsList.insert(index, std::move(param));
-		afterTouchIndexList.insert(listIndex, index);
-
+		int index = track.add(EventType::AfterTouch, time,
+			(uint8_t)message.getChannel(), (uint8_t)message.getNoteNumber(),
+			(uint16_t)message.getAfterTouchValue(), -1);
+		track.afterTouchList.push_back(index);
 		return;
 	}
 	/** Channel Pressure */
 	if (message.isChannelPressure()) {
-		auto param = std::make_unique<IntParam>();
-		param->channel = (uint8_t)message.getChannel();
-		param->timeSec = message.getTimeStamp();
-		param->value = message.getChannelPressureValue();
-
-		param->eventIndex = index;
-		param->eventInListIndex = listIndex;
-
-		eventsList.insert(index, std::move(param));
-		channelPressureIndexList.insert(listIndex, index);
-
+		int index = track.add(EventType::ChannelPressure, time,
+			(uint8_t)message.getChannel(), 0, (uint16_t)message.getChannelPressureValue(), -1);
+		track.channelPressureList.push_back(index);
 		return;
 	}
 	/** MIDI CC */
 	if (message.isController()) {
-		auto controller = std::make_unique<Controller>();
-		controller->channel = (uint8_t)message.getChannel();
-		controller->timeSec = message.getTimeStamp();
-		controller->number = (uint8_t)message.getControllerNumber();
-		controller->value = (uint8_t)message.getControllerValue();
-
-		auto& controllerList = controllersIndexList[controller->number];
-
-		controller->eventIndex = index;
-		controller->eventInListIndex = listIndex;
-
-		eventsList.insert(index, std::move(controller));
-		controllerList.insert(listIndex, index);
-
+		auto number = (uint8_t)message.getControllerNumber();
+		int index = track.add(EventType::Controller, time,
+			(uint8_t)message.getChannel(), number, (uint16_t)message.getControllerValue(), -1);
+		track.controllerList[number].push_back(index);
 		return;
 	}
 	/** Other exclude Lyrics */
 	{
-		auto misc = std::make_unique<Misc>();
-		misc->channel = (message.isSysEx() || message.isMetaEvent())
+		uint8_t channel = (message.isSysEx() || message.isMetaEvent())
 			? 0 : (uint8_t)message.getChannel();
-		misc->timeSec = message.getTimeStamp();
-		misc->message = message;
-
-		misc->eventIndex = index;
-		misc->eventInListIndex = listIndex;
-
-		eventsList.insert(index, std::move(misc));
-		miscsIndexList.insert(listIndex, index);
-
+		int index = track.add(EventType::Misc, time,
+			channel, 0, 0, (int)track.miscMessages.size());
+		track.miscMessages.push_back(message);
+		track.miscList.push_back(index);
 		return;
 	}
 }
@@ -1,10 +1,12 @@
 ﻿#pragma once
 
 #include <JuceHeader.h>
+#include "SourceMIDINoteIndex.h"
 
 class SourceMIDITemp final {
 public:
 	SourceMIDITemp() = default;
+	SourceMIDITemp(const SourceMIDITemp& other) = default;
 
 	void setData(const juce::MidiFile& data);
 	void addTrack(const juce::MidiMessageSequence& track);
@@ -13,8 +15,6 @@ public:
 	const juce::MidiMessageSequence makeMIDITrack(int index) const;
 
 	struct MIDIStruct {
-		virtual ~MIDIStruct() = default;
-
 		uint8_t channel = 0;
 		double timeSec = 0;
 
@@ -29,9 +29,6 @@ public:
 
 		int eventOffIndex = -1;
 	};
-	struct NoteOffMarker : public MIDIStruct {
-		int eventOnIndex = -1;
-	};
 	struct IntParam : public MIDIStruct {
 		int value = 0;
 	};
@@ -65,6 +62,13 @@ public:
 	const Controller getController(int track, uint8_t number, int index) const;
 	const Misc getMisc(int track, int index) const;
 
+	/**
+	 * @brief	Note indices of notes overlapping [startSec, endSec] with pitch in [minPitch, maxPitch].
+	 */
+	void findNotes(int track, double startSec, double endSec,
+		uint8_t minPitch, uint8_t maxPitch, std::vector<int>& result) const;
+	const std::tuple<uint8_t, uint8_t> getNotePitchRange(int track) const;
+
 	/** Second, Lyrics */
 	using LyricsItem = std::tuple<double, juce::String>;
 	using NoteOnTemp = std::unordered_map<uint16_t, int>;
@@ -72,6 +76,21 @@ public:
 	void findMIDIMessages(
 		int track, double startSec, double endSec,
 		juce::MidiMessageSequence& list, int& indexTemp) const;
+
+	/** Playback position of one voice */
+	struct Cursor final {
+		int track = -1;
+		int index = -1;
+		double endSec = -1;
+	};
+	/**
+	 * @brief	Add events in [startSec, endSec) to the buffer without allocation.
+	 *			The cursor continues from the last read and only searches again on seek, loop or track change.
+	 */
+	void readMIDIMessages(
+		int track, double startSec, double endSec,
+		double baseSec, double sampleRate,
+		juce::MidiBuffer& buffer, Cursor& cursor) const;
 	void addMIDIMessages(
 		int track, const juce::MidiMessageSequence& list,
 		NoteOnTemp& noteOnTemp, int& indexTemp, LyricsItem& lyricsTemp);
@@ -81,40 +100,62 @@ public:
 		NoteOnTemp& noteOnTemp, int& indexTemp, LyricsItem& lyricsTemp);
 
 private:
-	juce::Array<juce::OwnedArray<MIDIStruct>> eventList;
-	short timeFormat = 480;
-
-	juce::Array<juce::Array<int>> noteList;
-
-	juce::Array<juce::Array<int>> pitchWheelList;
-	juce::Array<juce::Array<int>> afterTouchList;
-	juce::Array<juce::Array<int>> channelPressureList;
+	enum class EventType : uint8_t {
+		NoteOn, NoteOff, PitchWheel, AfterTouch, ChannelPressure, Controller, Misc
+	};
 
-	juce::Array<std::unordered_map<uint8_t, juce::Array<int>>> controllerList;
+	/**
+	 * Events of one track in time order, stored as parallel arrays of fixed-size fields.
+	 * Lyrics and misc messages live in side tables and index lists point into the events.
+	 */
+	struct EventTrack final {
+		std::vector<double> time;
+		std::vector<EventType> type;
+		std::vector<uint8_t> channel;
+		/** Pitch, controller number */
+		std::vector<uint8_t> data1;
+		/** Velocity, value, pitch wheel value */
+		std::vector<uint16_t> data2;
+		/** Paired note on or note off event, -1 when unmatched */
+		std::vector<int> pair;
+		/** Lyrics index of notes, misc message index of misc events, otherwise -1 */
+		std::vector<int> extra;
+
+		std::vector<juce::String> lyrics;
+		/** Lyrics meta events encoded when added, so playback copies them without allocating */
+		std::vector<juce::MidiMessage> lyricsMessages;
+		std::vector<juce::MidiMessage> miscMessages;
+
+		std::vector<int> noteList;
+		std::vector<int> pitchWheelList;
+		std::vector<int> afterTouchList;
+		std::vector<int> channelPressureList;
+		std::unordered_map<uint8_t, std::vector<int>> controllerList;
+		std::vector<int> miscList;
+
+		/** Time and pitch index of noteList */
+		SourceMIDINoteIndex noteIndex;
+
+		int size() const;
+		void reserve(int num);
+		int add(EventType type, double time, uint8_t channel,
+			uint8_t data1, uint16_t data2, int extra);
+	};
+	std::vector<EventTrack> tracks;
+	short timeFormat = 480;
 
-	juce::Array<juce::Array<int>> miscList;
+	const EventTrack* getTrack(int track) const;
+	static void fillStruct(MIDIStruct& dst,
+		const EventTrack& track, int eventIndex, int listIndex);
 
-	int binarySearchStart(int track, int low, int high, double time) const;
-	static void addMIDIMessages(
-		juce::OwnedArray<MIDIStruct>& eventsList,
-		juce::Array<int>& noteTrackIndexList,
-		juce::Array<int>& pitchWheelIndexList,
-		juce::Array<int>& channelPressureIndexList,
-		juce::Array<int>& afterTouchIndexList,
-		std::unordered_map<uint8_t, juce::Array<int>>& controllersIndexList,
-		juce::Array<int>& miscsIndexList,
+	static int searchStart(const EventTrack& track, double time);
+	static bool isStartValid(const EventTrack& track, int index, double time);
+	static void addMIDIMessages(EventTrack& track,
 		const juce::MidiMessageSequence& list,
 		NoteOnTemp& noteOnTemp, int& indexTemp, LyricsItem& lyricsTemp);
-	static void addMIDIMessage(
-		juce::OwnedArray<MIDIStruct>& eventsList,
-		juce::Array<int>& noteTrackIndexList,
-		juce::Array<int>& pitchWheelIndexList,
-		juce::Array<int>& channelPressureIndexList,
-		juce::Array<int>& afterTouchIndexList,
-		std::unordered_map<uint8_t, juce::Array<int>>& controllersIndexList,
-		juce::Array<int>& miscsIndexList,
+	static void addMIDIMessage(EventTrack& track,
 		const juce::MidiMessage& message,
 		NoteOnTemp& noteOnTemp, int& indexTemp, LyricsItem& lyricsTemp);
 
-	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourceMIDITemp)
+	JUCE_LEAK_DETECTOR(SourceMIDITemp)
 };
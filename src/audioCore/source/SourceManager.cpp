@@ -1,8 +1,9 @@
 ﻿#include "SourceManager.h"
+#include "SourceRecordAllocator.h"
 #include "../misc/AudioLock.h"
 
 uint64_t SourceManager::applySource(SourceType type) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	/** Create Item */
 	auto ptr = std::make_shared<SourceItem>(type);
@@ -19,7 +20,7 @@ uint64_t SourceManager::applySource(SourceType type) {
 }
 
 void SourceManager::releaseSource(uint64_t ref) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 	this->sources.erase(ref);
 }
 
@@ -100,7 +101,7 @@ double SourceManager::getLength(uint64_t ref, SourceType type) const {
 
 void SourceManager::initAudio(uint64_t ref, const juce::String& name,
 	int channelNum, double sampleRate, double length) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
 		ptr->initAudio(name, channelNum, sampleRate, length);
@@ -108,7 +109,7 @@ void SourceManager::initAudio(uint64_t ref, const juce::String& name,
 }
 
 void SourceManager::initMIDI(uint64_t ref, const juce::String& name) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	if (auto ptr = this->getSource(ref, SourceType::MIDI)) {
 		ptr->initMIDI(name);
@@ -116,15 +117,17 @@ void SourceManager::initMIDI(uint64_t ref, const juce::String& name) {
 }
 
 void SourceManager::setAudio(uint64_t ref, double sampleRate, const juce::AudioSampleBuffer& data, const juce::String& name) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
 		ptr->setAudio(sampleRate, data, name);
 	}
+	this->requestConvert(ref);
+	this->requestPeak(ref);
 }
 
 void SourceManager::setMIDI(uint64_t ref, const juce::MidiFile& data, const juce::String& name) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	if (auto ptr = this->getSource(ref, SourceType::MIDI)) {
 		ptr->setMIDI(data, name);
@@ -132,21 +135,34 @@ void SourceManager::setMIDI(uint64_t ref, const juce::MidiFile& data, const juce
 }
 
 void SourceManager::setAudio(uint64_t ref, const juce::String& name) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
 		ptr->setAudio(name);
 	}
+	this->requestConvert(ref);
+	this->requestPeak(ref);
 }
 
 void SourceManager::setMIDI(uint64_t ref, const juce::String& name) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 
 	if (auto ptr = this->getSource(ref, SourceType::MIDI)) {
 		ptr->setMIDI(name);
 	}
 }
 
+void SourceManager::setAudioStream(uint64_t ref, const juce::File& file,
+	std::shared_ptr<juce::AudioFormatReader> reader, const juce::String& name, bool preview) {
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
+
+	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
+		ptr->setAudioStream(file, reader, name, preview);
+	}
+	this->requestConvert(ref);
+	this->requestPeak(ref);
+}
+
 const std::tuple<double, juce::AudioSampleBuffer> SourceManager::getAudio(uint64_t ref) const {
 	juce::ScopedReadLock locker(audioLock::getSourceLock());
 
@@ -178,44 +194,62 @@ const juce::MidiFile SourceManager::makeMIDIFile(uint64_t ref) const {
 }
 
 void SourceManager::prepareAudioPlay(uint64_t ref) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
 		ptr->prepareAudioPlay();
 	}
 }
 
 void SourceManager::prepareMIDIPlay(uint64_t ref) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 	if (auto ptr = this->getSource(ref, SourceType::MIDI)) {
 		ptr->prepareMIDIPlay();
 	}
 }
 
 void SourceManager::prepareAudioRecord(uint64_t ref, int channelNum) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
 		ptr->prepareAudioRecord(channelNum);
+
+		/** Grow In Background While Recording */
+		SourceRecordAllocator::getInstance()->add(ptr->getAudioContainer());
 	}
 }
 
 void SourceManager::prepareMIDIRecord(uint64_t ref) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 	if (auto ptr = this->getSource(ref, SourceType::MIDI)) {
 		ptr->prepareMIDIRecord();
+
+		/** Add MIDI Recorded By The Audio Thread In Background */
+		SourceRecordAllocator::getInstance()->startThread();
+	}
+}
+
+void SourceManager::prepareRequestedRecord() {
+	if (!this->recordRequested.exchange(false)) { return; }
+
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
+	for (auto& [ref, ptr] : this->sources) {
+		if (ptr->prepareRequestedRecord()) {
+			/** Grow In Background While Recording */
+			SourceRecordAllocator::getInstance()->add(ptr->getAudioContainer());
+		}
 	}
 }
 
 void SourceManager::setCallback(
 	uint64_t ref, SourceType type,
 	const ChangedCallback& callback) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 	if (auto ptr = this->getSource(ref, type)) {
 		ptr->setCallback(callback);
 	}
 }
 
 void SourceManager::setAudioFormat(uint64_t ref, const AudioFormat& format) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
 		ptr->setAudioFormat(format);
 	}
@@ -237,33 +271,101 @@ double SourceManager::getAudioSampleRate(uint64_t ref) const {
 	return 0;
 }
 
-void SourceManager::readAudioData(uint64_t ref, juce::AudioBuffer<float>& buffer, int bufferOffset,
+const juce::File SourceManager::getAudioStreamFile(uint64_t ref) const {
+	juce::ScopedReadLock locker(audioLock::getSourceLock());
+	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
+		return ptr->getAudioStreamFile();
+	}
+	return juce::File{};
+}
+
+std::shared_ptr<const SourceInternalContainer> SourceManager::getAudioContainer(uint64_t ref) const {
+	juce::ScopedReadLock locker(audioLock::getSourceLock());
+	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
+		return ptr->getAudioContainer();
+	}
+	return nullptr;
+}
+
+void SourceManager::setConvertedData(uint64_t ref, uint64_t version, SourceConvertCache::Result data) {
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
+	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
+		ptr->setConvertedData(version, data);
+	}
+}
+
+void SourceManager::setPeakData(uint64_t ref, uint64_t version, SourcePeakCache::Result data) {
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
+	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
+		ptr->setPeakData(version, data);
+	}
+}
+
+const std::tuple<bool, SourcePeakPyramid::Result> SourceManager::getAudioPeak(
+	uint64_t ref, double startSec, double endSec, int pointNum) const {
+	/** Take References Under The Lock */
+	SourceItem::PeakSource source;
+	{
+		juce::ScopedReadLock locker(audioLock::getSourceLock());
+		auto ptr = this->getSource(ref, SourceType::Audio);
+		if (!ptr) { return { true, {} }; }
+
+		/** Build Pyramid Of Recorded Or Not Yet Requested Sources */
+		this->requestPeak(ref);
+		source = ptr->getPeakSource();
+	}
+
+	/** Read Audio Without Blocking The Audio Thread */
+	return SourceItem::getAudioPeak(source, startSec, endSec, pointNum);
+}
+
+void SourceManager::readAudioData(uint64_t ref, SourceResampler& resampler,
+	juce::AudioBuffer<float>& buffer, int bufferOffset,
 	int dataOffset, int length) const {
 	if (auto ptr = this->getSourceFast(ref, SourceType::Audio)) {
-		ptr->readAudioData(buffer, bufferOffset, dataOffset, length);
+		ptr->readAudioData(resampler, buffer, bufferOffset, dataOffset, length);
 	}
 }
 
-void SourceManager::readMIDIData(uint64_t ref, juce::MidiBuffer& buffer, double baseTime,
+void SourceManager::readMIDIData(uint64_t ref, SourceMIDITemp::Cursor& cursor,
+	juce::MidiBuffer& buffer, double baseTime,
 	double startTime, double endTime, int trackIndex) const {
 	if (auto ptr = this->getSourceFast(ref, SourceType::MIDI)) {
-		ptr->readMIDIData(buffer, baseTime, startTime, endTime, trackIndex);
+		ptr->readMIDIData(cursor, buffer, baseTime, startTime, endTime, trackIndex);
 	}
 }
 
 void SourceManager::writeAudioData(uint64_t ref, juce::AudioBuffer<float>& buffer, int offset,
 	int trackChannelNum) {
 	if (auto ptr = this->getSourceFast(ref, SourceType::Audio)) {
-		ptr->writeAudioData(buffer, offset, trackChannelNum);
+		if (!ptr->writeAudioData(buffer, offset, trackChannelNum)) {
+			this->recordRequested = true;
+		}
 	}
 }
 
 void SourceManager::writeMIDIData(uint64_t ref, const juce::MidiBuffer& buffer, int offset, int trackIndex) {
 	if (auto ptr = this->getSourceFast(ref, SourceType::MIDI)) {
-		ptr->writeMIDIData(buffer, offset, trackIndex);
+		if (!ptr->writeMIDIData(buffer, offset, trackIndex)) {
+			this->recordRequested = true;
+		}
 	}
 }
 
+double SourceManager::getLengthFast(uint64_t ref, SourceType type) const {
+	if (auto ptr = this->getSourceFast(ref, type)) {
+		switch (type) {
+		case SourceManager::SourceType::MIDI:
+			return ptr->getMIDILength();
+		case SourceManager::SourceType::Audio:
+			return ptr->getAudioLength();
+		default:
+			break;
+		}
+	}
+	return 0;
+}
+
 int SourceManager::getMIDINoteNum(uint64_t ref, int track) const {
 	if (auto ptr = this->getSourceFast(ref, SourceType::MIDI)) {
 		return ptr->getMIDINoteNum(track);
@@ -371,6 +473,33 @@ const juce::Array<SourceMIDITemp::Note> SourceManager::getMIDINoteList(uint64_t
 	return {};
 }
 
+const juce::Array<SourceMIDITemp::Note> SourceManager::getMIDINoteListInArea(uint64_t ref, int track,
+	double startSec, double endSec, uint8_t minPitch, uint8_t maxPitch) const {
+	juce::ScopedReadLock locker(audioLock::getSourceLock());
+	if (auto ptr = this->getSourceFast(ref, SourceType::MIDI)) {
+		std::vector<int> indexList;
+		ptr->findMIDINotes(track, startSec, endSec, minPitch, maxPitch, indexList);
+
+		juce::Array<SourceMIDITemp::Note> list;
+		list.ensureStorageAllocated((int)indexList.size());
+
+		for (auto i : indexList) {
+			list.add(ptr->getMIDINote(track, i));
+		}
+
+		return list;
+	}
+	return {};
+}
+
+const std::tuple<uint8_t, uint8_t> SourceManager::getMIDINotePitchRange(uint64_t ref, int track) const {
+	juce::ScopedReadLock locker(audioLock::getSourceLock());
+	if (auto ptr = this->getSourceFast(ref, SourceType::MIDI)) {
+		return ptr->getMIDINotePitchRange(track);
+	}
+	return { 0, 0 };
+}
+
 const juce::Array<SourceMIDITemp::IntParam> SourceManager::getMIDIPitchWheelList(uint64_t ref, int track) const {
 	juce::ScopedReadLock locker(audioLock::getSourceLock());
 	if (auto ptr = this->getSourceFast(ref, SourceType::MIDI)) {
@@ -452,7 +581,7 @@ const juce::Array<SourceMIDITemp::Misc> SourceManager::getMIDIMiscList(uint64_t
 }
 
 void SourceManager::sampleRateChanged(double sampleRate, int blockSize) {
-	juce::ScopedWriteLock locker(audioLock::getSourceLock());
+	audioLock::ScopedAudioWriteLock locker(audioLock::getSourceLock());
 	
 	this->sampleRate = sampleRate;
 	this->blockSize = blockSize;
@@ -460,6 +589,7 @@ void SourceManager::sampleRateChanged(double sampleRate, int blockSize) {
 	for (auto it = this->sources.begin(); it != this->sources.end(); it++) {
 		auto srcPtr = it->second.get();
 		srcPtr->setSampleRate(blockSize, sampleRate);
+		this->requestConvert(it->first);
 	}
 }
 
@@ -490,6 +620,26 @@ SourceItem* SourceManager::getSourceFast(uint64_t ref, SourceType type) const {
 	return nullptr;
 }
 
+void SourceManager::requestConvert(uint64_t ref) {
+	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
+		ptr->requestConvert(
+			[ref](uint64_t version, SourceConvertCache::Result data) {
+				SourceManager::getInstance()->setConvertedData(ref, version, data);
+			}
+		);
+	}
+}
+
+void SourceManager::requestPeak(uint64_t ref) const {
+	if (auto ptr = this->getSource(ref, SourceType::Audio)) {
+		ptr->requestPeak(
+			[ref](uint64_t version, SourcePeakCache::Result data) {
+				SourceManager::getInstance()->setPeakData(ref, version, data);
+			}
+		);
+	}
+}
+
 SourceManager* SourceManager::getInstance() {
 	return SourceManager::instance ? SourceManager::instance 
 		: (SourceManager::instance = new SourceManager{});
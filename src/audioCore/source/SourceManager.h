@@ -26,6 +26,13 @@ public:
 	void setMIDI(uint64_t ref, const juce::MidiFile& data, const juce::String& name);
 	void setAudio(uint64_t ref, const juce::String& name);
 	void setMIDI(uint64_t ref, const juce::String& name);
+	/**
+	 * @brief	Play the source from a file stream.
+	 * @param preview	The stream is only played until the decoded data replaces it,
+	 *					so no converted copy or peaks are built for it.
+	 */
+	void setAudioStream(uint64_t ref, const juce::File& file,
+		std::shared_ptr<juce::AudioFormatReader> reader, const juce::String& name, bool preview);
 	const std::tuple<double, juce::AudioSampleBuffer> getAudio(uint64_t ref) const;
 	const juce::MidiMessageSequence makeMIDITrack(uint64_t ref, int trackIndex) const;
 	const juce::MidiFile makeMIDIFile(uint64_t ref) const;
@@ -34,6 +41,10 @@ public:
 	void prepareMIDIPlay(uint64_t ref);
 	void prepareAudioRecord(uint64_t ref, int channelNum);
 	void prepareMIDIRecord(uint64_t ref);
+	/**
+	 * @brief	Prepare sources the audio thread couldn't record into. Never call this on the audio thread.
+	 */
+	void prepareRequestedRecord();
 
 	using ChangedCallback = SourceItem::ChangedCallback;
 	void setCallback(uint64_t ref, SourceType type,
@@ -43,15 +54,31 @@ public:
 	void setAudioFormat(uint64_t ref, const AudioFormat& format);
 	const AudioFormat getAudioFormat(uint64_t ref) const;
 	double getAudioSampleRate(uint64_t ref) const;
+	const juce::File getAudioStreamFile(uint64_t ref) const;
+	/**
+	 * @brief	Keep the audio data alive for reading at its own sample rate without the source lock.
+	 */
+	std::shared_ptr<const SourceInternalContainer> getAudioContainer(uint64_t ref) const;
+	void setConvertedData(uint64_t ref, uint64_t version, SourceConvertCache::Result data);
+	void setPeakData(uint64_t ref, uint64_t version, SourcePeakCache::Result data);
+	const std::tuple<bool, SourcePeakPyramid::Result> getAudioPeak(
+		uint64_t ref, double startSec, double endSec, int pointNum) const;
 
 public:
-	void readAudioData(uint64_t ref, juce::AudioBuffer<float>& buffer, int bufferOffset,
+	void readAudioData(uint64_t ref, SourceResampler& resampler,
+		juce::AudioBuffer<float>& buffer, int bufferOffset,
 		int dataOffset, int length) const;
-	void readMIDIData(uint64_t ref, juce::MidiBuffer& buffer, double baseTime,
+	void readMIDIData(uint64_t ref, SourceMIDITemp::Cursor& cursor,
+		juce::MidiBuffer& buffer, double baseTime,
 		double startTime, double endTime, int trackIndex) const;
 	void writeAudioData(uint64_t ref, juce::AudioBuffer<float>& buffer, int offset,
 		int trackChannelNum);
 	void writeMIDIData(uint64_t ref, const juce::MidiBuffer& buffer, int offset, int trackIndex);
+	/**
+	 * @brief	Same as getLength() without taking the source lock.
+	 *			For the audio thread and its workers, which never block on a lock.
+	 */
+	double getLengthFast(uint64_t ref, SourceType type) const;
 
 public:
 	int getMIDINoteNum(uint64_t ref, int track) const;
@@ -76,6 +103,10 @@ public:
 	const juce::Array<SourceMIDITemp::Controller> getMIDIControllerList(uint64_t ref, int track, uint8_t number) const;
 	const juce::Array<SourceMIDITemp::Misc> getMIDIMiscList(uint64_t ref, int track) const;
 
+	const juce::Array<SourceMIDITemp::Note> getMIDINoteListInArea(uint64_t ref, int track,
+		double startSec, double endSec, uint8_t minPitch, uint8_t maxPitch) const;
+	const std::tuple<uint8_t, uint8_t> getMIDINotePitchRange(uint64_t ref, int track) const;
+
 public:
 	void sampleRateChanged(double sampleRate, int blockSize);
 
@@ -85,9 +116,15 @@ private:
 	double sampleRate = 0;
 	int blockSize = 0;
 
+	/** Set by the audio thread when a source needs prepareRequestedRecord() */
+	std::atomic_bool recordRequested = false;
+
 	SourceItem* getSource(uint64_t ref, SourceType type) const;
 	SourceItem* getSourceFast(uint64_t ref, SourceType type) const;
 
+	void requestConvert(uint64_t ref);
+	void requestPeak(uint64_t ref) const;
+
 public:
 	static SourceManager* getInstance();
 	static void releaseInstance();
@@ -0,0 +1,142 @@
+﻿#include "SourcePeakCache.h"
+#include "SourceInternalPool.h"
+#include "../AudioConfig.h"
+#include "../Utils.h"
+
+SourcePeakCache::SourcePeakCache()
+	: Thread("Source Peak") {}
+
+SourcePeakCache::~SourcePeakCache() {
+	this->stopThread(30000);
+}
+
+void SourcePeakCache::addTask(const Task& task) {
+	if (!task.data) { return; }
+
+	juce::GenericScopedLock locker(this->lock);
+	this->list.push(task);
+	this->startThread();
+}
+
+uint64_t SourcePeakCache::getBuiltNum() const {
+	return this->builtNum;
+}
+
+uint64_t SourcePeakCache::getCacheHitNum() const {
+	return this->cacheHitNum;
+}
+
+void SourcePeakCache::run() {
+	while (!this->threadShouldExit()) {
+		/** Get Next Task */
+		Task task;
+		{
+			juce::GenericScopedLock locker(this->lock);
+
+			/** Check Empty */
+			if (this->list.empty()) { break; }
+
+			/** Dequeue Task */
+			task = this->list.front();
+			this->list.pop();
+		}
+
+		/** Skip Source Which Is Only Kept By Pool And This Task */
+		Result result = nullptr;
+		if (task.data.use_count() > 2) {
+			result = this->build(*(task.data));
+		}
+
+		/** Release Source */
+		auto name = task.data->getName();
+		task.data = nullptr;
+		SourceInternalPool::getInstance()->checkSourceReleased(name);
+
+		/** Callback */
+		if (!result || this->threadShouldExit()) { continue; }
+		juce::MessageManager::callAsync(
+			[callback = task.callback, version = task.version, result] {
+				if (callback) { callback(version, result); }
+			}
+		);
+	}
+}
+
+SourcePeakCache::Result SourcePeakCache::build(const SourceInternalContainer& data) {
+	/** Check Data */
+	int channels = data.getAudioChannelNum();
+	double sampleRate = data.getAudioSampleRate();
+	if (!data.hasAudio() || channels <= 0 || sampleRate <= 0) { return nullptr; }
+
+	auto result = std::make_shared<SourcePeakPyramid>(channels, sampleRate);
+	auto shouldExit = [this] { return this->threadShouldExit(); };
+
+	/** Memory Data Is Summarized Directly, Read Chunk By Chunk While Recording May Grow It */
+	if (!data.isAudioStreamed()) {
+		if (!result->build(data, data.getAudioSampleNum(), shouldExit)) { return nullptr; }
+
+		this->builtNum++;
+		return result;
+	}
+
+	/** Streamed Data Is Read With Own Reader */
+	auto file = data.getAudioStreamFile();
+	auto reader = utils::createAudioReader(file);
+	if (!reader) { return nullptr; }
+	int64_t length = reader->lengthInSamples;
+	result->setReader(std::move(reader));
+
+	/** Use Existing Sidecar */
+	auto sidecar = SourcePeakCache::getSidecarFile(file);
+	if (sidecar.existsAsFile()) {
+		if (result->load(sidecar, length)) {
+			this->cacheHitNum++;
+			return result;
+		}
+		sidecar.deleteFile();
+	}
+
+	/** Build And Keep Sidecar */
+	if (!result->build(data, length, shouldExit)) { return nullptr; }
+	if (sidecar != juce::File{}) {
+		result->save(sidecar);
+	}
+
+	this->builtNum++;
+	return result;
+}
+
+const juce::File SourcePeakCache::getSidecarFile(const juce::File& source) {
+	/** Cache Dir */
+	auto dirPath = AudioConfig::getSourceCachePath();
+	if (dirPath.isEmpty()) { return {}; }
+	juce::File dir{ dirPath };
+	if (!dir.isDirectory() && !dir.createDirectory()) { return {}; }
+
+	/** Keyed By File Identity, The File Is Too Large To Hash Before Every Load */
+	juce::MemoryOutputStream identity;
+	identity.writeString(source.getFullPathName());
+	identity.writeInt64(source.getSize());
+	identity.writeInt64(source.getLastModificationTime().toMilliseconds());
+	auto key = juce::MD5{ identity.getMemoryBlock() }.toHexString();
+
+	return dir.getChildFile(key + ".peak");
+}
+
+SourcePeakCache* SourcePeakCache::getInstance() {
+	return SourcePeakCache::instance ? SourcePeakCache::instance
+		: (SourcePeakCache::instance = new SourcePeakCache{});
+}
+
+SourcePeakCache* SourcePeakCache::getInstanceWithoutCreate() {
+	return SourcePeakCache::instance;
+}
+
+void SourcePeakCache::releaseInstance() {
+	if (SourcePeakCache::instance) {
+		delete SourcePeakCache::instance;
+		SourcePeakCache::instance = nullptr;
+	}
+}
+
+SourcePeakCache* SourcePeakCache::instance = nullptr;
@@ -0,0 +1,52 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "SourceInternalContainer.h"
+#include "SourcePeakPyramid.h"
+
+/**
+ * @brief	Builds waveform peak pyramids of audio sources in the background.
+ *			Pyramids of streamed sources are kept in sidecar files, so long files are scanned only once.
+ */
+class SourcePeakCache final : public juce::Thread,
+	private juce::DeletedAtShutdown {
+public:
+	SourcePeakCache();
+	~SourcePeakCache() override;
+
+	using Result = std::shared_ptr<SourcePeakPyramid>;
+	/** Version, Result */
+	using Callback = std::function<void(uint64_t, Result)>;
+	struct Task final {
+		std::shared_ptr<const SourceInternalContainer> data;
+		uint64_t version = 0;
+		Callback callback;
+	};
+	void addTask(const Task& task);
+
+	uint64_t getBuiltNum() const;
+	uint64_t getCacheHitNum() const;
+
+protected:
+	void run() override;
+
+private:
+	juce::CriticalSection lock;
+	std::queue<Task> list;
+
+	std::atomic<uint64_t> builtNum = 0, cacheHitNum = 0;
+
+	Result build(const SourceInternalContainer& data);
+
+	static const juce::File getSidecarFile(const juce::File& source);
+
+public:
+	static SourcePeakCache* getInstance();
+	static SourcePeakCache* getInstanceWithoutCreate();
+	static void releaseInstance();
+
+private:
+	static SourcePeakCache* instance;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourcePeakCache)
+};
@@ -0,0 +1,334 @@
+﻿#include "SourcePeakPyramid.h"
+
+#define PEAK_FILE_MAGIC 0x4B505356
+#define PEAK_FILE_VERSION 1
+
+SourcePeakPyramid::SourcePeakPyramid(int channels, double sampleRate)
+	: channels(channels), sampleRate(sampleRate) {}
+
+void SourcePeakPyramid::setReader(std::unique_ptr<juce::AudioFormatReader> reader) {
+	juce::GenericScopedLock locker(this->lock);
+	this->reader = std::move(reader);
+}
+
+bool SourcePeakPyramid::build(const SourceInternalContainer& data,
+	int64_t length, const ExitFunc& shouldExit) {
+	juce::GenericScopedLock locker(this->lock);
+	if (this->channels <= 0 || length < 0) { return false; }
+
+	/** Prepare Levels */
+	this->resize(length);
+
+	/** Summarize Each Chunk */
+	juce::AudioSampleBuffer buffer(this->channels, SourcePeakPyramid::chunkSize);
+	for (int64_t pos = 0; pos < length; pos += SourcePeakPyramid::chunkSize) {
+		if (shouldExit && shouldExit()) { return false; }
+
+		int num = (int)std::min((int64_t)SourcePeakPyramid::chunkSize, length - pos);
+		this->read(data, buffer, pos, num);
+		this->summarize(buffer, pos / SourcePeakPyramid::baseSize, num);
+	}
+
+	/** Build Upper Levels */
+	this->mergeLevels(0, this->levels[0][0].size());
+
+	return true;
+}
+
+void SourcePeakPyramid::update(const SourceInternalContainer& data,
+	int64_t startSample, int64_t endSample) {
+	juce::GenericScopedLock locker(this->lock);
+	if (this->channels <= 0) { return; }
+
+	/** Grow With Data */
+	int64_t dataLength = data.getAudioSampleNum();
+	if (dataLength > this->length) {
+		this->resize(dataLength);
+	}
+
+	/** Blocks To Update */
+	startSample = std::max(startSample, (int64_t)0);
+	endSample = std::min(endSample, this->length);
+	if (endSample <= startSample) { return; }
+	int64_t startBlock = startSample / SourcePeakPyramid::baseSize;
+	int64_t endBlock = (endSample + SourcePeakPyramid::baseSize - 1) / SourcePeakPyramid::baseSize;
+
+	/** Summarize Each Chunk */
+	constexpr int chunkBlocks = SourcePeakPyramid::chunkSize / SourcePeakPyramid::baseSize;
+	juce::AudioSampleBuffer buffer(this->channels, SourcePeakPyramid::chunkSize);
+	for (int64_t block = startBlock; block < endBlock; block += chunkBlocks) {
+		int64_t pos = block * SourcePeakPyramid::baseSize;
+		int64_t end = std::min(endBlock * SourcePeakPyramid::baseSize, this->length);
+		int num = (int)std::min((int64_t)SourcePeakPyramid::chunkSize, end - pos);
+		this->read(data, buffer, pos, num);
+		this->summarize(buffer, block, num);
+	}
+
+	/** Update Upper Levels */
+	this->mergeLevels(startBlock, endBlock);
+}
+
+const SourcePeakPyramid::Result SourcePeakPyramid::getPeaks(const SourceInternalContainer& data,
+	double startSec, double endSec, int pointNum) const {
+	Result result;
+	if (pointNum <= 0 || endSec <= startSec) { return result; }
+
+	juce::GenericScopedLock locker(this->lock);
+	if (this->channels <= 0 || this->levels.empty()) { return result; }
+
+	/** Prepare Result */
+	std::vector<float*> resultPtrs;
+	for (int i = 0; i < this->channels; i++) {
+		result.add(juce::MemoryBlock{ (size_t)pointNum * 3 * sizeof(float), true });
+		resultPtrs.push_back(static_cast<float*>(result.getReference(i).getData()));
+	}
+
+	/** Point Size */
+	double startSample = startSec * this->sampleRate;
+	double samplesPerPoint = (endSec - startSec) * this->sampleRate / pointNum;
+
+	/** Read Samples When Zoomed In Closer Than Level 0 */
+	if (samplesPerPoint < SourcePeakPyramid::baseSize) {
+		int64_t readStart = std::max((int64_t)std::floor(startSample), (int64_t)0);
+		int64_t readEnd = std::min((int64_t)std::ceil(startSample + samplesPerPoint * pointNum) + 1, this->length);
+		if (readEnd <= readStart) { return result; }
+
+		int readLength = (int)(readEnd - readStart);
+		juce::AudioSampleBuffer buffer(this->channels, readLength);
+		this->read(data, buffer, readStart, readLength);
+
+		for (int i = 0; i < pointNum; i++) {
+			int64_t start = (int64_t)std::floor(startSample + i * samplesPerPoint) - readStart;
+			int64_t end = std::max(start + 1, (int64_t)std::floor(startSample + (i + 1) * samplesPerPoint) - readStart);
+			start = std::max(start, (int64_t)0);
+			end = std::min(end, (int64_t)readLength);
+			if (end <= start) { continue; }
+
+			for (int j = 0; j < this->channels; j++) {
+				auto ptr = buffer.getReadPointer(j);
+				float minValue = ptr[start], maxValue = ptr[start], sumSquare = 0;
+				for (int64_t k = start; k < end; k++) {
+					minValue = std::min(minValue, ptr[k]);
+					maxValue = std::max(maxValue, ptr[k]);
+					sumSquare += ptr[k] * ptr[k];
+				}
+
+				resultPtrs[j][i * 3 + 0] = minValue;
+				resultPtrs[j][i * 3 + 1] = maxValue;
+				resultPtrs[j][i * 3 + 2] = std::sqrt(sumSquare / (end - start));
+			}
+		}
+
+		return result;
+	}
+
+	/** Find The Coarsest Level Finer Than A Point */
+	int level = 0;
+	while (level + 1 < this->levels.size()
+		&& SourcePeakPyramid::getBlockSize(level + 1) <= samplesPerPoint) {
+		level++;
+	}
+	int64_t blockSize = SourcePeakPyramid::getBlockSize(level);
+	auto& levelData = this->levels[level];
+	int64_t blockNum = levelData[0].size();
+
+	/** Merge Blocks Of Each Point */
+	for (int i = 0; i < pointNum; i++) {
+		int64_t start = (int64_t)std::floor(startSample + i * samplesPerPoint);
+		int64_t end = (int64_t)std::floor(startSample + (i + 1) * samplesPerPoint);
+		if (end <= 0 || start >= this->length) { continue; }
+
+		int64_t startBlock = std::max(start, (int64_t)0) / blockSize;
+		int64_t endBlock = std::min((end + blockSize - 1) / blockSize, blockNum);
+		if (endBlock <= startBlock) { continue; }
+
+		for (int j = 0; j < this->channels; j++) {
+			auto peak = SourcePeakPyramid::mergePeaks(
+				&(levelData[j][startBlock]), endBlock - startBlock);
+
+			resultPtrs[j][i * 3 + 0] = peak.minValue;
+			resultPtrs[j][i * 3 + 1] = peak.maxValue;
+			resultPtrs[j][i * 3 + 2] = std::sqrt(peak.sumSquare / ((endBlock - startBlock) * blockSize));
+		}
+	}
+
+	return result;
+}
+
+bool SourcePeakPyramid::save(const juce::File& file) const {
+	juce::GenericScopedLock locker(this->lock);
+	if (this->levels.empty()) { return false; }
+
+	/** Write To Temp File */
+	juce::File tempFile = file.getSiblingFile(file.getFileName() + ".tmp");
+	{
+		juce::FileOutputStream stream(tempFile);
+		if (!stream.openedOk()) { return false; }
+		stream.setPosition(0);
+		stream.truncate();
+
+		stream.writeInt(PEAK_FILE_MAGIC);
+		stream.writeInt(PEAK_FILE_VERSION);
+		stream.writeInt(this->channels);
+		stream.writeDouble(this->sampleRate);
+		stream.writeInt64(this->length);
+		for (auto& channel : this->levels[0]) {
+			stream.write(channel.data(), channel.size() * sizeof(Peak));
+		}
+
+		stream.flush();
+		if (stream.getStatus().failed()) {
+			tempFile.deleteFile();
+			return false;
+		}
+	}
+
+	/** Replace File Atomically */
+	if (!tempFile.moveFileTo(file)) {
+		tempFile.deleteFile();
+		return false;
+	}
+	return true;
+}
+
+bool SourcePeakPyramid::load(const juce::File& file, int64_t length) {
+	juce::FileInputStream stream(file);
+	if (!stream.openedOk()) { return false; }
+
+	/** Check Header */
+	if (stream.readInt() != PEAK_FILE_MAGIC) { return false; }
+	if (stream.readInt() != PEAK_FILE_VERSION) { return false; }
+	if (stream.readInt() != this->channels) { return false; }
+	if (stream.readDouble() != this->sampleRate) { return false; }
+	if (stream.readInt64() != length) { return false; }
+
+	/** Read Level 0 */
+	juce::GenericScopedLock locker(this->lock);
+	this->levels.clear();
+	this->resize(length);
+	for (auto& channel : this->levels[0]) {
+		int64_t size = channel.size() * sizeof(Peak);
+		if (stream.read(channel.data(), (int)size) != size) {
+			this->levels.clear();
+			this->length = 0;
+			return false;
+		}
+	}
+
+	/** Build Upper Levels */
+	this->mergeLevels(0, this->levels[0][0].size());
+
+	return true;
+}
+
+int SourcePeakPyramid::getChannelNum() const {
+	return this->channels;
+}
+
+double SourcePeakPyramid::getSampleRate() const {
+	return this->sampleRate;
+}
+
+int64_t SourcePeakPyramid::getLength() const {
+	juce::GenericScopedLock locker(this->lock);
+	return this->length;
+}
+
+void SourcePeakPyramid::resize(int64_t length) {
+	this->length = length;
+
+	/** Level Num */
+	int64_t blockNum = (length + SourcePeakPyramid::baseSize - 1) / SourcePeakPyramid::baseSize;
+	int levelNum = 1;
+	for (int64_t num = blockNum; num > 1; num = (num + SourcePeakPyramid::levelRatio - 1) / SourcePeakPyramid::levelRatio) {
+		levelNum++;
+	}
+
+	/** Resize Each Level */
+	this->levels.resize(levelNum);
+	for (auto& level : this->levels) {
+		level.resize(this->channels);
+		for (auto& channel : level) {
+			channel.resize(blockNum);
+		}
+		blockNum = (blockNum + SourcePeakPyramid::levelRatio - 1) / SourcePeakPyramid::levelRatio;
+	}
+}
+
+void SourcePeakPyramid::read(const SourceInternalContainer& data,
+	juce::AudioSampleBuffer& buffer, int64_t startSample, int length) const {
+	/** Streamed Data Is Read With Own Reader */
+	if (data.isAudioStreamed() && this->reader) {
+		buffer.clear(0, length);
+		this->reader->read(&buffer, 0, length, startSample, true, true);
+		return;
+	}
+
+	data.readAudio(buffer, 0, startSample, length);
+}
+
+void SourcePeakPyramid::summarize(const juce::AudioSampleBuffer& buffer,
+	int64_t startBlock, int length) {
+	auto& level = this->levels[0];
+	int64_t blockNum = level[0].size();
+
+	for (int i = 0; i < this->channels; i++) {
+		auto ptr = buffer.getReadPointer(i);
+		auto& channel = level[i];
+
+		for (int start = 0, block = 0; start < length && startBlock + block < blockNum;
+			start += SourcePeakPyramid::baseSize, block++) {
+			int end = std::min(start + SourcePeakPyramid::baseSize, length);
+
+			Peak peak{ ptr[start], ptr[start], 0 };
+			for (int j = start; j < end; j++) {
+				peak.minValue = std::min(peak.minValue, ptr[j]);
+				peak.maxValue = std::max(peak.maxValue, ptr[j]);
+				peak.sumSquare += ptr[j] * ptr[j];
+			}
+			channel[startBlock + block] = peak;
+		}
+	}
+}
+
+void SourcePeakPyramid::mergeLevels(int64_t startBlock, int64_t endBlock) {
+	for (int i = 1; i < this->levels.size(); i++) {
+		/** Blocks Of This Level */
+		startBlock = startBlock / SourcePeakPyramid::levelRatio;
+		endBlock = (endBlock + SourcePeakPyramid::levelRatio - 1) / SourcePeakPyramid::levelRatio;
+
+		auto& lowerLevel = this->levels[i - 1];
+		auto& level = this->levels[i];
+		int64_t lowerNum = lowerLevel[0].size();
+		endBlock = std::min(endBlock, (int64_t)level[0].size());
+
+		/** Merge Lower Blocks */
+		for (int j = 0; j < this->channels; j++) {
+			for (int64_t k = startBlock; k < endBlock; k++) {
+				int64_t lowerStart = k * SourcePeakPyramid::levelRatio;
+				int64_t num = std::min((int64_t)SourcePeakPyramid::levelRatio, lowerNum - lowerStart);
+				level[j][k] = SourcePeakPyramid::mergePeaks(&(lowerLevel[j][lowerStart]), num);
+			}
+		}
+	}
+}
+
+const SourcePeakPyramid::Peak SourcePeakPyramid::mergePeaks(const Peak* peaks, int64_t num) {
+	if (num <= 0) { return {}; }
+
+	Peak result = peaks[0];
+	for (int64_t i = 1; i < num; i++) {
+		result.minValue = std::min(result.minValue, peaks[i].minValue);
+		result.maxValue = std::max(result.maxValue, peaks[i].maxValue);
+		result.sumSquare += peaks[i].sumSquare;
+	}
+	return result;
+}
+
+int64_t SourcePeakPyramid::getBlockSize(int level) {
+	int64_t result = SourcePeakPyramid::baseSize;
+	for (int i = 0; i < level; i++) {
+		result *= SourcePeakPyramid::levelRatio;
+	}
+	return result;
+}
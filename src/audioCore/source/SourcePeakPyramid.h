@@ -0,0 +1,76 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "SourceInternalContainer.h"
+
+/**
+ * @brief	Multi-resolution min/max/RMS summary of an audio source for waveform drawing.
+ *			Level 0 summarizes blocks of baseSize samples and each level above merges
+ *			levelRatio blocks of the level below, so any zoom is answered with a few entries per point.
+ */
+class SourcePeakPyramid final {
+public:
+	SourcePeakPyramid() = delete;
+	SourcePeakPyramid(int channels, double sampleRate);
+
+	static constexpr int baseSize = 256;
+	static constexpr int levelRatio = 4;
+
+	struct Peak final {
+		float minValue = 0, maxValue = 0, sumSquare = 0;
+	};
+
+	/**
+	 * @brief	Use an own reader for streamed sources, so reading never waits for the playback cache.
+	 */
+	void setReader(std::unique_ptr<juce::AudioFormatReader> reader);
+
+	using ExitFunc = std::function<bool(void)>;
+	bool build(const SourceInternalContainer& data,
+		int64_t length, const ExitFunc& shouldExit);
+	/**
+	 * @brief	Summarize [startSample, endSample) again after it was written and grow to the data length.
+	 */
+	void update(const SourceInternalContainer& data,
+		int64_t startSample, int64_t endSample);
+
+	/** Min, max and RMS of each point, for each channel */
+	using Result = juce::Array<juce::MemoryBlock>;
+	/**
+	 * @brief	Split [startSec, endSec) into pointNum equal parts and summarize each part.
+	 */
+	const Result getPeaks(const SourceInternalContainer& data,
+		double startSec, double endSec, int pointNum) const;
+
+	bool save(const juce::File& file) const;
+	bool load(const juce::File& file, int64_t length);
+
+	int getChannelNum() const;
+	double getSampleRate() const;
+	int64_t getLength() const;
+
+private:
+	const int channels;
+	const double sampleRate;
+	int64_t length = 0;
+
+	/** Level, Channel, Block */
+	std::vector<std::vector<std::vector<Peak>>> levels;
+
+	std::unique_ptr<juce::AudioFormatReader> reader = nullptr;
+	juce::CriticalSection lock;
+
+	static constexpr int chunkSize = 65536;
+
+	void resize(int64_t length);
+	void read(const SourceInternalContainer& data, juce::AudioSampleBuffer& buffer,
+		int64_t startSample, int length) const;
+	void summarize(const juce::AudioSampleBuffer& buffer,
+		int64_t startBlock, int length);
+	void mergeLevels(int64_t startBlock, int64_t endBlock);
+
+	static const Peak mergePeaks(const Peak* peaks, int64_t num);
+	static int64_t getBlockSize(int level);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourcePeakPyramid)
+};
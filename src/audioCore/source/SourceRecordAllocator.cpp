@@ -0,0 +1,70 @@
+﻿#include "SourceRecordAllocator.h"
+#include "SourceManager.h"
+
+SourceRecordAllocator::SourceRecordAllocator()
+	: Thread("Source Record Allocator") {}
+
+SourceRecordAllocator::~SourceRecordAllocator() {
+	this->stopThread(30000);
+}
+
+void SourceRecordAllocator::add(std::shared_ptr<SourceInternalContainer> data) {
+	if (!data) { return; }
+
+	juce::GenericScopedLock locker(this->lock);
+	for (auto& i : this->list) {
+		if (i.lock() == data) { return; }
+	}
+	this->list.push_back(data);
+	this->startThread();
+	this->notify();
+}
+
+void SourceRecordAllocator::run() {
+	while (!this->threadShouldExit()) {
+		/** Get Alive Sources */
+		std::vector<std::shared_ptr<SourceInternalContainer>> sources;
+		{
+			juce::GenericScopedLock locker(this->lock);
+
+			std::erase_if(this->list,
+				[](const auto& item) { return item.expired(); });
+
+			for (auto& i : this->list) {
+				if (auto ptr = i.lock()) {
+					sources.push_back(ptr);
+				}
+			}
+		}
+
+		/** Grow Each Source */
+		for (auto& i : sources) {
+			i->growForRecord();
+		}
+		sources.clear();
+
+		/** Sources Requested By The Audio Thread */
+		SourceManager::getInstance()->prepareRequestedRecord();
+
+		/** The Audio Thread Can't Wake Us, So Keep Checking */
+		this->wait(SourceRecordAllocator::checkIntervalMs);
+	}
+}
+
+SourceRecordAllocator* SourceRecordAllocator::getInstance() {
+	return SourceRecordAllocator::instance ? SourceRecordAllocator::instance
+		: (SourceRecordAllocator::instance = new SourceRecordAllocator{});
+}
+
+SourceRecordAllocator* SourceRecordAllocator::getInstanceWithoutCreate() {
+	return SourceRecordAllocator::instance;
+}
+
+void SourceRecordAllocator::releaseInstance() {
+	if (SourceRecordAllocator::instance) {
+		delete SourceRecordAllocator::instance;
+		SourceRecordAllocator::instance = nullptr;
+	}
+}
+
+SourceRecordAllocator* SourceRecordAllocator::instance = nullptr;
@@ -0,0 +1,41 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "SourceInternalContainer.h"
+
+/**
+ * @brief	Grows the memory of audio sources being recorded in the background,
+ *			prepares sources the audio thread couldn't record into
+ *			and adds the MIDI it recorded, so the audio thread never allocates while recording.
+ */
+class SourceRecordAllocator final : public juce::Thread,
+	private juce::DeletedAtShutdown {
+public:
+	SourceRecordAllocator();
+	~SourceRecordAllocator() override;
+
+	/**
+	 * @brief	Keep growing the source while it is alive.
+	 */
+	void add(std::shared_ptr<SourceInternalContainer> data);
+
+protected:
+	void run() override;
+
+private:
+	juce::CriticalSection lock;
+	std::vector<std::weak_ptr<SourceInternalContainer>> list;
+
+	/** Sources are grown well before their end, so a late check never drops samples */
+	static constexpr int checkIntervalMs = 50;
+
+public:
+	static SourceRecordAllocator* getInstance();
+	static SourceRecordAllocator* getInstanceWithoutCreate();
+	static void releaseInstance();
+
+private:
+	static SourceRecordAllocator* instance;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourceRecordAllocator)
+};
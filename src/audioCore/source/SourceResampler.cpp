@@ -0,0 +1,260 @@
+﻿#include "SourceResampler.h"
+#include "SourceInternalContainer.h"
+#include "../misc/VMath.h"
+#include "../Utils.h"
+
+SourceResampler::KernelPtr SourceResampler::createKernel(double ratio, Quality quality) {
+	auto kernel = std::make_shared<Kernel>();
+	kernel->ratio = ratio;
+	kernel->quality = quality;
+
+	/** Kernel Size */
+	int baseHalfTaps = 1;
+	switch (quality) {
+	case Quality::WindowedSinc:
+		baseHalfTaps = 16;
+		kernel->phaseNum = 512;
+		break;
+	case Quality::Polyphase:
+		baseHalfTaps = 8;
+		kernel->phaseNum = 256;
+		break;
+	case Quality::Offline:
+		baseHalfTaps = 48;
+		kernel->phaseNum = 1024;
+		break;
+	default:
+		return kernel;
+	}
+
+	/** Lower Cutoff And Widen Kernel When Downsampling */
+	double cutoff = std::min(1.0, 1.0 / ratio);
+	kernel->halfTaps = std::min((int)std::ceil(baseHalfTaps / cutoff), SourceResampler::maxHalfTaps);
+	int halfTaps = kernel->halfTaps;
+	int taps = halfTaps * 2;
+
+	/** Blackman Windowed Sinc, Taps Stored In Input Order */
+	kernel->table.resize((size_t)(kernel->phaseNum + 1) * taps);
+	for (int p = 0; p <= kernel->phaseNum; p++) {
+		double frac = p / (double)kernel->phaseNum;
+		auto row = &(kernel->table[(size_t)p * taps]);
+
+		double sum = 0;
+		for (int k = 0; k < taps; k++) {
+			double t = frac + halfTaps - 1 - k;
+			double x = t * cutoff * juce::MathConstants<double>::pi;
+			double sinc = (std::abs(x) < 1e-9) ? 1.0 : (std::sin(x) / x);
+
+			double u = t / halfTaps;
+			double window = (std::abs(u) >= 1) ? 0.0
+				: (0.42 + 0.5 * std::cos(juce::MathConstants<double>::pi * u)
+					+ 0.08 * std::cos(2 * juce::MathConstants<double>::pi * u));
+
+			row[k] = (float)(sinc * window);
+			sum += row[k];
+		}
+
+		/** Unity DC Gain */
+		if (sum != 0) {
+			for (int k = 0; k < taps; k++) {
+				row[k] = (float)(row[k] / sum);
+			}
+		}
+	}
+
+	return kernel;
+}
+
+void SourceResampler::prepare(int channels, int blockSize) {
+	this->channels = channels;
+	this->maxChunk = std::max(blockSize, 256);
+
+	/** Input Window Covers One Chunk And The Longest Filter, Chunks Shrink When Downsampling */
+	int inputSize = this->maxChunk + SourceResampler::maxHalfTaps * 2 + 2;
+	this->inputBuffer.setSize(channels, inputSize, false, false, true);
+
+	this->reset();
+}
+
+bool SourceResampler::isPreparedFor(int channels) const {
+	return this->maxChunk > 0 && this->channels == channels;
+}
+
+void SourceResampler::reset() {
+	this->inputStart = 0;
+	this->inputLength = 0;
+	this->nextOutputPos = -1;
+}
+
+void SourceResampler::read(const SourceInternalContainer& data,
+	const Kernel& kernel, uint64_t dataVersion,
+	juce::AudioBuffer<float>& buffer, int bufferOffset,
+	int64_t dataOffset, int length) {
+	/** Check State */
+	if (this->maxChunk <= 0 || this->channels <= 0) { return; }
+	length = std::min(length, buffer.getNumSamples() - bufferOffset);
+	if (length <= 0) { return; }
+
+	/** Drop Input Window When Source Changed */
+	if (dataVersion != this->dataVersion) {
+		this->dataVersion = dataVersion;
+		this->reset();
+	}
+
+	/** Same Sample Rate */
+	if (kernel.ratio == 1) {
+		this->readData(data, buffer, bufferOffset, dataOffset, length);
+		this->nextOutputPos = dataOffset + length;
+		return;
+	}
+
+	/** Reseek Only When Position Jumped */
+	if (dataOffset != this->nextOutputPos) {
+		this->inputLength = 0;
+		this->nextOutputPos = dataOffset;
+	}
+
+	/** Chunk Size Fits The Input Window */
+	int chunkSize = (int)std::floor(
+		(this->inputBuffer.getNumSamples() - kernel.halfTaps * 2 - 2) / kernel.ratio);
+	chunkSize = std::min(chunkSize, this->maxChunk);
+	if (chunkSize <= 0) { return; }
+
+	/** Process Each Chunk */
+	for (int done = 0; done < length;) {
+		int num = std::min(length - done, chunkSize);
+
+		/** Source Range Of This Chunk */
+		int64_t firstIndex = (int64_t)std::floor(this->nextOutputPos * kernel.ratio);
+		int64_t lastIndex = (int64_t)std::floor((this->nextOutputPos + num - 1) * kernel.ratio);
+		this->fillInput(data,
+			firstIndex - kernel.halfTaps + 1, lastIndex + kernel.halfTaps + 1);
+
+		/** Resample */
+		this->process(kernel, buffer, bufferOffset + done, num);
+
+		done += num;
+	}
+}
+
+void SourceResampler::readDirect(const SourceInternalContainer& data,
+	juce::AudioBuffer<float>& buffer, int bufferOffset,
+	int64_t dataOffset, int length) {
+	length = std::min(length, buffer.getNumSamples() - bufferOffset);
+	if (length <= 0) { return; }
+
+	this->readData(data, buffer, bufferOffset, dataOffset, length);
+}
+
+void SourceResampler::setOwnStreamReader(bool ownStream) {
+	this->ownStream = ownStream;
+	this->streamFile = juce::File{};
+	this->streamReader = nullptr;
+}
+
+void SourceResampler::readData(const SourceInternalContainer& data,
+	juce::AudioBuffer<float>& buffer, int bufferOffset,
+	int64_t dataOffset, int length) {
+	/** Shared Reader */
+	if (!this->ownStream || !data.isAudioStreamed()) {
+		data.readAudio(buffer, bufferOffset, dataOffset, length);
+		return;
+	}
+
+	/** Open Own Reader When The Streamed File Changed */
+	auto file = data.getAudioStreamFile();
+	if (file != this->streamFile) {
+		this->streamReader = utils::createAudioReader(file);
+		this->streamFile = file;
+	}
+	data.readAudio(buffer, bufferOffset, dataOffset, length, this->streamReader.get());
+}
+
+void SourceResampler::fillInput(
+	const SourceInternalContainer& data, int64_t start, int64_t end) {
+	/** Keep Overlapped Input */
+	int64_t cachedEnd = this->inputStart + this->inputLength;
+	if (this->inputLength > 0 && start >= this->inputStart && start <= cachedEnd) {
+		int shift = (int)(start - this->inputStart);
+		int keep = (int)(cachedEnd - start);
+		if (shift > 0 && keep > 0) {
+			for (int i = 0; i < this->inputBuffer.getNumChannels(); i++) {
+				auto ptr = this->inputBuffer.getWritePointer(i);
+				std::memmove(ptr, ptr + shift, keep * sizeof(float));
+			}
+		}
+		this->inputStart = start;
+		this->inputLength = keep;
+	}
+	else {
+		this->inputStart = start;
+		this->inputLength = 0;
+	}
+
+	/** Read New Input Sequentially */
+	int num = (int)(end - (this->inputStart + this->inputLength));
+	num = std::min(num, this->inputBuffer.getNumSamples() - this->inputLength);
+	if (num > 0) {
+		this->readData(data, this->inputBuffer, this->inputLength,
+			this->inputStart + this->inputLength, num);
+		this->inputLength += num;
+	}
+}
+
+void SourceResampler::process(const Kernel& kernel,
+	juce::AudioBuffer<float>& buffer, int bufferOffset, int length) {
+	int outChannels = std::min(buffer.getNumChannels(), this->channels);
+	int taps = kernel.halfTaps * 2;
+
+	for (int n = 0; n < length; n++) {
+		/** Source Position */
+		double pos = (this->nextOutputPos + n) * kernel.ratio;
+		int64_t index = (int64_t)std::floor(pos);
+		double frac = pos - index;
+		int offset = (int)(index - kernel.halfTaps + 1 - this->inputStart);
+
+		switch (kernel.quality) {
+		case Quality::Linear: {
+			for (int c = 0; c < outChannels; c++) {
+				auto src = this->inputBuffer.getReadPointer(c, offset);
+				buffer.setSample(c, bufferOffset + n,
+					(float)(src[0] + (src[1] - src[0]) * frac));
+			}
+			break;
+		}
+		case Quality::WindowedSinc:
+		case Quality::Offline: {
+			/** Interpolate Between Adjacent Phases */
+			double phase = frac * kernel.phaseNum;
+			int phaseIndex = std::min((int)phase, kernel.phaseNum - 1);
+			float phaseFrac = (float)(phase - phaseIndex);
+			auto row0 = &(kernel.table[(size_t)phaseIndex * taps]);
+			auto row1 = row0 + taps;
+
+			for (int c = 0; c < outChannels; c++) {
+				auto src = this->inputBuffer.getReadPointer(c, offset);
+				float y0 = vMath::dotProductData(src, row0, taps);
+				float y1 = vMath::dotProductData(src, row1, taps);
+				buffer.setSample(c, bufferOffset + n, y0 + (y1 - y0) * phaseFrac);
+			}
+			break;
+		}
+		case Quality::Polyphase: {
+			/** Nearest Phase */
+			int phaseIndex = (int)(frac * kernel.phaseNum + 0.5);
+			auto row = &(kernel.table[(size_t)phaseIndex * taps]);
+
+			for (int c = 0; c < outChannels; c++) {
+				auto src = this->inputBuffer.getReadPointer(c, offset);
+				buffer.setSample(c, bufferOffset + n,
+					vMath::dotProductData(src, row, taps));
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	this->nextOutputPos += length;
+}
@@ -0,0 +1,97 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+class SourceInternalContainer;
+
+/**
+ * @brief	Resampling state of one playback voice.
+ *			Input history and filter phase are kept between contiguous reads,
+ *			the voice only drops its input window when the read position jumps
+ *			or the source data changes.
+ *			The filter table lives in a kernel which is built off the audio thread
+ *			and shared by all voices of a source, so reading never allocates.
+ */
+class SourceResampler final {
+public:
+	/** Offline is a long windowed sinc used by background conversion */
+	enum class Quality {
+		Linear, WindowedSinc, Polyphase, Offline,
+		MaxNum
+	};
+
+	/** Filter table of one ratio and quality, never changed after it is built */
+	struct Kernel final {
+		double ratio = 1;
+		Quality quality = Quality::Linear;
+		/** (phaseNum + 1) rows of (halfTaps * 2) taps */
+		int halfTaps = 1;
+		int phaseNum = 0;
+		std::vector<float> table;
+	};
+	using KernelPtr = std::shared_ptr<const Kernel>;
+
+	/**
+	 * @brief	Build the filter table. Avoid calling this on the audio thread.
+	 */
+	static KernelPtr createKernel(double ratio, Quality quality);
+
+	SourceResampler() = default;
+
+	/**
+	 * @brief	Allocate the input window. Avoid calling this on the audio thread.
+	 */
+	void prepare(int channels, int blockSize);
+	bool isPreparedFor(int channels) const;
+	void reset();
+
+	/**
+	 * @brief	Read resampled data. dataOffset is the position in output samples.
+	 *			The input window is dropped when dataVersion changes.
+	 */
+	void read(const SourceInternalContainer& data,
+		const Kernel& kernel, uint64_t dataVersion,
+		juce::AudioBuffer<float>& buffer, int bufferOffset,
+		int64_t dataOffset, int length);
+	/**
+	 * @brief	Read data at the source sample rate, without resampling.
+	 */
+	void readDirect(const SourceInternalContainer& data,
+		juce::AudioBuffer<float>& buffer, int bufferOffset,
+		int64_t dataOffset, int length);
+
+	/**
+	 * @brief	Read streamed data with an own file reader instead of the shared read-ahead reader.
+	 *			Voices of non-playback threads use this, so they never move the playback window
+	 *			and never read silence on cache misses.
+	 */
+	void setOwnStreamReader(bool ownStream);
+
+private:
+	uint64_t dataVersion = 0;
+	int channels = 0;
+	int maxChunk = 0;
+
+	/** Input window, sample 0 of inputBuffer is source sample inputStart */
+	juce::AudioBuffer<float> inputBuffer;
+	int64_t inputStart = 0;
+	int inputLength = 0;
+
+	/** Output position expected by the next read */
+	int64_t nextOutputPos = -1;
+
+	bool ownStream = false;
+	juce::File streamFile;
+	std::unique_ptr<juce::AudioFormatReader> streamReader = nullptr;
+
+	void readData(const SourceInternalContainer& data,
+		juce::AudioBuffer<float>& buffer, int bufferOffset,
+		int64_t dataOffset, int length);
+	void fillInput(const SourceInternalContainer& data, int64_t start, int64_t end);
+	void process(const Kernel& kernel,
+		juce::AudioBuffer<float>& buffer, int bufferOffset, int length);
+
+	static constexpr int maxHalfTaps = 128;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourceResampler)
+};
@@ -0,0 +1,142 @@
+﻿#include "AudioEventQueue.h"
+
+const juce::MidiMessage AudioEvent::getMessage() const {
+	return juce::MidiMessage{ this->longData ? this->longData : this->data.data(), this->size };
+}
+
+AudioEventQueue::AudioEventQueue() {
+	/** Prepare Ring */
+	this->events.resize(AudioEventQueue::capacity);
+	this->longData.resize(AudioEventQueue::longDataCapacity);
+	this->longDataTemp.reserve(AudioEventQueue::longDataCapacity);
+
+	/** Start Drain */
+	this->startTimerHz(AudioEventQueue::frameRate);
+}
+
+AudioEventQueue::~AudioEventQueue() {
+	this->stopTimer();
+}
+
+int AudioEventQueue::addListener(const Listener& listener) {
+	juce::GenericScopedLock locker(this->listenerLock);
+
+	int id = this->listenerIDTemp++;
+	this->listeners[id] = listener;
+	return id;
+}
+
+void AudioEventQueue::removeListener(int id) {
+	juce::GenericScopedLock locker(this->listenerLock);
+	this->listeners.erase(id);
+}
+
+bool AudioEventQueue::push(const AudioEvent& event) noexcept {
+	auto scope = this->fifo.write(1);
+	if (scope.blockSize1 + scope.blockSize2 < 1) {
+		this->overflowNum++;
+		return false;
+	}
+
+	this->events[scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2] = event;
+	return true;
+}
+
+bool AudioEventQueue::pushMIDI(int target, AudioEventType type,
+	const uint8_t* data, int size) noexcept {
+	if (size <= 0) { return false; }
+
+	AudioEvent event;
+	event.type = type;
+	event.target = target;
+	event.size = size;
+
+	/** Short Message */
+	if (size <= AudioEvent::maxDataSize) {
+		std::memcpy(event.data.data(), data, size);
+		return this->push(event);
+	}
+
+	/** Long Message (Only the audio thread writes, so the free space checked here stays available) */
+	if (this->fifo.getFreeSpace() < 1 || this->longDataFifo.getFreeSpace() < size) {
+		this->overflowNum++;
+		return false;
+	}
+	{
+		auto scope = this->longDataFifo.write(size);
+		std::memcpy(this->longData.data() + scope.startIndex1, data, scope.blockSize1);
+		std::memcpy(this->longData.data() + scope.startIndex2, data + scope.blockSize1, scope.blockSize2);
+	}
+	return this->push(event);
+}
+
+bool AudioEventQueue::pushValue(int target, AudioEventType type, int value) noexcept {
+	AudioEvent event;
+	event.type = type;
+	event.target = target;
+	event.value = value;
+	return this->push(event);
+}
+
+uint64_t AudioEventQueue::getOverflowNum() const {
+	return this->overflowNum;
+}
+
+void AudioEventQueue::drain() {
+	/** Read Events Available Now */
+	int num = this->fifo.getNumReady();
+	for (int i = 0; i < num; i++) {
+		AudioEvent event;
+		{
+			auto scope = this->fifo.read(1);
+			if (scope.blockSize1 + scope.blockSize2 < 1) { break; }
+			event = this->events[scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2];
+		}
+
+		/** Get Long Data */
+		if (event.size > AudioEvent::maxDataSize) {
+			auto scope = this->longDataFifo.read(event.size);
+			this->longDataTemp.resize(event.size);
+			std::memcpy(this->longDataTemp.data(), this->longData.data() + scope.startIndex1, scope.blockSize1);
+			std::memcpy(this->longDataTemp.data() + scope.blockSize1, this->longData.data() + scope.startIndex2, scope.blockSize2);
+			event.longData = this->longDataTemp.data();
+		}
+
+		/** Get Listener */
+		Listener listener;
+		{
+			juce::GenericScopedLock locker(this->listenerLock);
+			auto it = this->listeners.find(event.target);
+			if (it == this->listeners.end()) { continue; }
+			listener = it->second;
+		}
+
+		/** Dispatch */
+		if (listener) {
+			listener(event);
+		}
+	}
+}
+
+void AudioEventQueue::timerCallback() {
+	this->drain();
+}
+
+AudioEventQueue* AudioEventQueue::getInstance() {
+	return AudioEventQueue::instance
+		? AudioEventQueue::instance
+		: (AudioEventQueue::instance = new AudioEventQueue{});
+}
+
+AudioEventQueue* AudioEventQueue::getInstanceWithoutCreate() {
+	return AudioEventQueue::instance;
+}
+
+void AudioEventQueue::releaseInstance() {
+	if (AudioEventQueue::instance) {
+		delete AudioEventQueue::instance;
+		AudioEventQueue::instance = nullptr;
+	}
+}
+
+AudioEventQueue* AudioEventQueue::instance = nullptr;
@@ -0,0 +1,87 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+enum class AudioEventType : uint8_t {
+	MIDIInput,
+	MIDIOutput,
+	CCLearn,
+	Record,
+	Transport,
+	GraphChanged,
+
+	TypeMaxNum
+};
+
+struct AudioEvent final {
+	static constexpr int maxDataSize = 32;
+
+	AudioEventType type = AudioEventType::TypeMaxNum;
+	int target = -1;
+	int value = 0;
+	int size = 0;
+	std::array<uint8_t, maxDataSize> data{};
+	/** Data of messages longer than maxDataSize, only valid while the event is dispatched */
+	const uint8_t* longData = nullptr;
+
+	const juce::MidiMessage getMessage() const;
+};
+
+/**
+ * @brief	Preallocated single-producer/single-consumer ring which carries events
+ *			from the audio thread to the message thread without allocation or locking.
+ *			The ring is drained on the message thread at UI frame rate and each event is
+ *			dispatched to the listener which id is the event's target.
+ *			MIDI messages longer than an event slot, such as SysEx, are carried through a
+ *			preallocated byte ring beside the event ring.
+ */
+class AudioEventQueue final : private juce::Timer,
+	private juce::DeletedAtShutdown {
+public:
+	AudioEventQueue();
+	~AudioEventQueue() override;
+
+	using Listener = std::function<void(const AudioEvent&)>;
+	int addListener(const Listener& listener);
+	void removeListener(int id);
+
+	/**
+	 * @brief	Push an event. Call this on the audio thread only.
+	 */
+	bool push(const AudioEvent& event) noexcept;
+	bool pushMIDI(int target, AudioEventType type,
+		const uint8_t* data, int size) noexcept;
+	bool pushValue(int target, AudioEventType type, int value) noexcept;
+
+	uint64_t getOverflowNum() const;
+
+	void drain();
+
+private:
+	void timerCallback() override;
+
+	static constexpr int capacity = 4096;
+	static constexpr int longDataCapacity = 64 * 1024;
+
+	juce::AbstractFifo fifo{ AudioEventQueue::capacity };
+	std::vector<AudioEvent> events;
+	juce::AbstractFifo longDataFifo{ AudioEventQueue::longDataCapacity };
+	std::vector<uint8_t> longData, longDataTemp;
+	std::atomic<uint64_t> overflowNum = 0;
+
+	juce::CriticalSection listenerLock;
+	std::map<int, Listener> listeners;
+	int listenerIDTemp = 0;
+
+public:
+	static constexpr int frameRate = 60;
+
+	static AudioEventQueue* getInstance();
+	static AudioEventQueue* getInstanceWithoutCreate();
+	static void releaseInstance();
+
+private:
+	static AudioEventQueue* instance;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioEventQueue)
+};
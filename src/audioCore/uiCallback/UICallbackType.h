@@ -23,6 +23,7 @@ enum class UICallbackType : int {
 	PluginSearchMessage,
 	SynthStateChanged,
 	SourceRecord,
+	SourceLoadProgress,
 
 	TypeMaxNum
 };
@@ -33,12 +33,7 @@ private:
 	std::unique_ptr<Splash> splash = nullptr;
 
 	void initCrashHandler() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Init Crash Handler..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Init Crash Handler",
 			[] {
 				/** Init Path */
 				::initCrashHandler(utils::getAppRootDir().getFullPathName());
@@ -53,25 +48,15 @@ private:
 	};
 
 	void loadConfig() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Load Configs..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Load Configs",
 			[] {
 				ConfigManager::getInstance()->loadConfigs();
-			}
+			}, {}, InitTaskList::ThreadType::Worker
 		);
 	};
 
 	void setAudioConfig() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Set Audio Configs..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Set Audio Configs",
 			[] {
 				/** Audio Device */
 				auto kmFile = utils::getAudioConfigFile();
@@ -84,12 +69,21 @@ private:
 				quickAPI::setPluginListTemporaryFilePath(utils::getPluginListFile().getFullPathName());
 				quickAPI::setPluginBlackListFilePath(utils::getPluginBlackListFile().getFullPathName());
 				quickAPI::setDeadPluginListPath(utils::getPluginDeadTempDir().getFullPathName());
+				quickAPI::setSourceCachePath(utils::getSourceCacheDir().getFullPathName());
 
 				/** Functions */
 				auto& funcVar = ConfigManager::getInstance()->get("function");
 				quickAPI::setReturnToStartOnStop(funcVar["return-on-stop"]);
 				quickAPI::setAnonymousMode(funcVar["anonymous-mode"]);
 				quickAPI::setSIMDLevel(funcVar["simd-speed-up"]);
+				quickAPI::setAudioSourceStreaming(funcVar["stream-audio-source"]);
+				quickAPI::setAudioStreamCacheSize(funcVar["stream-cache-size"]);
+				quickAPI::setAudioResampleQuality(funcVar.getProperty("resample-quality", 2));
+				quickAPI::setAudioSourceConvertMode(funcVar.getProperty("source-convert-mode", 1));
+				quickAPI::setRenderBlockSize(funcVar["render-block-size"]);
+				quickAPI::setRenderThreadNum(funcVar["render-threads"]);
+				quickAPI::setAudioThreadNum(funcVar.getProperty("audio-threads", 0));
+				quickAPI::setPluginLoadThreadNum(funcVar.getProperty("plugin-load-threads", 0));
 
 				/** Output */
 				auto formats = quickAPI::getAudioFormatsSupported(true);
@@ -113,30 +107,20 @@ private:
 						quickAPI::setFormatMetaData(format, metaList);
 					}
 				}
-			}
+			}, { "Load Configs" }
 		);
 	};
 
 	void loadAudioPlugins() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Load Audio Plugins..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Load Audio Plugins",
 			[] {
 				[[maybe_unused]] auto result = quickAPI::getPluginList();
-			}
+			}, { "Set Audio Configs" }, InitTaskList::ThreadType::Worker
 		);
 	};
 
 	void loadTheme() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Load Theme Colors..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Load Theme Colors",
 			[] {
 				/** Get Config */
 				auto& conf = ConfigManager::getInstance()->get("startup");
@@ -160,30 +144,28 @@ private:
 							i.name.toString(), ColorMap::fromString(i.value.toString()));
 					}
 				}
-			}
+			}, { "Load Configs" }
 		);
 	};
 
 	void initLookAndFeel() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Init Default LookAndFeel..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Init Default LookAndFeel",
 			[] {
 				LookAndFeelFactory::getInstance()->initialise();
-			}
+			}, { "Load Theme Colors" }
 		);
 	};
 
-	void setFlowUIIcon() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Set FlowUI Button Icons..."); }
-			}
+	void preloadIcons() {
+		InitTaskList::getInstance()->add("Preload Icons",
+			[] {
+				RCManager::getInstance()->loadImage(utils::getResourceFile("logo.png"));
+			}, {}, InitTaskList::ThreadType::Worker
 		);
-		InitTaskList::getInstance()->add(
+	};
+
+	void setFlowUIIcon() {
+		InitTaskList::getInstance()->add("Set FlowUI Button Icons",
 			[] {
 				flowUI::FlowStyle::setButtonLeftIcon(
 					utils::getIconFile("Design", "layout-left-2-line").getFullPathName());
@@ -208,45 +190,30 @@ private:
 	};
 
 	void configFlowUI() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Config FlowUI Window..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Config FlowUI Window",
 			[] {
 				auto& funcVar = ConfigManager::getInstance()->get("function");
 
 				flowUI::FlowWindowHub::setTitle(utils::getAudioPlatformName());
 				flowUI::FlowWindowHub::setIcon(utils::getResourceFile("logo.png").getFullPathName());
 				flowUI::FlowWindowHub::setOpenGL(!((bool)(funcVar["cpu-painting"])));
-			}
+			}, { "Load Configs", "Preload Icons" }
 		);
 	};
 
 	void configPluginEditor() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Config Plugin Editor..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Config Plugin Editor",
 			[] {
 				auto& funcVar = ConfigManager::getInstance()->get("function");
 
 				PluginEditorHub::getInstance()->setIcon(utils::getResourceFile("logo.png").getFullPathName());
 				PluginEditorHub::getInstance()->setOpenGL(!((bool)(funcVar["cpu-painting"])));
-			}
+			}, { "Load Configs", "Preload Icons" }
 		);
 	};
 
 	void loadUITranslate() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Load UI Translations..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Load UI Translations",
 			[] {
 				/** Get Config */
 				auto& conf = ConfigManager::getInstance()->get("startup");
@@ -266,18 +233,15 @@ private:
 
 					juce::LocalisedStrings::setCurrentMappings(trans);
 				}
-			}
+			}, { "Load Configs" }, InitTaskList::ThreadType::Worker
 		);
 	};
 
 	void setUIFont() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Set UI Fonts..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
-			[] {
+		/** Typeface Is Created On Worker And Applied On Message Thread */
+		auto typeface = std::make_shared<juce::Typeface::Ptr>();
+		InitTaskList::getInstance()->add("Load UI Fonts",
+			[typeface] {
 				/** Get Config */
 				auto& conf = ConfigManager::getInstance()->get("startup");
 				juce::String fontName = conf["font"].toString();
@@ -291,19 +255,18 @@ private:
 				auto fontStream = fontFile.createInputStream();
 				fontStream->read(ptrFontData.get(), fontSize);
 
-				auto ptrTypeface = juce::Typeface::createSystemTypefaceFor(ptrFontData.get(), fontSize);
-				LookAndFeelFactory::getInstance()->setDefaultSansSerifTypeface(ptrTypeface);
-			}
+				*typeface = juce::Typeface::createSystemTypefaceFor(ptrFontData.get(), fontSize);
+			}, { "Load Configs" }, InitTaskList::ThreadType::Worker
+		);
+		InitTaskList::getInstance()->add("Set UI Fonts",
+			[typeface] {
+				LookAndFeelFactory::getInstance()->setDefaultSansSerifTypeface(*typeface);
+			}, { "Load UI Fonts", "Init Default LookAndFeel" }
 		);
 	};
 
 	void createComponents() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Create Components..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Create Components",
 			[] {
 				CompManager::getInstance()->set(CompManager::CompType::StartMenu,
 					std::make_unique<flowUI::FlowComponent>(TRANS("Start Menu")));
@@ -321,31 +284,21 @@ private:
 					std::make_unique<AudioDebuggerComponent>());
 				CompManager::getInstance()->set(CompManager::CompType::MidiDebugger,
 					std::make_unique<MidiDebuggerComponent>());
-			}
+			}, { "Load Audio Plugins", "Init Default LookAndFeel", "Set FlowUI Button Icons", "Config FlowUI Window", "Config Plugin Editor", "Load UI Translations", "Set UI Fonts" }
 		);
 	};
 
 	void initCommands() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Init Command Manager..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Init Command Manager",
 			[] {
 				CommandManager::getInstance()->init();
 				flowUI::FlowWindowHub::addKeyListener(CommandManager::getInstance()->getKeyMappings());
-			}
+			}, { "Create Components" }
 		);
 	};
 
 	void loadKeyMapping() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Load Key Mapping..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Load Key Mapping",
 			[] {
 				if (auto keyMapping = CommandManager::getInstance()->getKeyMappings()) {
 					auto kmFile = utils::getKeyMappingFile();
@@ -354,17 +307,12 @@ private:
 					}
 				}
 				CommandManager::getInstance()->startListening();
-			}
+			}, { "Init Command Manager" }
 		);
 	};
 
 	void initCoreHooks() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Init Core Hooks..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Init Core Hooks",
 			[] {
 				flowUI::FlowWindowHub::setAppExitHook([]() -> bool {
 					if (quickAPI::checkProjectSaved() && quickAPI::checkSourcesSaved()) {
@@ -375,17 +323,12 @@ private:
 						juce::MessageBoxIconType::QuestionIcon, TRANS("Close Editor"),
 						TRANS("Discard unsaved changes and exit?"));
 					});
-			}
+			}, { "Set Audio Configs", "Config FlowUI Window" }
 		);
 	};
 
 	void addCoreCallback() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Register Core Callbacks..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Register Core Callbacks",
 			[] {
 				CoreCallbacks::getInstance()->addError(
 					[](const juce::String& title, const juce::String& mes) {
@@ -399,34 +342,24 @@ private:
 						MessageModel::getInstance()->addNow("AudioCore: " + mes, MessageModel::Callback{});
 					}
 				);
-			}
+			}, { "Set Audio Configs" }
 		);
 	};
 
 	void addAudioDeviceCallback() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Register Audio Device Callbacks..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Register Audio Device Callbacks",
 			[] {
 				auto audioDeviceCallback = [](juce::XmlElement* data) {
 					auto file = utils::getAudioConfigFile();
 					utils::saveXml(file, data);
 					};
 				quickAPI::setAudioDeviceCallback(audioDeviceCallback);
-			}
+			}, { "Set Audio Configs" }
 		);
 	};
 
 	void autoLayout() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Auto Layout Components..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Auto Layout Components",
 			[] {
 				/** Get Config */
 				auto& conf = ConfigManager::getInstance()->get("startup");
@@ -435,30 +368,20 @@ private:
 				/** Layout */
 				CompManager::getInstance()->autoLayout(
 					utils::getLayoutFile(layoutName).getFullPathName());
-			}
+			}, { "Load Key Mapping" }
 		);
 	};
 
 	void prepareMainWindow() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Set Main Window Size..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Set Main Window Size",
 			[] {
 				CompManager::getInstance()->maxMainWindow();
-			}
+			}, { "Auto Layout Components" }
 		);
 	};
 
 	void clearCrashDump() {
-		InitTaskList::getInstance()->add(
-			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
-				if (splash) { splash->showMessage("Find Crash Dump..."); }
-			}
-		);
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Find Crash Dump",
 			[] {
 				auto dumpList = ::getAllDumpFiles();
 				if (!dumpList.isEmpty()) {
@@ -477,23 +400,23 @@ private:
 						}
 					}
 				}
-			}
+			}, { "Set Main Window Size" }
 		);
 	};
 
 	void hideSplash() {
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Hide Splash",
 			[splash = Splash::SafePointer<Splash>(this->splash.get())] {
 				if (splash) {
 					splash->showMessage("Ready. Special thanks to Warsic Music Club.");
 					splash->ready();
 				}
-			}
+			}, { "Init Crash Handler", "Init Core Hooks", "Register Core Callbacks", "Register Audio Device Callbacks", "Find Crash Dump" }
 		);
 	};
 
 	void loadProject(const juce::String& commandLineParameters) {
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Load Project",
 			[commandLineParameters] {
 				if (commandLineParameters.isNotEmpty()) {
 					auto params = utils::parseCommand(commandLineParameters);
@@ -525,15 +448,15 @@ private:
 						}
 					}
 				}
-			}
+			}, { "Hide Splash" }
 		);
 	};
 
 	void setCrashHandler() {
-		InitTaskList::getInstance()->add(
+		InitTaskList::getInstance()->add("Set Crash Handler",
 			[] {
 				juce::SystemStats::setApplicationCrashHandler(::applicationCrashHandler);
-			}
+			}, { "Load Project" }
 		);
 	};
 
@@ -548,6 +471,11 @@ public:
 		/** Show Splash */
 		this->splash = std::make_unique<Splash>();
 		this->splash->setVisible(true);
+		InitTaskList::getInstance()->setMessageCallback(
+			[splash = Splash::SafePointer<Splash>(this->splash.get())](const juce::String& name) {
+				if (splash) { splash->showMessage(name + "..."); }
+			}
+		);
 
 		/** Init Crash Handler */
 		this->initCrashHandler();
@@ -567,6 +495,9 @@ public:
 		/** Init Default LookAndFeel */
 		this->initLookAndFeel();
 
+		/** Preload Icons */
+		this->preloadIcons();
+
 		/** Set FlowUI Button Icon */
 		this->setFlowUIIcon();
 
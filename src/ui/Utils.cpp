@@ -172,6 +172,11 @@ namespace utils {
 		return getAudioDir().getChildFile("./presets/");
 	}
 
+	const juce::File getSourceCacheDir(
+		const juce::String& path) {
+		return getAudioDir().getChildFile(path);
+	}
+
 	const juce::URL getHelpPage(const juce::String& version,
 		const juce::String& branch, const juce::String& language) {
 		return juce::URL{ "https://help.daw.org.cn" }
@@ -57,6 +57,8 @@ namespace utils {
 	const juce::File getPluginDeadTempDir(
 		const juce::String& path = "./deadPlugins/");
 	const juce::File getPluginPresetDir();
+	const juce::File getSourceCacheDir(
+		const juce::String& path = "./sourceCache/");
 
 	const juce::URL getHelpPage(
 		const juce::String& version, const juce::String& branch,
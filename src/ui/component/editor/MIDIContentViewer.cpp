@@ -1,4 +1,4 @@
-#include "MIDIContentViewer.h"
+﻿#include "MIDIContentViewer.h"
 #include "../../misc/Tools.h"
 #include "../../lookAndFeel/LookAndFeelFactory.h"
 #include "../../Utils.h"
@@ -116,39 +116,15 @@ void MIDIContentViewer::updateBlocks() {
 }
 
 void MIDIContentViewer::updateData() {
-	/** Clear Temp */
-	this->midiDataTemp.clear();
+	/** Current Track */
+	this->midiTrack = -1;
+	this->midiMinNote = this->midiMaxNote = 0;
 
-	/** Update Note Temp */
+	/** Update Note Zone Temp, Notes Are Got In View When Painting */
 	if (this->index >= 0 && this->ref != 0) {
-		int currentMIDITrack = quickAPI::getSeqTrackCurrentMIDITrack(this->index);
-		auto midiNoteList = quickAPI::getMIDISourceNotes(this->ref, currentMIDITrack);
-
-		/** Add Each Note */
-		this->midiDataTemp.ensureStorageAllocated(midiNoteList.size());
-		for (auto& note : midiNoteList) {
-			/** Set Temp */
-			Note noteTemp{};
-			noteTemp.startSec = note.timeSec;
-			noteTemp.endSec = note.endSec;
-			noteTemp.num = note.pitch;
-			noteTemp.vel = note.vel;
-			noteTemp.channel = note.channel;
-			noteTemp.lyrics = note.lyrics;
-			this->midiDataTemp.add(noteTemp);
-		}
-	}
-
-	/** Update Note Zone Temp */
-	{
-		uint8_t minNote = 127, maxNote = 0;
-		for (auto& note : this->midiDataTemp) {
-			minNote = std::min(minNote, note.num);
-			maxNote = std::max(maxNote, note.num);
-		}
-		if (maxNote < minNote) { maxNote = minNote = 0; }
-		this->midiMinNote = minNote;
-		this->midiMaxNote = maxNote;
+		this->midiTrack = quickAPI::getSeqTrackCurrentMIDITrack(this->index);
+		std::tie(this->midiMinNote, this->midiMaxNote)
+			= quickAPI::getMIDISourceNotePitchRange(this->ref, this->midiTrack);
 	}
 
 	/** Update UI */
@@ -564,8 +540,31 @@ void MIDIContentViewer::updateNoteImageTemp() {
 	this->noteRectTempList.clear();
 	uint8_t midiChannel = Tools::getInstance()->getMIDIChannel();
 
-	/** Notes */
+	/** Get Notes In View */
 	int minNoteNum = std::floor(this->keyBottom), maxNoteNum = std::floor(this->keyTop);
+	this->midiDataTemp.clearQuick();
+	if (this->index >= 0 && this->ref != 0
+		&& maxNoteNum >= 0 && (minNoteNum - 1) <= 127) {
+		auto midiNoteList = quickAPI::getMIDISourceNotesInArea(
+			this->ref, this->midiTrack, this->secStart, this->secEnd,
+			(uint8_t)std::max(minNoteNum - 1, 0), (uint8_t)std::min(maxNoteNum, 127));
+
+		/** Add Each Note */
+		this->midiDataTemp.ensureStorageAllocated(midiNoteList.size());
+		for (auto& note : midiNoteList) {
+			/** Set Temp */
+			Note noteTemp{};
+			noteTemp.startSec = note.timeSec;
+			noteTemp.endSec = note.endSec;
+			noteTemp.num = note.pitch;
+			noteTemp.vel = note.vel;
+			noteTemp.channel = note.channel;
+			noteTemp.lyrics = note.lyrics;
+			this->midiDataTemp.add(noteTemp);
+		}
+	}
+
+	/** Notes */
 	for (int i = 0; i < this->midiDataTemp.size(); i++) {
 		auto& note = this->midiDataTemp.getReference(i);
 		if (note.startSec <= this->secEnd &&
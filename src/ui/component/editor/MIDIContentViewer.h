@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 
 #include <JuceHeader.h>
 #include "../../misc/LevelMeterHub.h"
@@ -90,7 +90,9 @@ private:
 
 	bool viewMoving = false;
 
-	/** Start, End, Num */
+	int midiTrack = -1;
+
+	/** Notes in view */
 	struct Note final {
 		double startSec, endSec;
 		uint8_t num;
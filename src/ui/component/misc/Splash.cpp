@@ -238,6 +238,9 @@ void Splash::ready() {
 }
 
 void Splash::showMessage(const juce::String& message) {
+	/** Keep Ready Message */
+	if (this->isReady) { return; }
+
 	this->mesStr = message;
 	this->repaint();
 }
@@ -11,26 +11,44 @@ MixerTrackLevelMeter::MixerTrackLevelMeter() {
 
 void MixerTrackLevelMeter::updateLevelMeter() {
 	/** Get Value */
-	auto valuesTemp = quickAPI::getMixerTrackOutputLevel(this->index);
-	if (this->values.size() == valuesTemp.size()) {
-		this->values.clearQuick();
-	}
-	else {
-		this->values.clear();
-	}
-	for (auto i : valuesTemp) {
-		this->values.add(utils::logRMS(i));
+	this->values.clearQuick();
+	this->holdValues.clearQuick();
+	this->truePeakValues.clearQuick();
+	this->loudness = {};
+	if (auto meter = quickAPI::getMixerTrackOutputMeter(this->index)) {
+		for (int i = 0; i < meter->getChannelNum(); i++) {
+			auto level = meter->getLevel(i);
+			this->values.add(utils::logRMS(level.rms));
+			this->holdValues.add(utils::logRMS(level.peakHold));
+			this->truePeakValues.add(utils::logRMS(level.truePeakMax));
+		}
+		this->loudness = meter->getLoudness();
 	}
+	this->dspLoad = quickAPI::getMixerTrackDSPLoad(this->index);
 
 	/** Repaint */
 	this->repaint();
+}
 
-	/** Tooltip */
+juce::String MixerTrackLevelMeter::getTooltip() {
+	/** Only Built While Hovered */
 	juce::String tooltipStr;
 	for (auto i : this->values) {
 		tooltipStr += (juce::String{ i, 2 } + " dB, ");
 	}
-	this->setTooltip(tooltipStr);
+	tooltipStr += "\n" + TRANS("True Peak:") + " ";
+	for (auto i : this->truePeakValues) {
+		tooltipStr += (juce::String{ i, 2 } + " dBTP, ");
+	}
+	tooltipStr += "\n" + TRANS("Short-Term:") + " " + juce::String{ this->loudness.shortTerm, 1 } + " LUFS, "
+		+ TRANS("Integrated:") + " " + juce::String{ this->loudness.integrated, 1 } + " LUFS";
+	tooltipStr += "\n" + TRANS("DSP Load:") + " "
+		+ juce::String{ this->dspLoad.averageShare * 100, 1 } + "% ("
+		+ TRANS("Average:") + " " + juce::String{ this->dspLoad.average * 1000000, 0 } + " us, "
+		+ TRANS("P99:") + " " + juce::String{ this->dspLoad.p99 * 1000000, 0 } + " us, "
+		+ TRANS("Worst:") + " " + juce::String{ this->dspLoad.worst * 1000000, 0 } + " us)\n"
+		+ TRANS("Overloads:") + " " + juce::String{ (juce::int64)this->dspLoad.xrunNum };
+	return tooltipStr;
 }
 
 void MixerTrackLevelMeter::paint(juce::Graphics& g) {
@@ -50,6 +68,9 @@ void MixerTrackLevelMeter::paint(juce::Graphics& g) {
 	int valueHeight = screenSize.getHeight() * 0.015;
 	float valueFontHeight = screenSize.getHeight() * 0.014;
 
+	int loadHeight = screenSize.getHeight() * 0.015;
+	float loadFontHeight = screenSize.getHeight() * 0.0125;
+
 	/** Color */
 	auto& laf = this->getLookAndFeel();
 	juce::Colour backgroundColor = laf.findColour(
@@ -62,6 +83,7 @@ void MixerTrackLevelMeter::paint(juce::Graphics& g) {
 	/** Font */
 	juce::Font textFont(juce::FontOptions{ textFontHeight });
 	juce::Font valueFont(juce::FontOptions{ valueFontHeight });
+	juce::Font loadFont(juce::FontOptions{ loadFontHeight });
 
 	/** Background */
 	g.setColour(backgroundColor);
@@ -121,9 +143,46 @@ void MixerTrackLevelMeter::paint(juce::Graphics& g) {
 				g.setColour(levelColors[j]);
 				g.fillRect(barRect);
 			}
+
+			/** Peak Hold */
+			float holdPercent = utils::getLogLevelPercent(this->holdValues[i], rmsNum);
+			if (holdPercent > 0) {
+				int seg = 0;
+				while (seg < levelSegs.size() - 1 && holdPercent > levelSegs[seg]) { seg++; }
+				juce::Rectangle<float> holdRect(
+					rmsArea.getX() + (barWidth + splitWidth) * i,
+					rmsArea.getBottom() - std::min(holdPercent, 1.f) * rmsArea.getHeight(),
+					barWidth, lineThickness);
+
+				g.setColour(levelColors[seg]);
+				g.fillRect(holdRect);
+			}
 		}
 	}
 
+	/** DSP Load */
+	{
+		std::array<double, 2> loadSegs{ 0.5, 0.8 };
+		juce::Colour loadColor = juce::Colours::red;
+		for (int i = 0; i < loadSegs.size(); i++) {
+			if (this->dspLoad.p99Share < loadSegs[i]) {
+				loadColor = levelColors[i];
+				break;
+			}
+		}
+
+		juce::Rectangle<float> loadRect(
+			rmsArea.getX(), rmsArea.getBottom() - loadHeight,
+			rmsArea.getWidth(), loadHeight);
+		g.setColour(backgroundColor);
+		g.fillRect(loadRect);
+
+		g.setColour(loadColor);
+		g.setFont(loadFont);
+		g.drawFittedText(juce::String{ this->dspLoad.averageShare * 100, 1 } + "%",
+			loadRect.toNearestInt(), juce::Justification::centred, 1, 0.f);
+	}
+
 	/** Cursor */
 	if (this->mouseHovered) {
 		float mouseY = this->mousePos.getY();
@@ -175,6 +234,16 @@ void MixerTrackLevelMeter::mouseExit(
 	this->mouseHovered = false;
 }
 
+void MixerTrackLevelMeter::mouseUp(
+	const juce::MouseEvent& event) {
+	/** Reset Peak And Loudness */
+	if (event.mods.isRightButtonDown()) {
+		if (auto meter = quickAPI::getMixerTrackOutputMeter(this->index)) {
+			meter->reset();
+		}
+	}
+}
+
 void MixerTrackLevelMeter::update(int index) {
 	this->index = index;
 }
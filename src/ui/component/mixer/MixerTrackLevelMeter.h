@@ -2,26 +2,31 @@
 
 #include <JuceHeader.h>
 #include "../../misc/LevelMeterHub.h"
+#include "../../../audioCore/AC_API.h"
 
 class MixerTrackLevelMeter final
 	: public juce::Component,
 	public LevelMeterHub::Target,
-	public juce::SettableTooltipClient {
+	public juce::TooltipClient {
 public:
 	MixerTrackLevelMeter();
 
 	void updateLevelMeter() override;
 
 	void paint(juce::Graphics& g) override;
+	juce::String getTooltip() override;
 	void mouseMove(const juce::MouseEvent& event) override;
 	void mouseDrag(const juce::MouseEvent& event) override;
 	void mouseExit(const juce::MouseEvent& event) override;
+	void mouseUp(const juce::MouseEvent& event) override;
 
 	void update(int index);
 
 private:
 	int index = -1;
-	juce::Array<float> values;
+	juce::Array<float> values, holdValues, truePeakValues;
+	quickAPI::Loudness loudness;
+	quickAPI::DSPLoad dspLoad;
 	bool mouseHovered = false;
 	juce::Point<int> mousePos;
 
@@ -1,6 +1,5 @@
 ﻿#include "SeqTrackContentViewer.h"
 #include "../../lookAndFeel/LookAndFeelFactory.h"
-#include "../../misc/AudioExtractor.h"
 #include "../../misc/MainThreadPool.h"
 #include "../../misc/Tools.h"
 #include "../../misc/CoreActions.h"
@@ -48,12 +47,6 @@ SeqTrackContentViewer::SeqTrackContentViewer(
 
 	/** Data Update Timer */
 	this->blockImageUpdateTimer = std::make_unique<DataImageUpdateTimer>(this);
-	/**
-	 * To fix the bug in AudioExtractor.
-	 * This will invoke AudioExtractor::extractAsync(...) every period of time.
-	 * I currently do not have a better solution.
-	 */
-	this->blockImageUpdateTimer->startTimer(5000);
 }
 
 void SeqTrackContentViewer::setCompressed(bool isCompressed) {
@@ -107,6 +100,9 @@ void SeqTrackContentViewer::updateBlock(int /*blockIndex*/) {
 		this->updateBlockInternal(i);
 	}
 
+	/** Update Wave Of Moved Blocks */
+	this->checkSourceTempInternal();
+
 	/** Repaint */
 	this->repaint();
 }
@@ -124,6 +120,9 @@ void SeqTrackContentViewer::updateHPos(double pos, double itemSize) {
 	if (shouldRepaintDataImage) {
 		this->updateDataImage();
 	}
+	else {
+		this->checkSourceTempInternal();
+	}
 
 	this->repaint();
 }
@@ -145,30 +144,6 @@ void SeqTrackContentViewer::updateDataRef() {
 }
 
 void SeqTrackContentViewer::updateData() {
-	/** Clear Temp */
-	this->audioDataTemp = {};
-	this->midiDataTemp.clear();
-	//this->audioPointTemp.clear();
-	//this->midiMinNote = this->midiMaxNote = 0;
-
-	/** Get Audio Data */
-	if (this->audioValid) {
-		this->audioDataTemp = quickAPI::getSeqTrackAudioData(this->index);
-	}
-
-	/** Get MIDI Data */
-	if (this->midiValid) {
-		int currentMIDITrack = quickAPI::getSeqTrackCurrentMIDITrack(this->index);
-		auto midiDataRef = quickAPI::getSeqTrackMIDIRef(this->index);
-		auto midiNoteList = quickAPI::getMIDISourceNotes(midiDataRef, currentMIDITrack);
-
-		/** Add Each Note */
-		this->midiDataTemp.ensureStorageAllocated(midiNoteList.size());
-		for (auto& note : midiNoteList) {
-			this->midiDataTemp.add({ note.timeSec, note.endSec, note.pitch });
-		}
-	}
-
 	/** Update Image Temp */
 	this->updateDataImage();
 
@@ -179,37 +154,31 @@ void SeqTrackContentViewer::updateData() {
 void SeqTrackContentViewer::updateDataImage() {
 	/** Audio Data */
 	if (this->audioValid) {
-		/** Get Data */
-		auto& [sampleRate, data] = this->audioDataTemp;
-
-		/** Prepare Callback */
-		auto callback = [comp = SafePointer{ this }](const AudioExtractor::Result& result) {
-			if (comp) {
-				/** Set Temp */
-				comp->setAudioPointTempInternal(result);
-
-				/** Repaint */
-				comp->repaint();
-			}
-			};
-
-		/** Get Point Num */
-		double lengthSec = data.getNumSamples() / sampleRate;
-		int pointNum = std::floor(lengthSec * this->itemSize);
-
-		/** Extract */
-		AudioExtractor::getInstance() ->extractAsync(
-			this, data, pointNum, callback);
+		/** Update Peaks */
+		this->updateAudioPointTempInternal();
+	}
+	else {
+		/** Clear Peaks */
+		this->blockImageUpdateTimer->stopTimer();
+		this->audioPointTemp.clear();
+		this->audioPointStartSec = this->audioPointEndSec = 0;
+		this->repaint();
 	}
 	
 	/** MIDI Data */
 	if (this->midiValid) {
 		/** Update MIDI */
 		this->updateMIDINoteTempInternal();
-
-		/** Repaint */
-		this->repaint();
 	}
+	else {
+		/** Clear MIDI */
+		this->midiDataTemp.clear();
+		this->midiNoteStartSec = this->midiNoteEndSec = 0;
+		this->midiMinNote = this->midiMaxNote = 0;
+	}
+
+	/** Repaint */
+	this->repaint();
 }
 
 void SeqTrackContentViewer::resized() {
@@ -247,20 +216,13 @@ void SeqTrackContentViewer::paint(juce::Graphics& g) {
 	juce::Font blockNameFont(juce::FontOptions{ blockNameFontHeight });
 
 	/** Data Scale Ratio */
-	auto& [sampleRate, data] = this->audioDataTemp;
-	double dstLengthSec = data.getNumSamples() / sampleRate;
-	int dstPointNum = std::floor(dstLengthSec * this->itemSize);
 	double dstPointPerSec = this->itemSize;
-
-	double imgScaleRatio = 1;
-	if (this->audioPointTemp.size() > 0) {
-		auto& data = this->audioPointTemp.getReference(0);
-		imgScaleRatio = dstPointNum / (double)(data.getSize() / 2 / sizeof(float));
-	}
+	float pointWidth = (this->secEnd > this->secStart)
+		? (this->getWidth() / (this->secEnd - this->secStart) / dstPointPerSec) : 1.f;
 
 	/** Block Paint Func */
 	auto paintBlockFunc = [this, &g, &blockNameFont, paddingHeight, blockRadius, outlineColor, outlineThickness,
-		blockPaddingWidth, blockPaddingHeight, blockNameFontHeight, dstPointPerSec, imgScaleRatio, noteMaxHeight]
+		blockPaddingWidth, blockPaddingHeight, blockNameFontHeight, dstPointPerSec, pointWidth, noteMaxHeight]
 	(double blockStartSec, double blockEndSec, double blockOffset, float blockAlpha = 1.f) {
 		if (this->secStart >= this->secEnd) { return; }
 		float startPos = (blockStartSec - this->secStart) / (this->secEnd - this->secStart) * this->getWidth();
@@ -291,8 +253,8 @@ void SeqTrackContentViewer::paint(juce::Graphics& g) {
 			/** Select Time */
 			double startSec = std::max(blockStartSec, this->secStart) + blockOffset;
 			double endSec = std::min(blockEndSec, this->secEnd) + blockOffset;
-			int startPixel = startSec * dstPointPerSec / imgScaleRatio;
-			int endPixel = endSec * dstPointPerSec / imgScaleRatio;
+			int startPixel = std::floor((startSec - this->audioPointStartSec) * dstPointPerSec);
+			int endPixel = std::ceil((endSec - this->audioPointStartSec) * dstPointPerSec);
 
 			/** Paint Each Channel */
 			g.setColour(this->nameColor.withMultipliedAlpha(blockAlpha));
@@ -301,22 +263,22 @@ void SeqTrackContentViewer::paint(juce::Graphics& g) {
 			for (int i = 0; i < this->audioPointTemp.size(); i++) {
 				float channelPosY = wavePosY + channelHeight * i;
 				auto& data = this->audioPointTemp.getReference(i);
-				int dataSize = data.getSize() / 2 / sizeof(float);
+				auto dataPtr = static_cast<const float*>(data.getData());
+				int dataSize = data.getSize() / 3 / sizeof(float);
 
 				/** Paint Each Point */
 				for (int j = std::max(startPixel, 0); j <= endPixel && j < dataSize; j++) {
 					/** Get Value */
-					float minVal = 0, maxVal = 0;
-					data.copyTo(&minVal, (j * 2 + 0) * (int)sizeof(float), sizeof(float));
-					data.copyTo(&maxVal, (j * 2 + 1) * (int)sizeof(float), sizeof(float));
+					float minVal = dataPtr[j * 3 + 0];
+					float maxVal = dataPtr[j * 3 + 1];
 
 					/** Paint Point */
-					double pixelSec = j * imgScaleRatio / dstPointPerSec;
+					double pixelSec = this->audioPointStartSec + j / dstPointPerSec;
 					float pixelPosX = (pixelSec - blockOffset - this->secStart) / (this->secEnd - this->secStart) * this->getWidth();
 					juce::Rectangle<float> pointRect(
 						pixelPosX,
 						channelPosY + channelHeight / 2.f - (maxVal / 1.f) * channelHeight / 2.f,
-						imgScaleRatio,
+						pointWidth,
 						channelHeight * ((maxVal - minVal) / 2.f));
 					g.fillRect(pointRect);
 				}
@@ -352,6 +314,8 @@ void SeqTrackContentViewer::paint(juce::Graphics& g) {
 			std::fill(noteStartTime.begin(), noteStartTime.end(), -1.0);
 
 			for (auto& [noteStartSec, noteEndSec, noteNum] : this->midiDataTemp) {
+				if (noteEndSec < startSec || noteStartSec > endSec) { continue; }
+
 				double noteStart = std::max(noteStartSec, startSec);
 				double noteEnd = std::min(noteEndSec, endSec);
 				juce::Rectangle<float> noteRect(
@@ -808,21 +772,93 @@ void SeqTrackContentViewer::updateBlockInternal(int blockIndex) {
 	}
 }
 
-void SeqTrackContentViewer::setAudioPointTempInternal(
-	const juce::Array<juce::MemoryBlock>& temp) {
-	this->audioPointTemp = temp;
+void SeqTrackContentViewer::updateAudioPointTempInternal() {
+	/** Source Area Of Blocks Around View */
+	double viewLength = this->secEnd - this->secStart;
+	auto [startSec, endSec] = this->getSourceArea(
+		this->secStart - viewLength, this->secEnd + viewLength);
+
+	/** Align Points To Pixels */
+	int pointNum = 0;
+	if (this->itemSize > 0 && endSec > startSec) {
+		startSec = std::floor(startSec * this->itemSize) / this->itemSize;
+		endSec = std::ceil(endSec * this->itemSize) / this->itemSize;
+		pointNum = std::round((endSec - startSec) * this->itemSize);
+	}
+
+	/** Get Peaks */
+	bool complete = true;
+	juce::Array<juce::MemoryBlock> temp;
+	if (pointNum > 0) {
+		std::tie(complete, temp) = quickAPI::getSeqTrackAudioPeak(
+			this->index, startSec, endSec, pointNum);
+	}
+
+	/** Keep Old Wave Until Peaks Are Ready */
+	if (complete || temp.size() > 0) {
+		this->audioPointTemp = temp;
+		this->audioPointStartSec = startSec;
+		this->audioPointEndSec = endSec;
+	}
+
+	/** Poll While Peaks Are Building Or Recording */
+	if (complete) {
+		this->blockImageUpdateTimer->stopTimer();
+	}
+	else if (!this->blockImageUpdateTimer->isTimerRunning()) {
+		this->blockImageUpdateTimer->startTimer(200);
+	}
+
+	/** Repaint */
+	this->repaint();
+}
+
+void SeqTrackContentViewer::checkSourceTempInternal() {
+	/** Visible Source Area */
+	auto [startSec, endSec] = this->getSourceArea(this->secStart, this->secEnd);
+	if (endSec <= startSec) { return; }
+
+	/** Update When Visible Source Area Is Out Of Temp */
+	if (this->audioValid) {
+		if (startSec < this->audioPointStartSec || endSec > this->audioPointEndSec) {
+			this->updateAudioPointTempInternal();
+		}
+	}
+	if (this->midiValid) {
+		if (startSec < this->midiNoteStartSec || endSec > this->midiNoteEndSec) {
+			this->updateMIDINoteTempInternal();
+		}
+	}
 }
 
 void SeqTrackContentViewer::updateMIDINoteTempInternal() {
-	/** Get Note Zone */
-	uint8_t minNote = 127, maxNote = 0;
-	for (auto& [start, end, num] : this->midiDataTemp) {
-		minNote = std::min(minNote, num);
-		maxNote = std::max(maxNote, num);
+	/** Source Area Of Blocks Around View */
+	double viewLength = this->secEnd - this->secStart;
+	auto [startSec, endSec] = this->getSourceArea(
+		this->secStart - viewLength, this->secEnd + viewLength);
+
+	/** Clear Temp */
+	this->midiDataTemp.clearQuick();
+	this->midiMinNote = this->midiMaxNote = 0;
+
+	/** Get Notes In Area */
+	int currentMIDITrack = quickAPI::getSeqTrackCurrentMIDITrack(this->index);
+	auto midiDataRef = quickAPI::getSeqTrackMIDIRef(this->index);
+	std::tie(this->midiMinNote, this->midiMaxNote)
+		= quickAPI::getMIDISourceNotePitchRange(midiDataRef, currentMIDITrack);
+	if (endSec > startSec) {
+		auto midiNoteList = quickAPI::getMIDISourceNotesInArea(
+			midiDataRef, currentMIDITrack, startSec, endSec);
+
+		/** Add Each Note */
+		this->midiDataTemp.ensureStorageAllocated(midiNoteList.size());
+		for (auto& note : midiNoteList) {
+			this->midiDataTemp.add({ note.timeSec, note.endSec, note.pitch });
+		}
 	}
-	if (maxNote < minNote) { maxNote = minNote = 0; }
-	this->midiMinNote = minNote;
-	this->midiMaxNote = maxNote;
+
+	this->midiNoteStartSec = startSec;
+	this->midiNoteEndSec = endSec;
 }
 
 std::tuple<SeqTrackContentViewer::BlockControllerType, int> 
@@ -984,3 +1020,21 @@ std::tuple<double, double> SeqTrackContentViewer::getViewArea(double pos, double
 	double secLength = this->getWidth() / itemSize;
 	return { secStart, secStart + secLength };
 }
+
+std::tuple<double, double> SeqTrackContentViewer::getSourceArea(double startSec, double endSec) const {
+	double areaStart = std::numeric_limits<double>::max();
+	double areaEnd = std::numeric_limits<double>::lowest();
+
+	/** Source Time Of Each Block In Area */
+	for (auto block : this->blockTemp) {
+		double start = std::max(block->startTime, startSec);
+		double end = std::min(block->endTime, endSec);
+		if (end <= start) { continue; }
+
+		areaStart = std::min(areaStart, start + block->offset);
+		areaEnd = std::max(areaEnd, end + block->offset);
+	}
+
+	if (areaEnd <= areaStart) { return { 0, 0 }; }
+	return { std::max(areaStart, 0.0), areaEnd };
+}
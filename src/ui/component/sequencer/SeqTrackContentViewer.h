@@ -63,12 +63,15 @@ private:
 	};
 	juce::OwnedArray<BlockItem> blockTemp;
 
-	std::tuple<double, juce::AudioSampleBuffer> audioDataTemp;
 	/** Start, End, Num */
 	using Note = std::tuple<double, double, uint8_t>;
+	/** Notes in [midiNoteStartSec, midiNoteEndSec] of the source */
 	juce::Array<Note> midiDataTemp;
+	double midiNoteStartSec = 0, midiNoteEndSec = 0;
 
+	/** Min, max and RMS of each point in [audioPointStartSec, audioPointEndSec) of the source */
 	juce::Array<juce::MemoryBlock> audioPointTemp;
+	double audioPointStartSec = 0, audioPointEndSec = 0;
 	uint8_t midiMinNote = 0, midiMaxNote = 0;
 
 	std::unique_ptr<juce::Timer> blockImageUpdateTimer = nullptr;
@@ -85,7 +88,8 @@ private:
 	bool copyMode = false;
 
 	void updateBlockInternal(int blockIndex);
-	void setAudioPointTempInternal(const juce::Array<juce::MemoryBlock>& temp);
+	void updateAudioPointTempInternal();
+	void checkSourceTempInternal();
 	void updateMIDINoteTempInternal();
 
 	enum class BlockControllerType {
@@ -106,6 +110,7 @@ private:
 	juce::PopupMenu createMenu(double seconds, int blockIndex);
 
 	std::tuple<double, double> getViewArea(double pos, double itemSize) const;
+	std::tuple<double, double> getSourceArea(double startSec, double endSec) const;
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SeqTrackContentViewer)
 };
@@ -10,26 +10,24 @@ SeqTrackLevelMeter::SeqTrackLevelMeter() {
 
 void SeqTrackLevelMeter::updateLevelMeter() {
 	/** Get Value */
-	auto valuesTemp = quickAPI::getSeqTrackOutputLevel(this->index);
-	if (this->values.size() == valuesTemp.size()) {
-		this->values.clearQuick();
-	}
-	else {
-		this->values.clear();
-	}
-	for (auto i : valuesTemp) {
-		this->values.add(utils::logRMS(i));
+	this->values.clearQuick();
+	if (auto meter = quickAPI::getSeqTrackOutputMeter(this->index)) {
+		for (int i = 0; i < meter->getChannelNum(); i++) {
+			this->values.add(utils::logRMS(meter->getLevel(i).rms));
+		}
 	}
 
 	/** Repaint */
 	this->repaint();
+}
 
-	/** Tooltip */
+juce::String SeqTrackLevelMeter::getTooltip() {
+	/** Only Built While Hovered */
 	juce::String tooltipStr;
 	for (auto i : this->values) {
 		tooltipStr += (juce::String{ i, 2 } + " dB, ");
 	}
-	this->setTooltip(tooltipStr);
+	return tooltipStr;
 }
 
 void SeqTrackLevelMeter::paint(juce::Graphics& g) {
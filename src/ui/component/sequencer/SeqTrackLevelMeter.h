@@ -6,13 +6,14 @@
 class SeqTrackLevelMeter final
 	: public juce::Component,
 	public LevelMeterHub::Target,
-	public juce::SettableTooltipClient {
+	public juce::TooltipClient {
 public:
 	SeqTrackLevelMeter();
 
 	void updateLevelMeter() override;
 
 	void paint(juce::Graphics& g) override;
+	juce::String getTooltip() override;
 
 	void update(int index);
 
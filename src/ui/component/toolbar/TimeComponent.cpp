@@ -20,15 +20,16 @@ void TimeComponent::updateLevelMeter() {
 	std::tie(this->timeInMeasure, this->timeInBeat) = quickAPI::getTimeInBeat();
 	this->timeInSec = quickAPI::getTimeInSecond();
 
-	auto levelTemp = quickAPI::getAudioOutputLevel();
-	if (this->level.size() == levelTemp.size()) {
-		this->level.clearQuick();
-	}
-	else {
-		this->level.clear();
-	}
-	for (auto i : levelTemp) {
-		this->level.add(utils::logRMS(i));
+	this->level.clearQuick();
+	this->truePeakMax = 0;
+	this->loudness = {};
+	if (auto meter = quickAPI::getAudioOutputMeter()) {
+		for (int i = 0; i < meter->getChannelNum(); i++) {
+			auto channelLevel = meter->getLevel(i);
+			this->level.add(utils::logRMS(channelLevel.rms));
+			this->truePeakMax = std::max(this->truePeakMax, channelLevel.truePeakMax);
+		}
+		this->loudness = meter->getLoudness();
 	}
 
 	this->isPlaying = quickAPI::isPlaying();
@@ -274,7 +275,10 @@ void TimeComponent::mouseUp(const juce::MouseEvent& event) {
 			this->switchTime();
 		}
 		else {
-			/** Nothing To Do */
+			/** Reset Peak And Loudness */
+			if (auto meter = quickAPI::getAudioOutputMeter()) {
+				meter->reset();
+			}
 		}
 		return;
 	}
@@ -308,6 +312,9 @@ void TimeComponent::mouseMove(const juce::MouseEvent& event) {
 				str += ", ";
 			}
 		}
+		str += "\n" + TRANS("True Peak:") + " " + juce::String{ utils::logRMS(this->truePeakMax), 2 } + " dBTP\n"
+			+ TRANS("Short-Term:") + " " + juce::String{ this->loudness.shortTerm, 1 } + " LUFS, "
+			+ TRANS("Integrated:") + " " + juce::String{ this->loudness.integrated, 1 } + " LUFS";
 		this->setTooltip(str);
 	}
 	/** Status */
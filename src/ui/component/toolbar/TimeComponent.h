@@ -2,6 +2,7 @@
 
 #include <JuceHeader.h>
 #include "../../misc/LevelMeterHub.h"
+#include "../../../audioCore/AC_API.h"
 
 class TimeComponent final
 	: public juce::Component,
@@ -26,6 +27,8 @@ private:
 	bool showSec = true;
 
 	juce::Array<float> level;
+	float truePeakMax = 0;
+	quickAPI::Loudness loudness;
 
 	bool isPlaying = false;
 	bool isRecording = false;
@@ -90,6 +90,10 @@ CoreCallbacks::CoreCallbacks() {
 		[](const std::set<int>& trackList) {
 			CoreCallbacks::getInstance()->invokeSourceRecord(trackList);
 		});
+	UICallbackAPI<const juce::String&, double>::set(UICallbackType::SourceLoadProgress,
+		[](const juce::String& path, double progress) {
+			CoreCallbacks::getInstance()->invokeSourceLoadProgress(path, progress);
+		});
 }
 
 void CoreCallbacks::addError(const ErrorCallback& callback) {
@@ -180,6 +184,10 @@ void CoreCallbacks::addSourceRecord(const SourceRecordCallback& callback) {
 	this->sourceRecord.add(callback);
 }
 
+void CoreCallbacks::addSourceLoadProgress(const SourceLoadProgressCallback& callback) {
+	this->sourceLoadProgress.add(callback);
+}
+
 void CoreCallbacks::addEditingSeqChanged(const EditingSeqChangedCallback& callback) {
 	this->editingSeqChanged.add(callback);
 }
@@ -317,6 +325,12 @@ void CoreCallbacks::invokeSourceRecord(const std::set<int>& trackList) const {
 	}
 }
 
+void CoreCallbacks::invokeSourceLoadProgress(const juce::String& path, double progress) const {
+	for (auto& i : this->sourceLoadProgress) {
+		i(path, progress);
+	}
+}
+
 void CoreCallbacks::invokeEditingSeqChanged(int index) const {
 	for (auto& i : this->editingSeqChanged) {
 		i(index);
@@ -46,6 +46,8 @@ public:
 	void addSynthStatus(const SynthStatusCallback& callback);
 	using SourceRecordCallback = std::function<void(const std::set<int>&)>;
 	void addSourceRecord(const SourceRecordCallback& callback);
+	using SourceLoadProgressCallback = std::function<void(const juce::String&, double)>;
+	void addSourceLoadProgress(const SourceLoadProgressCallback& callback);
 	using EditingSeqChangedCallback = std::function<void(int)>;
 	void addEditingSeqChanged(const EditingSeqChangedCallback& callback);
 
@@ -71,6 +73,7 @@ public:
 	void invokePluginSearchMes(const juce::String& mes) const;
 	void invokeSynthStatus(int index, bool status) const;
 	void invokeSourceRecord(const std::set<int>& trackList) const;
+	void invokeSourceLoadProgress(const juce::String& path, double progress) const;
 	void invokeEditingSeqChanged(int index) const;
 
 private:
@@ -96,6 +99,7 @@ private:
 	juce::Array<PluginSearchMesCallback> pluginSearchMesChanged;
 	juce::Array<SynthStatusCallback> synthStatus;
 	juce::Array<SourceRecordCallback> sourceRecord;
+	juce::Array<SourceLoadProgressCallback> sourceLoadProgress;
 	juce::Array<EditingSeqChangedCallback> editingSeqChanged;
 
 public:
@@ -1,22 +1,108 @@
 ﻿#include "InitTaskList.h"
+#include "MainThreadPool.h"
 
-void InitTaskList::add(const InitTask& task) {
-	this->tasks.add(task);
+void InitTaskList::add(const juce::String& name, const InitTask& task,
+	const juce::StringArray& dependencies, ThreadType thread) {
+	this->tasks.push_back({ name, task, dependencies, thread });
+}
+
+void InitTaskList::setMessageCallback(const MessageCallback& callback) {
+	this->messageCallback = callback;
 }
 
 void InitTaskList::runNow() {
-	std::function<void(void)> taskWrappedHead = [] {};
-	for (int i = this->tasks.size() - 1; i >= 0; i--) {
-		auto wrappedFunc =
-			[func = this->tasks.getUnchecked(i),
-			next = taskWrappedHead] {
-				func();
-				juce::MessageManager::callAsync(next);
-			};
-		taskWrappedHead = wrappedFunc;
+	/** Link Dependencies */
+	for (int i = 0; i < (int)this->tasks.size(); i++) {
+		auto& task = this->tasks[i];
+		for (auto& name : task.dependencies) {
+			auto it = std::find_if(this->tasks.begin(), this->tasks.end(),
+				[&name](const Task& t) { return t.name == name; });
+			if (it == this->tasks.end()) {
+				/** Unknown Dependency */
+				jassertfalse;
+				continue;
+			}
+
+			it->dependents.add(i);
+			task.waitingNum++;
+		}
+	}
+
+	/** Start Tasks Without Dependencies */
+	this->runStartTime = juce::Time::getMillisecondCounterHiRes();
+	this->finishedNum = 0;
+	for (int i = 0; i < (int)this->tasks.size(); i++) {
+		if (this->tasks[i].waitingNum == 0) {
+			juce::MessageManager::callAsync([i] {
+				if (auto ptr = InitTaskList::getInstanceWithoutCreate()) {
+					ptr->startTask(i);
+				}
+				});
+		}
+	}
+}
+
+void InitTaskList::startTask(int index) {
+	auto& task = this->tasks[index];
+	task.startTime = juce::Time::getMillisecondCounterHiRes();
+
+	if (this->messageCallback) {
+		this->messageCallback(task.name);
+	}
+
+	/** Run On Message Thread */
+	if (task.thread == ThreadType::Message) {
+		if (task.func) { task.func(); }
+		this->finishTask(index);
+		return;
+	}
+
+	/** Run On Worker */
+	MainThreadPool::getInstance()->runJob(
+		[index, func = task.func] {
+			if (func) { func(); }
+			juce::MessageManager::callAsync([index] {
+				if (auto ptr = InitTaskList::getInstanceWithoutCreate()) {
+					ptr->finishTask(index);
+				}
+				});
+		});
+}
+
+void InitTaskList::finishTask(int index) {
+	auto& task = this->tasks[index];
+	task.endTime = juce::Time::getMillisecondCounterHiRes();
+	this->finishedNum++;
+
+	/** Start Dependents Which Are Ready */
+	for (auto i : task.dependents) {
+		if (--(this->tasks[i].waitingNum) == 0) {
+			juce::MessageManager::callAsync([i] {
+				if (auto ptr = InitTaskList::getInstanceWithoutCreate()) {
+					ptr->startTask(i);
+				}
+				});
+		}
+	}
+
+	/** All Finished */
+	if (this->finishedNum == (int)this->tasks.size()) {
+		this->logReport();
+	}
+}
+
+void InitTaskList::logReport() const {
+	juce::String report = "Startup finished in "
+		+ juce::String{ juce::Time::getMillisecondCounterHiRes() - this->runStartTime, 1 } + " ms\n";
+
+	for (auto& task : this->tasks) {
+		report += "    " + task.name.paddedRight(' ', 36)
+			+ ((task.thread == ThreadType::Worker) ? "worker " : "message")
+			+ "    start " + juce::String{ task.startTime - this->runStartTime, 1 }.paddedLeft(' ', 8) + " ms"
+			+ "    took " + juce::String{ task.endTime - task.startTime, 1 }.paddedLeft(' ', 8) + " ms\n";
 	}
 
-	juce::MessageManager::callAsync(taskWrappedHead);
+	juce::Logger::writeToLog(report);
 }
 
 InitTaskList* InitTaskList::getInstance() {
@@ -24,6 +110,10 @@ InitTaskList* InitTaskList::getInstance() {
 		: (InitTaskList::instance = new InitTaskList{});
 }
 
+InitTaskList* InitTaskList::getInstanceWithoutCreate() {
+	return InitTaskList::instance;
+}
+
 void InitTaskList::releaseInstance() {
 	if (InitTaskList::instance) {
 		delete InitTaskList::instance;
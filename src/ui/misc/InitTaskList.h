@@ -2,19 +2,52 @@
 
 #include <JuceHeader.h>
 
+/**
+ * @brief	Startup tasks with declared dependencies.
+ *			Each task starts once all of its dependencies finished. Message tasks run on the message thread,
+ *			worker tasks run on the main thread pool and must not touch any component.
+ */
 class InitTaskList final : private juce::DeletedAtShutdown {
 public:
 	InitTaskList() = default;
 
 	using InitTask = std::function<void(void)>;
-	void add(const InitTask& task);
+	enum class ThreadType {
+		Message, Worker
+	};
+	void add(const juce::String& name, const InitTask& task,
+		const juce::StringArray& dependencies = {}, ThreadType thread = ThreadType::Message);
+
+	/** Called on the message thread with the name of each task when it starts */
+	using MessageCallback = std::function<void(const juce::String&)>;
+	void setMessageCallback(const MessageCallback& callback);
+
 	void runNow();
 
 private:
-	juce::Array<InitTask> tasks;
+	struct Task final {
+		juce::String name;
+		InitTask func;
+		juce::StringArray dependencies;
+		ThreadType thread = ThreadType::Message;
+
+		juce::Array<int> dependents;
+		int waitingNum = 0;
+		double startTime = 0, endTime = 0;
+	};
+	std::vector<Task> tasks;
+	MessageCallback messageCallback;
+
+	double runStartTime = 0;
+	int finishedNum = 0;
+
+	void startTask(int index);
+	void finishTask(int index);
+	void logReport() const;
 
 public:
 	static InitTaskList* getInstance();
+	static InitTaskList* getInstanceWithoutCreate();
 	static void releaseInstance();
 
 private:
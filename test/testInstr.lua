@@ -5,6 +5,9 @@ AC.addInstr(2, "VST-VOCALOID5 VSTi-b099a95-56355632", false);
 AC.addInstr(3, "VST-synthesizer-v-plugin64-c0552195-53796e56", false);
 AC.addInstr(4, "VST3-MONSTER Guitar v2.2022.09-e47046df-d16e2f22", false);
 
+-- Plugin Load Stats
+AC.echoPluginLoadStats();
+
 -- Remove Instrument Plugin
 AC.removeInstr(0);
 
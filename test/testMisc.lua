@@ -11,8 +11,15 @@ AC.setPlayPosition();
 AC.startRecord();
 AC.stopRecord();
 
+-- Benchmark
+AC.echoMixKernelCost(2, 512);
+AC.echoSIMDCheck();
+AC.echoDSPLoad();
+AC.resetDSPLoad();
+
 -- Render
 AC.renderNow("./", "test", ".wav", { 0, 1, 2 }, {}, 24, 0);
+AC.echoRenderStats();
 
 -- Project
 AC.newProject("C:/Music/vsp4/test/");
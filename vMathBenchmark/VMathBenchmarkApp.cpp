@@ -0,0 +1,162 @@
+﻿#include <JuceHeader.h>
+#include "audioCore/misc/VMath.h"
+
+#define OUT(x) \
+	DBG(x); \
+	std::cout << (x) << std::endl
+
+class VMathBenchmarkApp final : public juce::JUCEApplication {
+public:
+	const juce::String getApplicationName() override { return "VocalShaper.VMathBenchmark"; };
+	const juce::String getApplicationVersion() override {
+		return juce::String{ PROJECT_VERSION_MAJOR } + "." + juce::String{ PROJECT_VERSION_MINOR } + "." + juce::String{ PROJECT_VERSION_PATCH };
+	};
+	bool moreThanOneInstanceAllowed() override { return true; };
+
+	void initialise(const juce::String& commandLine) override {
+		/** Parse Command */
+		juce::StringArray commandArray = juce::StringArray::fromTokens(commandLine, " ", "\"");
+		for (auto& s : commandArray) {
+			/** Remove Quote */
+			s = s.removeCharacters("\"");
+		}
+		commandArray.removeEmptyStrings();
+		/** Check First Arg And Remove Execute Path */
+		if (commandArray.size() > 0) {
+			juce::File firstArgFile(commandArray[0]);
+			juce::File execFile = juce::File::getSpecialLocation(juce::File::hostApplicationPath);
+			if (firstArgFile == execFile) {
+				commandArray.remove(0);
+			}
+		}
+
+		/** Options */
+		juce::Array<int> blockSizes{ 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192 };
+		juce::Array<int> channelNums{ 1, 2, 8 };
+		juce::StringArray kernels = vMath::getAllKernelName();
+		int repeat = 3;
+		juce::File outputFile;
+		for (int i = 0; i < commandArray.size(); i++) {
+			auto& key = commandArray[i];
+			auto value = commandArray[i + 1];
+			if (key == "-b" || key == "--block-sizes") {
+				blockSizes = VMathBenchmarkApp::parseIntList(value); i++;
+			}
+			else if (key == "-c" || key == "--channels") {
+				channelNums = VMathBenchmarkApp::parseIntList(value); i++;
+			}
+			else if (key == "-k" || key == "--kernels") {
+				kernels = juce::StringArray::fromTokens(value, ",", ""); i++;
+			}
+			else if (key == "-r" || key == "--repeat") {
+				repeat = value.getIntValue(); i++;
+			}
+			else if (key == "-o" || key == "--output") {
+				outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(value); i++;
+			}
+			else {
+				OUT("Usage: VMathBenchmark [-b 32,64,...] [-c 1,2,...] [-k Copy,Add,...] [-r repeat] [-o result.json]");
+				this->setApplicationReturnValue(1);
+				juce::JUCEApplication::quit();
+				return;
+			}
+		}
+		if (blockSizes.isEmpty() || channelNums.isEmpty() || kernels.isEmpty() || repeat <= 0) {
+			OUT("\033[31m[ERROR]\033[0m Bad Command!");
+			this->setApplicationReturnValue(2);
+			juce::JUCEApplication::quit();
+			return;
+		}
+
+		/** Run */
+		auto result = VMathBenchmarkApp::runBenchmark(
+			blockSizes, channelNums, kernels, repeat);
+		auto json = juce::JSON::toString(result);
+
+		/** Output */
+		if (outputFile != juce::File{}) {
+			if (!outputFile.replaceWithText(json)) {
+				OUT("\033[31m[ERROR]\033[0m Can't Write Result!");
+				this->setApplicationReturnValue(3);
+			}
+		}
+		else {
+			OUT(json);
+		}
+
+		juce::JUCEApplication::quit();
+	};
+
+	void shutdown() override {};
+
+private:
+	static juce::Array<int> parseIntList(const juce::String& str) {
+		juce::Array<int> result;
+		for (auto& s : juce::StringArray::fromTokens(str, ",", "")) {
+			int value = s.getIntValue();
+			if (value > 0) {
+				result.add(value);
+			}
+		}
+		return result;
+	};
+
+	static juce::var runBenchmark(const juce::Array<int>& blockSizes,
+		const juce::Array<int>& channelNums, const juce::StringArray& kernels, int repeat) {
+		auto insTypeNames = vMath::getAllInsTypeName();
+
+		/** Host Info */
+		auto host = std::make_unique<juce::DynamicObject>();
+		host->setProperty("cpu", juce::SystemStats::getCpuModel());
+		host->setProperty("cores", juce::SystemStats::getNumPhysicalCpus());
+		host->setProperty("os", juce::SystemStats::getOperatingSystemName());
+		host->setProperty("bestInsType", insTypeNames[vMath::getBestInsType()]);
+
+		/** Measure Each Case, Keep The Fastest Of Repeats */
+		juce::Array<juce::var> results;
+		for (auto& kernel : kernels) {
+			int bytesPerSample = vMath::getKernelBytesPerSample(kernel);
+			if (bytesPerSample <= 0) { continue; }
+
+			for (int type = vMath::InsType::Normal; type < vMath::InsType::MaxNum; type++) {
+				if (!vMath::isInsTypeSupported((vMath::InsType)type)) { continue; }
+
+				for (auto aligned : { true, false }) {
+					for (auto channels : channelNums) {
+						for (auto blockSize : blockSizes) {
+							/** About 1M Samples Per Run */
+							int blockNum = std::max(16, (1 << 20) / (blockSize * channels));
+
+							double seconds = 0;
+							for (int i = 0; i < repeat; i++) {
+								double current = vMath::benchmarkKernel(kernel, (vMath::InsType)type,
+									aligned, channels, blockSize, blockNum);
+								seconds = (i == 0) ? current : std::min(seconds, current);
+							}
+							if (seconds <= 0) { continue; }
+
+							double samples = (double)blockSize * channels;
+							auto item = std::make_unique<juce::DynamicObject>();
+							item->setProperty("kernel", kernel);
+							item->setProperty("insType", insTypeNames[type]);
+							item->setProperty("aligned", aligned);
+							item->setProperty("channels", channels);
+							item->setProperty("blockSize", blockSize);
+							item->setProperty("blockNum", blockNum);
+							item->setProperty("nsPerSample", seconds * 1000000000 / samples);
+							item->setProperty("gbPerSecond", samples * bytesPerSample / seconds / 1000000000);
+							results.add(juce::var{ item.release() });
+						}
+					}
+				}
+			}
+		}
+
+		auto result = std::make_unique<juce::DynamicObject>();
+		result->setProperty("host", juce::var{ host.release() });
+		result->setProperty("results", results);
+		return juce::var{ result.release() };
+	};
+};
+
+START_JUCE_APPLICATION(VMathBenchmarkApp)